@@ -14,12 +14,15 @@ IGNORED_FUNCTIONS = [
     'print_read_backtrace',
     'print_write_backtrace',
     'mock_entry_create_write_backtrace',
+    'mock_entry_copy_write_backtrace',
     'mock_entry_print_write_backtrace',
     'create_mock_entry',
     'read_mock_entry',
     'harness_mock_assert',
     'harness_mock_read',
+    'harness_mock_read_many',
     'harness_mock_write',
+    'harness_mock_write_many',
     'harness_mock_mwrite',
     'harness_mock_cwrite',
     'harness_mock_write_notify',
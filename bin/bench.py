@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+#
+# Extract benchmark results, as written by bench_print_json(), from
+# the output of an application, and optionally compare them to a
+# baseline for regression tracking.
+#
+
+import sys
+import json
+import argparse
+
+
+def find_results(text):
+    """Returns the results in given results file contents, or the last
+    benchmark results object in given application output.
+
+    """
+
+    try:
+        results = json.loads(text)
+    except ValueError:
+        results = None
+
+    if isinstance(results, dict) and 'benchmarks' in results:
+        return results
+
+    results = None
+
+    for line in text.splitlines():
+        line = line.strip()
+
+        if not line.startswith('{'):
+            continue
+
+        try:
+            value = json.loads(line)
+        except ValueError:
+            continue
+
+        if isinstance(value, dict) and 'benchmarks' in value:
+            results = value
+
+    return results
+
+
+def load_results(path):
+    if path == '-':
+        text = sys.stdin.read()
+    else:
+        with open(path, 'r', errors='replace') as fin:
+            text = fin.read()
+
+    results = find_results(text)
+
+    if results is None:
+        sys.exit('error: no benchmark results found in {}'.format(path))
+
+    return results
+
+
+def compare(results, baseline, metric, threshold):
+    """Print a comparison of given results and baseline. Returns the
+    names of benchmarks that are slower than the baseline by more
+    than given threshold in percent.
+
+    """
+
+    baseline = {
+        benchmark['name']: benchmark
+        for benchmark in baseline['benchmarks']
+    }
+    regressions = []
+
+    print('{:32} {:>14} {:>14} {:>8}'.format('NAME',
+                                             'BASELINE',
+                                             metric.upper(),
+                                             'CHANGE'))
+
+    for benchmark in results['benchmarks']:
+        name = benchmark['name']
+        value = benchmark['ns'][metric]
+
+        if name not in baseline:
+            print('{:32} {:>14} {:>14.3f} {:>8}'.format(name, '-', value, '-'))
+            continue
+
+        old = baseline[name]['ns'][metric]
+
+        if old > 0:
+            change = 100 * (value - old) / old
+        else:
+            change = 0
+
+        if change > threshold:
+            regressions.append(name)
+            marker = ' *'
+        else:
+            marker = ''
+
+        print('{:32} {:>14.3f} {:>14.3f} {:>+7.1f}%{}'.format(name,
+                                                             old,
+                                                             value,
+                                                             change,
+                                                             marker))
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Extract and compare benchmark results.')
+    parser.add_argument('-o', '--output',
+                        help='Write the extracted results to given file.')
+    parser.add_argument('-b', '--baseline',
+                        help='Baseline results file or application output '
+                        'to compare to.')
+    parser.add_argument('-m', '--metric',
+                        choices=['min', 'p50', 'p90', 'p99', 'max', 'mean'],
+                        default='p50',
+                        help='Time to compare (default: %(default)s).')
+    parser.add_argument('-t', '--threshold',
+                        type=float,
+                        default=10,
+                        help='Maximum allowed slowdown in percent '
+                        '(default: %(default)s).')
+    parser.add_argument('infile',
+                        help='Application output, or - for standard input.')
+    args = parser.parse_args()
+
+    results = load_results(args.infile)
+
+    if args.output:
+        with open(args.output, 'w') as fout:
+            json.dump(results, fout, indent=2)
+
+    if args.baseline:
+        regressions = compare(results,
+                              load_results(args.baseline),
+                              args.metric,
+                              args.threshold)
+
+        if regressions:
+            print()
+            print('{} benchmark(s) slower than the baseline by more than '
+                  '{}%: {}'.format(len(regressions),
+                                   args.threshold,
+                                   ', '.join(regressions)))
+            sys.exit(1)
+    elif not args.output:
+        json.dump(results, sys.stdout, indent=2)
+        print()
+
+
+if __name__ == "__main__":
+    main()
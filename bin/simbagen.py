@@ -135,6 +135,11 @@ const FAR struct setting_t settings[] = {{
     {{ NULL, 0, 0, 0 }}
 }};
 
+/* Indices into the settings array, sorted by name. */
+const FAR uint16_t settings_by_name[] = {{
+{by_name}
+}};
+
 const FAR uint8_t settings_default[CONFIG_SETTINGS_AREA_SIZE] = {{{default_data}}};
 """
 
@@ -463,9 +468,18 @@ class Settings(object):
         default_data = ', '.join([str(byte)
                                   for byte in bytearray(self.as_binary())])
 
+        setting_names = list(self.settings.keys())
+        by_name = sorted(range(len(setting_names)),
+                         key=lambda index: setting_names[index])
+        by_name = ', '.join([str(index) for index in by_name])
+
+        if not by_name:
+            by_name = '0'
+
         return SETTINGS_FMT.format(names='\n'.join(names),
                                    functions='\n'.join(functions),
                                    array='\n'.join(array),
+                                   by_name='    ' + by_name,
                                    default_data=default_data)
 
 
@@ -56,8 +56,14 @@ SOAM_TYPE_DATABASE_ID_REQUEST          = 8
 SOAM_TYPE_DATABASE_ID_RESPONSE         = 9
 SOAM_TYPE_DATABASE_REQUEST             = 10
 SOAM_TYPE_DATABASE_RESPONSE            = 11
+SOAM_TYPE_COMMAND_BATCH_REQUEST        = 12
+SOAM_TYPE_SNAPSHOT_REQUEST             = 13
+SOAM_TYPE_SNAPSHOT_RESPONSE            = 14
 SOAM_TYPE_INVALID_TYPE                 = 15
 
+SOAM_SNAPSHOT_COUNTER                  = 1
+SOAM_SNAPSHOT_PARAMETER_INT            = 2
+
 SOAM_SEGMENT_SIZE_MIN = 7
 SOAM_SEGMENT_SIZE_MAX = 1024
 
@@ -315,7 +321,12 @@ class ReaderThread(threading.Thread):
                                  SOAM_TYPE_COMMAND_RESPONSE_DATA_BINARY]:
                 response_data.append((packet_type, transaction_id, packet))
             elif packet_type == SOAM_TYPE_COMMAND_RESPONSE:
-                code = struct.unpack('>i', packet)[0]
+                # One code per command in a batch request.
+                if len(packet) == 4:
+                    code = struct.unpack('>i', packet)[0]
+                else:
+                    code = list(struct.unpack('>{}i'.format(len(packet) // 4),
+                                              packet))
 
                 with self.response_packet_cond:
                     self.response_packet = transaction_id, code, response_data
@@ -326,6 +337,10 @@ class ReaderThread(threading.Thread):
                 with self.response_packet_cond:
                     self.response_packet = packet
                     self.response_packet_cond.notify_all()
+            elif packet_type == SOAM_TYPE_SNAPSHOT_RESPONSE:
+                with self.response_packet_cond:
+                    self.response_packet = transaction_id, packet
+                    self.response_packet_cond.notify_all()
             elif packet_type == SOAM_TYPE_INVALID_TYPE:
                 print('warning: "invalid type" packet received', file=self.ostream)
             else:
@@ -474,9 +489,9 @@ class Client(object):
 
         return self.reader.read_response(self.database_response_timeout)
 
-    def execute_command(self, command_with_args):
-        """Execute given file system (fs) command and return a tuple of the
-        command status code and output.
+    def encode_command(self, command_with_args):
+        """Replace the command path in given command string with its
+        database identity.
 
         """
 
@@ -494,24 +509,106 @@ class Client(object):
         data = data.replace(command.encode('ascii'), command_id, 1)
         data += b'\x00'
 
-        segment = self.create_soam_segment(SOAM_TYPE_COMMAND_REQUEST, data)
-        self.write_soam_segment(segment)
+        return data
+
+    def read_transaction_response(self, description):
+        """Wait for the response to the last request.
+
+        """
 
         while True:
             try:
                 response = self.reader.read_response(self.response_timeout)
             except TimeoutError:
-                raise TimeoutError('{}: timeout waiting for command '
-                                   'response'.format(command_with_args))
+                raise TimeoutError('{}: timeout waiting for '
+                                   'response'.format(description))
 
-            response_transaction_id, code, response_data_list = response
+            if response[0] == self.transaction_id:
+                return response
 
-            if response_transaction_id == self.transaction_id:
-                break
-
-            print('warning: {}: unexpected transaction id in command '
+            print('warning: {}: unexpected transaction id in '
                   'response.'.format(response), file=self.ostream)
 
+    def execute_commands(self, commands):
+        """Execute given file system (fs) commands in a single request
+        packet and return a tuple of the list of command status codes
+        and their combined output.
+
+        """
+
+        data = b''.join([self.encode_command(command)
+                         for command in commands])
+        segment = self.create_soam_segment(SOAM_TYPE_COMMAND_BATCH_REQUEST,
+                                           data)
+        self.write_soam_segment(segment)
+        _, codes, response_data_list = self.read_transaction_response(
+            'batch')
+
+        if not isinstance(codes, list):
+            codes = [codes]
+
+        return codes, self.format_response_data(codes[0], response_data_list)
+
+    def get_snapshot(self, paths):
+        """Read the values of given counters and integer parameters in a
+        single request. Returns a list of values in the same order as
+        given paths, None for missing or unsupported paths.
+
+        """
+
+        data = b''
+
+        for path in paths:
+            if path[0] != '/':
+                path = '/' + path
+
+            try:
+                data += b'/' + struct.pack('>H', self.database.commands[path])
+            except KeyError:
+                data += path.encode('ascii')
+
+            data += b'\x00'
+
+        segment = self.create_soam_segment(SOAM_TYPE_SNAPSHOT_REQUEST, data)
+        self.write_soam_segment(segment)
+        _, packet = self.read_transaction_response('snapshot')
+        values = []
+        offset = 0
+
+        while offset < len(packet):
+            kind = packet[offset]
+            offset += 1
+
+            if kind == SOAM_SNAPSHOT_COUNTER:
+                values.append(struct.unpack('>Q', packet[offset:offset + 8])[0])
+                offset += 8
+            elif kind == SOAM_SNAPSHOT_PARAMETER_INT:
+                values.append(struct.unpack('>i', packet[offset:offset + 4])[0])
+                offset += 4
+            else:
+                values.append(None)
+
+        return values
+
+    def execute_command(self, command_with_args):
+        """Execute given file system (fs) command and return a tuple of the
+        command status code and output.
+
+        """
+
+        data = self.encode_command(command_with_args)
+        segment = self.create_soam_segment(SOAM_TYPE_COMMAND_REQUEST, data)
+        self.write_soam_segment(segment)
+        _, code, response_data_list = self.read_transaction_response(
+            command_with_args)
+
+        return code, self.format_response_data(code, response_data_list)
+
+    def format_response_data(self, code, response_data_list):
+        """Format given command response data packets.
+
+        """
+
         formatted_response_data = ''
 
         for packet_type, response_transaction_id, response_data in response_data_list:
@@ -542,7 +639,7 @@ class Client(object):
             else:
                 formatted_response_data += response_data
 
-        return code, formatted_response_data
+        return formatted_response_data
 
 
 class CommandStatus(object):
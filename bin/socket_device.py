@@ -24,6 +24,8 @@ TYPE_CAN_DEVICE_REQUEST                =  7
 TYPE_CAN_DEVICE_RESPONSE               =  8
 TYPE_I2C_DEVICE_REQUEST                =  9
 TYPE_I2C_DEVICE_RESPONSE               = 10
+TYPE_CAN_DEVICE_BINARY_REQUEST         = 11
+TYPE_CAN_DEVICE_BINARY_RESPONSE        = 12
 
 
 # Maps device type strings to request types.
@@ -32,10 +34,15 @@ REQUEST_TYPE_FROM_STRING = {
     'pin': TYPE_PIN_DEVICE_REQUEST,
     'pwm': TYPE_PWM_DEVICE_REQUEST,
     'can': TYPE_CAN_DEVICE_REQUEST,
+    'can_binary': TYPE_CAN_DEVICE_BINARY_REQUEST,
     'i2c': TYPE_I2C_DEVICE_REQUEST
 }
 
 
+# Extended frame flag in binary can frame ids.
+CAN_BINARY_EXTENDED_FRAME = 0x80000000
+
+
 # Error codes.
 ENODEV     = 19
 EADDRINUSE = 98
@@ -263,6 +270,97 @@ def reader_line_main(device):
             print(prefix, line)
 
 
+def can_frame_pack(frame_id, extended_frame, data):
+    """Pack given can frame in the binary format; a length byte followed
+    by the frame id and data.
+
+    """
+
+    if extended_frame:
+        frame_id |= CAN_BINARY_EXTENDED_FRAME
+
+    return struct.pack('>BI', 4 + len(data), frame_id) + data
+
+
+def can_frame_unpack(device):
+    """Read one binary can frame from given device. Returns a tuple of
+    the frame id, extended frame flag and data, or None if the
+    connection was closed.
+
+    """
+
+    length = device.read(1)
+
+    if not length:
+        return None
+
+    frame = device.read(length[0])
+
+    if len(frame) != length[0]:
+        return None
+
+    frame_id = struct.unpack('>I', frame[:4])[0]
+    extended_frame = bool(frame_id & CAN_BINARY_EXTENDED_FRAME)
+    frame_id &= ~CAN_BINARY_EXTENDED_FRAME
+
+    return frame_id, extended_frame, frame[4:]
+
+
+def can_frame_to_line(frame_id, extended_frame, data):
+    return 'id={:08x},extended={},size={},data={}'.format(
+        frame_id,
+        int(extended_frame),
+        len(data),
+        binascii.hexlify(data).decode('ascii'))
+
+
+def can_frame_from_line(line):
+    values = dict(item.split('=') for item in line.split(','))
+
+    return (int(values['id'], 16),
+            values.get('extended', '0') == '1',
+            binascii.unhexlify(values.get('data', '')))
+
+
+def reader_can_binary_main(device):
+    """Reads binary can frames from the application and prints them as
+    text lines.
+
+    """
+
+    while True:
+        frame = can_frame_unpack(device)
+
+        if frame is None:
+            print('Connection closed.')
+            break
+
+        timestamp = datetime.datetime.now().strftime("%H:%M:%S.%f")
+        prefix = '{} can({}) RX:'.format(timestamp, device.device_name)
+        print(prefix, can_frame_to_line(*frame))
+
+
+def monitor_can_binary(device_name, address, port):
+    """Monitor given can device using the binary protocol. Frames are
+    entered and printed in the same format as in text mode.
+
+    """
+
+    device = SocketDevice('can_binary', device_name, address, port)
+    device.start()
+    reader = threading.Thread(target=reader_can_binary_main, args=(device, ))
+    reader.setDaemon(True)
+    reader.start()
+
+    while True:
+        line = input('$ ')
+        line = line.strip('\r\n')
+        timestamp = datetime.datetime.now().strftime("%H:%M:%S.%f")
+        prefix = '{} can({}) TX:'.format(timestamp, device_name)
+        print(prefix, line)
+        device.write(can_frame_pack(*can_frame_from_line(line)))
+
+
 def monitor(device_type, device_name, address, port):
     """Monitor given device.
 
@@ -410,7 +508,10 @@ def do_pwm(args):
 
 
 def do_can(args):
-    monitor_line('can', args.device, args.address, args.port)
+    if args.binary:
+        monitor_can_binary(args.device, args.address, args.port)
+    else:
+        monitor_line('can', args.device, args.address, args.port)
 
 
 def do_i2c(args):
@@ -470,6 +571,9 @@ def main():
     pwm_parser.set_defaults(func=do_pwm)
 
     can_parser = subparsers.add_parser('can')
+    can_parser.add_argument('-b', '--binary',
+                            action='store_true',
+                            help='Use the binary protocol.')
     can_parser.add_argument('device', help='Can device to request.')
     can_parser.set_defaults(func=do_can)
 
@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+#
+# Run test suites in parallel, each in its own process group with a
+# timeout, and write the results of all testcases, including their
+# wall times, as JUnit XML and/or JSON.
+#
+
+import os
+import re
+import sys
+import json
+import time
+import signal
+import argparse
+import subprocess
+import threading
+from concurrent.futures import ThreadPoolExecutor
+from xml.etree import ElementTree
+
+
+RE_ENTER = re.compile(r'^enter: (\S+)$')
+RE_EXIT = re.compile(
+    r'^exit: (\S+): (PASSED|FAILED|SKIPPED)(?: \((\d+(?:\.\d+)?) ms\))?')
+RE_END = re.compile(r'TEST END \((PASSED|FAILED)\)')
+
+# Characters not allowed in XML 1.0 documents.
+RE_XML_INVALID = re.compile(
+    '[^\t\n\r\x20-\ud7ff\ue000-\ufffd\U00010000-\U0010ffff]')
+
+
+class Testcase(object):
+
+    def __init__(self, name):
+        self.name = name
+        self.result = None
+        self.time = None
+        self.output = []
+
+    def to_json(self):
+        return {
+            'name': self.name,
+            'result': self.result,
+            'time': self.time
+        }
+
+
+class Suite(object):
+
+    def __init__(self, path):
+        self.path = path
+        self.name = path.strip('/').replace('/', '.')
+        self.result = None
+        self.message = None
+        self.time = 0.0
+        self.testcases = []
+        self.output = ''
+
+    def count(self, result):
+        return len([testcase
+                    for testcase in self.testcases
+                    if testcase.result == result])
+
+    def to_json(self):
+        return {
+            'name': self.name,
+            'path': self.path,
+            'result': self.result,
+            'message': self.message,
+            'time': self.time,
+            'testcases': [testcase.to_json() for testcase in self.testcases]
+        }
+
+
+def parse_output(suite, output):
+    """Parse testcase results and wall times from the output of given
+    suite.
+
+    """
+
+    testcase = None
+    end = None
+
+    for line in output.splitlines():
+        line = line.strip()
+        mo = RE_ENTER.match(line)
+
+        if mo:
+            testcase = Testcase(mo.group(1))
+            suite.testcases.append(testcase)
+            continue
+
+        mo = RE_EXIT.match(line)
+
+        if mo:
+            if testcase is None or testcase.name != mo.group(1):
+                testcase = Testcase(mo.group(1))
+                suite.testcases.append(testcase)
+
+            testcase.result = mo.group(2).lower()
+
+            if mo.group(3) is not None:
+                testcase.time = round(float(mo.group(3)) / 1000, 6)
+
+            testcase = None
+            continue
+
+        mo = RE_END.search(line)
+
+        if mo:
+            end = mo.group(1)
+            continue
+
+        if testcase is not None:
+            testcase.output.append(line)
+
+    return end
+
+
+def run_suite(suite, args):
+    command = [args.make, '-s', '-C', suite.path, 'rerun']
+
+    if args.board:
+        command.append('BOARD=' + args.board)
+
+    start = time.time()
+    process = subprocess.Popen(command,
+                               stdin=subprocess.DEVNULL,
+                               stdout=subprocess.PIPE,
+                               stderr=subprocess.STDOUT,
+                               start_new_session=True)
+
+    try:
+        output, _ = process.communicate(timeout=args.timeout)
+        timed_out = False
+    except subprocess.TimeoutExpired:
+        # Kill the whole process group, not only make.
+        os.killpg(process.pid, signal.SIGKILL)
+        output, _ = process.communicate()
+        timed_out = True
+
+    suite.time = round(time.time() - start, 3)
+    suite.output = output.decode('utf-8', 'replace')
+    end = parse_output(suite, suite.output)
+
+    # A testcase without an exit line was running when the suite
+    # stopped.
+    for testcase in suite.testcases:
+        if testcase.result is None:
+            testcase.result = 'error'
+
+    if timed_out:
+        suite.result = 'timeout'
+        suite.message = 'timed out after {} seconds'.format(args.timeout)
+    elif process.returncode == 0:
+        # The exit code is the number of failed testcases.
+        suite.result = 'passed'
+    elif end is None:
+        suite.result = 'error'
+        suite.message = 'exited with code {} before the end of the test'.format(
+            process.returncode)
+    else:
+        suite.result = 'failed'
+
+    return suite
+
+
+def xml_text(text):
+    return RE_XML_INVALID.sub('', text)
+
+
+def junit_xml(suites):
+    root = ElementTree.Element('testsuites')
+
+    for suite in suites:
+        testsuite = ElementTree.SubElement(root, 'testsuite')
+        testsuite.set('name', suite.name)
+        testsuite.set('tests', str(len(suite.testcases)))
+        testsuite.set('failures', str(suite.count('failed')))
+        testsuite.set('errors', str(suite.count('error')))
+        testsuite.set('skipped', str(suite.count('skipped')))
+        testsuite.set('time', str(suite.time))
+
+        for testcase in suite.testcases:
+            element = ElementTree.SubElement(testsuite, 'testcase')
+            element.set('classname', suite.name)
+            element.set('name', testcase.name)
+
+            if testcase.time is not None:
+                element.set('time', str(testcase.time))
+
+            if testcase.result == 'failed':
+                failure = ElementTree.SubElement(element, 'failure')
+                failure.set('message', 'testcase failed')
+                failure.text = xml_text('\n'.join(testcase.output))
+            elif testcase.result == 'error':
+                error = ElementTree.SubElement(element, 'error')
+                error.set('message', suite.message or 'testcase did not exit')
+                error.text = xml_text('\n'.join(testcase.output))
+            elif testcase.result == 'skipped':
+                ElementTree.SubElement(element, 'skipped')
+
+        # A suite that failed outside of its testcases gets a testcase
+        # of its own, so the failure is not lost.
+        if suite.result != 'passed' and suite.count('failed') == 0 \
+           and suite.count('error') == 0:
+            element = ElementTree.SubElement(testsuite, 'testcase')
+            element.set('classname', suite.name)
+            element.set('name', 'suite')
+            error = ElementTree.SubElement(element, 'error')
+            error.set('message', suite.message or 'suite failed')
+            testsuite.set('tests', str(len(suite.testcases) + 1))
+            testsuite.set('errors', '1')
+
+        if suite.result != 'passed':
+            system_out = ElementTree.SubElement(testsuite, 'system-out')
+            system_out.text = xml_text(suite.output)
+
+    return ElementTree.ElementTree(root)
+
+
+def print_slowest(suites, count):
+    testcases = []
+
+    for suite in suites:
+        for testcase in suite.testcases:
+            if testcase.time is not None:
+                testcases.append((testcase.time, suite.name, testcase.name))
+
+    if not testcases or count == 0:
+        return
+
+    print()
+    print('Slowest testcases:')
+
+    for elapsed, suite_name, testcase_name in sorted(testcases,
+                                                     reverse=True)[:count]:
+        print('  {:8.3f} s  {}.{}'.format(elapsed, suite_name, testcase_name))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Run test suites in parallel and report the results.')
+    parser.add_argument('-j', '--jobs',
+                        type=int,
+                        default=os.cpu_count(),
+                        help='Number of suites to run at the same time '
+                        '(default: %(default)s).')
+    parser.add_argument('-t', '--timeout',
+                        type=float,
+                        default=300,
+                        help='Suite timeout in seconds (default: %(default)s).')
+    parser.add_argument('-b', '--board',
+                        help='Board to run the suites on.')
+    parser.add_argument('--make',
+                        default='make',
+                        help='Make command (default: %(default)s).')
+    parser.add_argument('--junit-xml',
+                        help='JUnit XML report file.')
+    parser.add_argument('--json',
+                        help='JSON report file.')
+    parser.add_argument('--slowest',
+                        type=int,
+                        default=10,
+                        help='Number of slowest testcases to print '
+                        '(default: %(default)s).')
+    parser.add_argument('suites',
+                        nargs='+',
+                        help='Test suite directories.')
+    args = parser.parse_args()
+
+    suites = [Suite(path) for path in args.suites]
+    lock = threading.Lock()
+    start = time.time()
+
+    def run(suite):
+        run_suite(suite, args)
+
+        with lock:
+            print('{:8} {} ({:.1f} s)'.format(suite.result.upper(),
+                                              suite.path,
+                                              suite.time))
+            sys.stdout.flush()
+
+    with ThreadPoolExecutor(max_workers=max(args.jobs, 1)) as executor:
+        list(executor.map(run, suites))
+
+    elapsed = time.time() - start
+    passed = len([suite for suite in suites if suite.result == 'passed'])
+
+    if args.junit_xml:
+        junit_xml(suites).write(args.junit_xml,
+                                encoding='utf-8',
+                                xml_declaration=True)
+
+    if args.json:
+        report = {
+            'time': round(elapsed, 3),
+            'suites': [suite.to_json() for suite in suites]
+        }
+
+        with open(args.json, 'w') as fout:
+            json.dump(report, fout, indent=2)
+
+    print_slowest(suites, args.slowest)
+    print()
+    print('{} of {} suites passed in {:.1f} s.'.format(passed,
+                                                      len(suites),
+                                                      elapsed))
+
+    for suite in suites:
+        if suite.result != 'passed':
+            print('  {}: {}'.format(suite.path, suite.result))
+
+    sys.exit(0 if passed == len(suites) else 1)
+
+
+if __name__ == "__main__":
+    main()
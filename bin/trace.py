@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+#
+# Convert a binary trace dump or stream, as written by the trace
+# module, to the Chrome trace event format. Open the output in
+# chrome://tracing or https://ui.perfetto.dev.
+#
+
+from __future__ import print_function
+
+import sys
+import struct
+import json
+import argparse
+
+
+TRACE_MAGIC = 0x53545243
+
+TRACE_EVENT_THRD_NAME = 0
+TRACE_EVENT_THRD_SWITCH = 1
+TRACE_EVENT_ISR_ENTER = 2
+TRACE_EVENT_ISR_EXIT = 3
+TRACE_EVENT_SEM_TAKE_WAIT = 4
+TRACE_EVENT_SEM_TAKE_DONE = 5
+TRACE_EVENT_MUTEX_LOCK_WAIT = 6
+TRACE_EVENT_MUTEX_LOCK_DONE = 7
+TRACE_EVENT_QUEUE_READ_WAIT = 8
+TRACE_EVENT_QUEUE_READ_DONE = 9
+TRACE_EVENT_QUEUE_WRITE_WAIT = 10
+TRACE_EVENT_QUEUE_WRITE_DONE = 11
+TRACE_EVENT_CAN_INPUT = 12
+TRACE_EVENT_USER = 128
+
+# Wait begin and end events, and their slice names. Waits overlap
+# the running slices of the thread, so they are async events.
+WAIT_EVENTS = {
+    TRACE_EVENT_SEM_TAKE_WAIT: ('b', 'sem_take'),
+    TRACE_EVENT_SEM_TAKE_DONE: ('e', 'sem_take'),
+    TRACE_EVENT_MUTEX_LOCK_WAIT: ('b', 'mutex_lock'),
+    TRACE_EVENT_MUTEX_LOCK_DONE: ('e', 'mutex_lock'),
+    TRACE_EVENT_QUEUE_READ_WAIT: ('b', 'queue_read'),
+    TRACE_EVENT_QUEUE_READ_DONE: ('e', 'queue_read'),
+    TRACE_EVENT_QUEUE_WRITE_WAIT: ('b', 'queue_write'),
+    TRACE_EVENT_QUEUE_WRITE_DONE: ('e', 'queue_write')
+}
+
+HEADER_SIZE = 12
+RECORD_SIZE = 16
+
+# Interrupts are shown on their own track.
+ISR_TID = 0
+
+
+class Record(object):
+
+    def __init__(self, timestamp, event, data, thrd, arg, raw_arg):
+        self.timestamp = timestamp
+        self.event = event
+        self.data = data
+        self.thrd = thrd
+        self.arg = arg
+        self.raw_arg = raw_arg
+
+
+def read_records(data):
+    """Returns a list of all records in given dump or stream.
+
+    """
+
+    if len(data) < HEADER_SIZE:
+        sys.exit('error: too short trace')
+
+    for endianness in '<>':
+        if struct.unpack(endianness + 'I', data[0:4])[0] == TRACE_MAGIC:
+            break
+    else:
+        sys.exit('error: bad trace magic')
+
+    _, record_size, number_of_records = struct.unpack(endianness + 'HHI',
+                                                      data[4:HEADER_SIZE])
+
+    if record_size < RECORD_SIZE:
+        sys.exit('error: bad record size {}'.format(record_size))
+
+    # A stream has no record count and lasts until end of file.
+    if number_of_records == 0:
+        number_of_records = (len(data) - HEADER_SIZE) // record_size
+
+    records = []
+    offset = HEADER_SIZE
+
+    for _ in range(number_of_records):
+        raw = data[offset:offset + RECORD_SIZE]
+
+        if len(raw) < RECORD_SIZE:
+            print('warning: truncated trace', file=sys.stderr)
+            break
+
+        timestamp, event, data_, thrd, arg = struct.unpack(
+            endianness + 'IHHII',
+            raw)
+        records.append(Record(timestamp, event, data_, thrd, arg, raw[12:16]))
+        offset += record_size
+
+    return records
+
+
+def unwrap_timestamps(records):
+    """Make the 32 bits microsecond timestamps monotonic, relative to the
+    first record.
+
+    """
+
+    previous = None
+    offset = 0
+
+    for record in records:
+        if record.event == TRACE_EVENT_THRD_NAME:
+            continue
+
+        if previous is not None and record.timestamp < previous:
+            if previous - record.timestamp > 0x80000000:
+                offset += 0x100000000
+
+        previous = record.timestamp
+        record.timestamp += offset
+
+    timestamps = [record.timestamp
+                  for record in records
+                  if record.event != TRACE_EVENT_THRD_NAME]
+
+    if timestamps:
+        start = min(timestamps)
+
+        for record in records:
+            if record.event != TRACE_EVENT_THRD_NAME:
+                record.timestamp -= start
+
+
+def thread_names(records):
+    chunks = {}
+
+    for record in records:
+        if record.event == TRACE_EVENT_THRD_NAME:
+            chunks.setdefault(record.thrd, {})[record.data] = record.raw_arg
+
+    names = {}
+
+    for thrd, offsets in chunks.items():
+        name = b''.join([offsets[offset] for offset in sorted(offsets)])
+        names[thrd] = name.rstrip(b'\x00').decode('ascii', 'replace')
+
+    return names
+
+
+def event(ph, name, timestamp, tid, args=None):
+    value = {
+        'ph': ph,
+        'name': name,
+        'ts': timestamp,
+        'pid': 0,
+        'tid': tid
+    }
+
+    if ph == 'i':
+        value['s'] = 't'
+    elif ph in 'be':
+        value['cat'] = 'wait'
+        value['id'] = tid
+
+    if args is not None:
+        value['args'] = args
+
+    return value
+
+
+def convert(records):
+    """Returns a Chrome trace object of given records.
+
+    """
+
+    unwrap_timestamps(records)
+    names = thread_names(records)
+    events = []
+    running = set()
+    timestamp = 0
+
+    for record in records:
+        if record.event == TRACE_EVENT_THRD_NAME:
+            continue
+
+        timestamp = record.timestamp
+
+        if record.event == TRACE_EVENT_THRD_SWITCH:
+            if record.thrd in running:
+                events.append(event('E', 'running', timestamp, record.thrd))
+                running.remove(record.thrd)
+
+            events.append(event('B', 'running', timestamp, record.arg))
+            running.add(record.arg)
+        elif record.event in [TRACE_EVENT_ISR_ENTER, TRACE_EVENT_ISR_EXIT]:
+            if record.event == TRACE_EVENT_ISR_ENTER:
+                ph = 'B'
+            else:
+                ph = 'E'
+
+            events.append(event(ph,
+                                'isr 0x{:08x}'.format(record.arg),
+                                timestamp,
+                                ISR_TID))
+        elif record.event in WAIT_EVENTS:
+            ph, name = WAIT_EVENTS[record.event]
+            args = {'object': '0x{:08x}'.format(record.arg)}
+
+            if ph == 'e':
+                args['error'] = -record.data
+
+            events.append(event(ph, name, timestamp, record.thrd, args))
+        elif record.event == TRACE_EVENT_CAN_INPUT:
+            events.append(event('i',
+                                'can_input',
+                                timestamp,
+                                record.thrd,
+                                {
+                                    'driver': '0x{:08x}'.format(record.arg),
+                                    'frames': record.data
+                                }))
+        elif record.event >= TRACE_EVENT_USER:
+            events.append(event('i',
+                                'user+{}'.format(record.event
+                                                 - TRACE_EVENT_USER),
+                                timestamp,
+                                record.thrd,
+                                {
+                                    'data': record.data,
+                                    'arg': '0x{:08x}'.format(record.arg)
+                                }))
+        else:
+            print('warning: unknown event {}'.format(record.event),
+                  file=sys.stderr)
+
+    # Close slices of threads still running at the end of the trace.
+    for thrd in running:
+        events.append(event('E', 'running', timestamp, thrd))
+
+    tids = set([e['tid'] for e in events]) | set(names)
+
+    for tid in sorted(tids):
+        if tid == ISR_TID:
+            name = 'interrupts'
+        else:
+            name = names.get(tid, '0x{:08x}'.format(tid))
+
+        events.append({
+            'ph': 'M',
+            'name': 'thread_name',
+            'pid': 0,
+            'tid': tid,
+            'args': {'name': name}
+        })
+
+    return {
+        'traceEvents': events,
+        'displayTimeUnit': 'ns'
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Convert a trace dump to Chrome trace JSON.')
+    parser.add_argument('-o', '--output',
+                        help='Output file (default: standard output).')
+    parser.add_argument('infile', help='Binary trace dump or stream.')
+    args = parser.parse_args()
+
+    with open(args.infile, 'rb') as fin:
+        records = read_records(fin.read())
+
+    trace = convert(records)
+
+    if args.output:
+        with open(args.output, 'w') as fout:
+            json.dump(trace, fout, indent=1)
+    else:
+        json.dump(trace, sys.stdout, indent=1)
+        print()
+
+
+if __name__ == "__main__":
+    main()
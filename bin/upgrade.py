@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 #
-# Append the upgrade binary header to given binary file.
+# Append the upgrade binary header to given binary file, or create a
+# delta of given binary file against the installed binary file.
 #
 
 import argparse
@@ -9,6 +10,14 @@ import struct
 import zlib
 
 
+# Minimum number of bytes in a copy command. Shorter matches are
+# inserted instead.
+DELTA_BLOCK_SIZE = 16
+
+DELTA_COMMAND_COPY = 0
+DELTA_COMMAND_INSERT = 1
+
+
 def create_header(binary, description):
     """Create the upgrade binary header for given binary data.
 
@@ -23,37 +32,152 @@ def create_header(binary, description):
 
     """
 
-    description += '\0'
+    return create_header_version(1, binary, b'', description)
+
+
+def create_delta_header(binary, source, description):
+    """Create the upgrade binary header for a delta of given binary
+    against given source binary.
+
+   SIZE       TYPE  DESCRIPTION
+      4   uint32_t  header version (2)
+      4   uint32_t  header size in bytes
+      4   uint32_t  binary size in bytes
+     20  uint8_t[]  SHA1 of the binary
+      4   uint32_t  source binary size in bytes
+     20  uint8_t[]  SHA1 of the source binary
+     1+   c-string  data description
+      4   uint32_t  CRC32 of the header (not including this field)
+     0+  uint8_t[]  delta
+
+    """
+
+    fields = struct.pack('>I', len(source))
+    fields += hashlib.sha1(source).digest()
+
+    return create_header_version(2, binary, fields, description)
+
+
+def create_header_version(version, binary, fields, description):
+    description = description.encode('utf-8') + b'\0'
 
     if len(description) % 4 != 0:
-        description += (4 - (len(description) % 4)) * '\0'
+        description += (4 - (len(description) % 4)) * b'\0'
 
     header = struct.pack('>III',
-                         1,
-                         36 + len(description),
+                         version,
+                         36 + len(fields) + len(description),
                          len(binary))
     header += hashlib.sha1(binary).digest()
+    header += fields
     header += description
     header += struct.pack('>I', zlib.crc32(header) & 0xffffffff)
 
     return header
 
+
+def pack_varint(value):
+    encoded = bytearray()
+
+    while value > 0x7f:
+        encoded.append(0x80 | (value & 0x7f))
+        value >>= 7
+
+    encoded.append(value)
+
+    return bytes(encoded)
+
+
+def create_delta(binary, source):
+    """Create a delta that creates given binary from given source
+    binary. It is a sequence of copy and insert commands, both encoded
+    as a variable length integer with the size in the upper bits and
+    the command type in the least significant bit. A copy command is
+    followed by a zigzag encoded variable length integer, the source
+    offset relative to the end of the previous copy, and an insert
+    command by the data to insert.
+
+    """
+
+    # Offsets of all blocks in the source, first occurrence only.
+    blocks = {}
+
+    for offset in range(len(source) - DELTA_BLOCK_SIZE + 1):
+        blocks.setdefault(source[offset:offset + DELTA_BLOCK_SIZE], offset)
+
+    delta = bytearray()
+    source_offset = 0
+    insert_begin = 0
+    offset = 0
+
+    def insert(end):
+        if end > insert_begin:
+            delta.extend(pack_varint(((end - insert_begin) << 1)
+                                     | DELTA_COMMAND_INSERT))
+            delta.extend(binary[insert_begin:end])
+
+    while offset <= len(binary) - DELTA_BLOCK_SIZE:
+        block = binary[offset:offset + DELTA_BLOCK_SIZE]
+
+        # Prefer continuing where the previous copy ended.
+        if source[source_offset:source_offset + DELTA_BLOCK_SIZE] == block:
+            match = source_offset
+        else:
+            match = blocks.get(block)
+
+        if match is None:
+            offset += 1
+            continue
+
+        size = DELTA_BLOCK_SIZE
+
+        while (offset + size < len(binary)
+               and match + size < len(source)
+               and binary[offset + size] == source[match + size]):
+            size += 1
+
+        insert(offset)
+        relative = match - source_offset
+        delta.extend(pack_varint((size << 1) | DELTA_COMMAND_COPY))
+        delta.extend(pack_varint((relative << 1) ^ (relative >> 63)))
+        source_offset = match + size
+        offset += size
+        insert_begin = offset
+
+    insert(len(binary))
+
+    return bytes(delta)
+
+
 def main():
     parser = argparse.ArgumentParser()
     parser.add_argument('-o', '--output')
     parser.add_argument('-d', '--description', default="")
+    parser.add_argument('--delta',
+                        help=('Create a delta against this binary, the '
+                              'installed application.'))
     parser.add_argument('binary')
     args = parser.parse_args()
 
-    with open(args.binary) as fin:
+    with open(args.binary, 'rb') as fin:
         binary = fin.read()
 
-    header = create_header(binary, args.description)
+    if args.delta:
+        with open(args.delta, 'rb') as fin:
+            source = fin.read()
+
+        header = create_delta_header(binary, source, args.description)
+        data = create_delta(binary, source)
+        print('Delta size is {} bytes, binary size is {} bytes.'.format(
+            len(data),
+            len(binary)))
+    else:
+        header = create_header(binary, args.description)
+        data = binary
 
     with open(args.output, 'wb') as fout:
         fout.write(header)
-        fout.write(binary)
-
+        fout.write(data)
 
 
 if __name__ == "__main__":
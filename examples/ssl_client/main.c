@@ -107,11 +107,11 @@ int main()
     std_printf(FSTR("Connected.\r\n"));
 
     /* Wrap the socket in SSL. */
-    if (ssl_socket_open(&ssl_sock,
-                        &context,
-                        &sock,
-                        0,
-                        "foobar.org") == 0) {
+    if (ssl_socket_open_client(&ssl_sock,
+                               &context,
+                               &sock,
+                               "foobar.org",
+                               SERVER_PORT) == 0) {
         /* Print connection information. */
         std_printf(FSTR("Server hostname: %s\r\n"), ssl_socket_get_server_hostname(&ssl_sock));
         ssl_socket_get_cipher(&ssl_sock,
@@ -145,7 +145,7 @@ int main()
             std_printf(FSTR("ssl_socket_close() failed\r\n"));
         }
     } else {
-        std_printf(FSTR("ssl_socket_open() failed\r\n"));
+        std_printf(FSTR("ssl_socket_open_client() failed\r\n"));
     }
 
     socket_close(&sock);
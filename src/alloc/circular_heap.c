@@ -26,8 +26,16 @@
  * This file is part of the Simba project.
  */
 
+
 #include "simba.h"
 
+#if CONFIG_CIRCULAR_HEAP_SPSC == 1 && defined(ARCH_AVR)
+#    error "Lock-free circular heaps require atomic pointer access."
+#endif
+
+/* Set in the size of a freed buffer. Sizes are multiples of four. */
+#define HEADER_RELEASED                                  0x1
+
 struct header_t {
 #if CONFIG_ALIGNMENT != 8
     size_t size;
@@ -36,6 +44,39 @@ struct header_t {
 #endif
 };
 
+/**
+ * Read a pointer written by the other side of a lock-free circular
+ * heap. Memory written before the pointer was stored is visible after
+ * the load.
+ */
+static void *load_acquire(void **pointer_pp)
+{
+#if CONFIG_CIRCULAR_HEAP_SPSC == 1
+    void *pointer_p;
+
+    pointer_p = *(void * volatile *)pointer_pp;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    return (pointer_p);
+#else
+    return (*pointer_pp);
+#endif
+}
+
+/**
+ * Write a pointer read by the other side of a lock-free circular
+ * heap.
+ */
+static void store_release(void **pointer_pp, void *pointer_p)
+{
+#if CONFIG_CIRCULAR_HEAP_SPSC == 1
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    *(void * volatile *)pointer_pp = pointer_p;
+#else
+    *pointer_pp = pointer_p;
+#endif
+}
+
 int circular_heap_init(struct circular_heap_t *self_p,
                        void *buf_p,
                        size_t size)
@@ -48,6 +89,7 @@ int circular_heap_init(struct circular_heap_t *self_p,
     self_p->end_p = (buf_p + size);
     self_p->alloc_p = buf_p;
     self_p->free_p = buf_p;
+    self_p->wrap_p = self_p->end_p;
 
     return (0);
 }
@@ -59,6 +101,8 @@ void *circular_heap_alloc(struct circular_heap_t *self_p,
     ASSERTNRN(size > 0, EINVAL);
 
     struct header_t *header_p;
+    void *alloc_p;
+    void *free_p;
 
     header_p = NULL;
     size += sizeof(*header_p);
@@ -72,26 +116,31 @@ void *circular_heap_alloc(struct circular_heap_t *self_p,
     size &= 0xffffffc;
 #endif
 
+    alloc_p = self_p->alloc_p;
+    free_p = load_acquire(&self_p->free_p);
+
     /* Does it fit before end_p or free_p? */
-    if (self_p->alloc_p >= self_p->free_p)  {
+    if (alloc_p >= free_p)  {
         /* begin_p <-> free_p <-> alloc_p <-> end_p */
-        if ((self_p->end_p - self_p->alloc_p) > size)  {
-            header_p = self_p->alloc_p;
-            self_p->alloc_p += size;
-        } else if ((self_p->free_p - self_p->begin_p) > size) {
+        if ((self_p->end_p - alloc_p) > size)  {
+            header_p = alloc_p;
+            alloc_p += size;
+        } else if ((free_p - self_p->begin_p) > size) {
             header_p = self_p->begin_p;
-            self_p->alloc_p = (self_p->begin_p + size);
+            self_p->wrap_p = alloc_p;
+            alloc_p = (self_p->begin_p + size);
         }
     } else {
         /* begin_p <-> alloc_p <-> free_p <-> end_p */
-        if ((self_p->free_p - self_p->alloc_p) > size)  {
-            header_p = self_p->alloc_p;
-            self_p->alloc_p += size;
+        if ((free_p - alloc_p) > size)  {
+            header_p = alloc_p;
+            alloc_p += size;
         }
     }
 
     if (header_p != NULL) {
         header_p->size = size;
+        store_release(&self_p->alloc_p, alloc_p);
 
         return (&header_p[1]);
     } else {
@@ -108,18 +157,47 @@ int circular_heap_free(struct circular_heap_t *self_p,
     ASSERTN(buf_p < self_p->end_p, EINVAL);
 
     struct header_t *header_p;
+    void *alloc_p;
+    void *free_p;
 
     header_p = buf_p;
     header_p--;
 
-    ASSERTN((header_p == self_p->free_p)
-            || (header_p == self_p->begin_p), EINVAL);
+    if (header_p->size & HEADER_RELEASED) {
+        return (-EINVAL);
+    }
+
+    header_p->size |= HEADER_RELEASED;
+
+    /* Advance free_p over the oldest buffers as long as they are
+       released. Each buffer is passed once, so freeing is O(1)
+       amortized. */
+    free_p = self_p->free_p;
+
+    while (1) {
+        alloc_p = load_acquire(&self_p->alloc_p);
+
+        if (free_p == alloc_p) {
+            break;
+        }
+
+        /* Continue at the beginning if alloc_p has wrapped and all
+           buffers before the wrap are released. */
+        if ((alloc_p < free_p) && (free_p == self_p->wrap_p)) {
+            free_p = self_p->begin_p;
+            continue;
+        }
+
+        header_p = free_p;
+
+        if ((header_p->size & HEADER_RELEASED) == 0) {
+            break;
+        }
 
-    if (header_p == self_p->begin_p) {
-        self_p->free_p = self_p->begin_p;
+        free_p += (header_p->size & ~HEADER_RELEASED);
     }
 
-    self_p->free_p += header_p->size;
+    store_release(&self_p->free_p, free_p);
 
     return (0);
 }
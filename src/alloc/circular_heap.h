@@ -37,11 +37,19 @@ struct circular_heap_t {
     void *end_p;
     void *alloc_p;
     void *free_p;
+    /* End of the buffers allocated before alloc_p wrapped around to
+       begin_p. */
+    void *wrap_p;
 };
 
 /**
- * Initialize given circular heap. Buffers must be freed in the same
- * order as they were allocated.
+ * Initialize given circular heap. Buffers are allocated in FIFO order
+ * and may be freed in any order, but memory is only reused once the
+ * oldest allocated buffer has been freed.
+ *
+ * If ``CONFIG_CIRCULAR_HEAP_SPSC`` is enabled, one thread or
+ * interrupt may allocate buffers while another frees them, without
+ * any locking.
  *
  * @param[in] self_p Circular heap to initialize.
  * @param[in] buf_p Memory buffer to use for the circular heap.
@@ -66,12 +74,13 @@ void *circular_heap_alloc(struct circular_heap_t *self_p,
                           size_t size);
 
 /**
- * Free the oldest allocated buffer, previously allocated with
- * ``circular_heap_alloc()``.
+ * Free given buffer, previously allocated with
+ * ``circular_heap_alloc()``. The buffer is marked as released, and
+ * the memory of the oldest allocated buffers is made available for
+ * allocation once they are all released.
  *
  * @param[in] self_p Circular heap to free to.
- * @param[in] buf_p Buffer to free. Must be the oldest allocated
- *                  buffer.
+ * @param[in] buf_p Buffer to free.
  *
  * @return zero(0) or negative error code.
  */
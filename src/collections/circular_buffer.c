@@ -30,16 +30,15 @@
 
 static ssize_t find(const char *buf_p, ssize_t pos, ssize_t size, char value)
 {
-    while (pos < size) {
-        if (*buf_p == value) {
-            return (pos);
-        }
+    size_t offset;
 
-        pos++;
-        buf_p++;
+    offset = std_memcspn(buf_p, size - pos, &value, 1);
+
+    if (offset == (size_t)(size - pos)) {
+        return (-1);
     }
 
-    return (-1);
+    return (pos + offset);
 }
 
 int circular_buffer_init(struct circular_buffer_t *self_p,
@@ -242,6 +241,8 @@ ssize_t circular_buffer_find(struct circular_buffer_t *self_p,
     ssize_t size_two;
     char *buf_p;
 
+    buf_p = NULL;
+
     /* Find before wrap. */
     size_one = circular_buffer_array_one(self_p,
                                          (void **)&buf_p,
@@ -379,6 +379,53 @@
 #    define CONFIG_CAN_FRAME_TIMESTAMP                      1
 #endif
 
+/**
+ * Enable the CAN software acceptance filters, used by the can and
+ * mcp2515 drivers to dispatch received frames to subscribers.
+ */
+#ifndef CONFIG_CAN_FILTER
+#    if defined(CONFIG_MINIMAL_SYSTEM) || (!defined(PORT_HAS_CAN) && !defined(PORT_HAS_MCP2515))
+#        define CONFIG_CAN_FILTER                           0
+#    else
+#        define CONFIG_CAN_FILTER                           1
+#    endif
+#endif
+
+/**
+ * Number of buckets in the exact id filter hash table. Must be a
+ * power of two.
+ */
+#ifndef CONFIG_CAN_FILTER_EXACT_TABLE_SIZE
+#    define CONFIG_CAN_FILTER_EXACT_TABLE_SIZE              16
+#endif
+
+/**
+ * Enable the ISO-TP transport on top of the can driver.
+ */
+#ifndef CONFIG_ISOTP_CHANNEL
+#    if defined(CONFIG_MINIMAL_SYSTEM) || !defined(PORT_HAS_CAN)
+#        define CONFIG_ISOTP_CHANNEL                        0
+#    else
+#        define CONFIG_ISOTP_CHANNEL                        1
+#    endif
+#endif
+
+/**
+ * ISO-TP channel timeout in milliseconds waiting for a flow control
+ * or consecutive frame from the peer.
+ */
+#ifndef CONFIG_ISOTP_CHANNEL_TIMEOUT_MS
+#    define CONFIG_ISOTP_CHANNEL_TIMEOUT_MS               1000
+#endif
+
+/**
+ * Maximum number of consecutive flow control wait frames accepted
+ * from the peer before an ISO-TP channel transmission is aborted.
+ */
+#ifndef CONFIG_ISOTP_CHANNEL_WAIT_FRAMES_MAX
+#    define CONFIG_ISOTP_CHANNEL_WAIT_FRAMES_MAX            16
+#endif
+
 /**
  * Enable the chipid driver.
  */
@@ -931,6 +978,36 @@
 #    endif
 #endif
 
+/**
+ * Compile the trace points in the kernel, sync and driver hot
+ * paths. Each trace point writes a fixed size record to the trace
+ * buffer when tracing is started.
+ */
+#ifndef CONFIG_TRACE
+#    define CONFIG_TRACE                                    0
+#endif
+
+/**
+ * Number of records in the trace buffer. Must be a power of two. The
+ * oldest record is overwritten when the buffer is full.
+ */
+#ifndef CONFIG_TRACE_BUFFER_SIZE
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO)
+#        define CONFIG_TRACE_BUFFER_SIZE                   32
+#    else
+#        define CONFIG_TRACE_BUFFER_SIZE                  256
+#    endif
+#endif
+
+/**
+ * Keep contention statistics in the synchronization primitives;
+ * number of acquisitions, how many of them had to wait, for how long
+ * and how many threads were waiting.
+ */
+#ifndef CONFIG_CONTENTION
+#    define CONFIG_CONTENTION                               0
+#endif
+
 /**
  * Initialize the module at system startup.
  */
@@ -1004,6 +1081,28 @@
 #    endif
 #endif
 
+/**
+ * Initialize the trace module at system startup.
+ */
+#ifndef CONFIG_MODULE_INIT_TRACE
+#    if CONFIG_TRACE == 1
+#        define CONFIG_MODULE_INIT_TRACE                    1
+#    else
+#        define CONFIG_MODULE_INIT_TRACE                    0
+#    endif
+#endif
+
+/**
+ * Initialize the contention module at system startup.
+ */
+#ifndef CONFIG_MODULE_INIT_CONTENTION
+#    if CONFIG_CONTENTION == 1
+#        define CONFIG_MODULE_INIT_CONTENTION               1
+#    else
+#        define CONFIG_MODULE_INIT_CONTENTION               0
+#    endif
+#endif
+
 /**
  * Initialize the chan module at system startup.
  */
@@ -1510,6 +1609,30 @@
 #    endif
 #endif
 
+/**
+ * Debug file system commands to start, stop, print and dump the
+ * trace.
+ */
+#ifndef CONFIG_TRACE_FS_COMMANDS
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO) || defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_TRACE_FS_COMMANDS                    0
+#    else
+#        define CONFIG_TRACE_FS_COMMANDS                    1
+#    endif
+#endif
+
+/**
+ * Debug file system commands to list and reset the contention
+ * statistics of registered synchronization objects.
+ */
+#ifndef CONFIG_CONTENTION_FS_COMMANDS
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO) || defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_CONTENTION_FS_COMMANDS               0
+#    else
+#        define CONFIG_CONTENTION_FS_COMMANDS               1
+#    endif
+#endif
+
 /**
  * Debug file system command to list all network interfaces.
  */
@@ -1660,6 +1783,60 @@
 #    define CONFIG_UPGRADE_FS_COMMAND_BOOTLOADER_ENTER      1
 #endif
 
+/**
+ * Debug file system command to print the binary upload progress.
+ */
+#ifndef CONFIG_UPGRADE_FS_COMMAND_BINARY_UPLOAD_PROGRESS
+#    define CONFIG_UPGRADE_FS_COMMAND_BINARY_UPLOAD_PROGRESS 1
+#endif
+
+/**
+ * Support for uploading a delta against the installed application
+ * instead of the whole application. The port must be able to read
+ * the installed application during the upload.
+ */
+#ifndef CONFIG_UPGRADE_DELTA
+#    if defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_UPGRADE_DELTA                        0
+#    else
+#        define CONFIG_UPGRADE_DELTA                        1
+#    endif
+#endif
+
+/**
+ * Write uploaded binaries to the application area from a separate
+ * thread, using two buffers. One buffer is filled with received data
+ * while the other is written, so receiving and flash writes overlap.
+ */
+#ifndef CONFIG_UPGRADE_PIPELINE
+#    if defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_UPGRADE_PIPELINE                     0
+#    elif defined(ARCH_ESP32) || defined(ARCH_LINUX)
+#        define CONFIG_UPGRADE_PIPELINE                     1
+#    else
+#        define CONFIG_UPGRADE_PIPELINE                     0
+#    endif
+#endif
+
+/**
+ * Size of each of the two upgrade pipeline buffers. Preferably a
+ * multiple of the flash sector size.
+ */
+#ifndef CONFIG_UPGRADE_PIPELINE_BUFFER_SIZE
+#    define CONFIG_UPGRADE_PIPELINE_BUFFER_SIZE           4096
+#endif
+
+/**
+ * Stack size of the upgrade pipeline writer thread.
+ */
+#ifndef CONFIG_UPGRADE_PIPELINE_STACK_SIZE
+#    if defined(ARCH_ESP32)
+#        define CONFIG_UPGRADE_PIPELINE_STACK_SIZE          2048
+#    else
+#        define CONFIG_UPGRADE_PIPELINE_STACK_SIZE          1024
+#    endif
+#endif
+
 /**
  * The maximum length of an absolute path in the file system.
  */
@@ -1674,6 +1851,19 @@
 #    define CONFIG_FS_COMMAND_ARGS_MAX                     16
 #endif
 
+/**
+ * Number of buckets in the file system command hash table, used by
+ * `fs_call()` to find commands, counters and parameters. Must be a
+ * power of two.
+ */
+#ifndef CONFIG_FS_COMMAND_HASH_TABLE_SIZE
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO) || defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_FS_COMMAND_HASH_TABLE_SIZE            8
+#    else
+#        define CONFIG_FS_COMMAND_HASH_TABLE_SIZE           64
+#    endif
+#endif
+
 /**
  * Debug file system command to append to a file.
  */
@@ -2264,6 +2454,19 @@
 #    define CONFIG_STD_OUTPUT_BUFFER_MAX                   16
 #endif
 
+/**
+ * Scan buffers one machine word at a time in `std_memspn()` and
+ * `std_memcspn()`, and 16 bytes at a time if SSE2 is available. Byte
+ * by byte is faster on 8-bit CPUs.
+ */
+#ifndef CONFIG_STD_WORD_SCAN
+#    if defined(FAMILY_AVR)
+#        define CONFIG_STD_WORD_SCAN                        0
+#    else
+#        define CONFIG_STD_WORD_SCAN                        1
+#    endif
+#endif
+
 /**
  * Use floating point numbers instead of intergers where applicable.
  */
@@ -2286,6 +2489,16 @@
 #    endif
 #endif
 
+/**
+ * Lock-free single-producer/single-consumer circular heaps. One
+ * thread or interrupt may allocate from a circular heap while another
+ * frees to it, without taking the system lock. Requires pointer sized
+ * loads and stores to be atomic.
+ */
+#ifndef CONFIG_CIRCULAR_HEAP_SPSC
+#    define CONFIG_CIRCULAR_HEAP_SPSC                       0
+#endif
+
 /**
  * System tick frequency in Hertz.
  */
@@ -2416,6 +2629,43 @@
 #    endif
 #endif
 
+/**
+ * Measure the time from a thread is woken until it is running, and
+ * keep a histogram of it per thread. Only supported on Linux.
+ */
+#ifndef CONFIG_THRD_WAKE_LATENCY
+#    if defined(ARCH_LINUX) && !defined(CONFIG_MINIMAL_SYSTEM)
+#        define CONFIG_THRD_WAKE_LATENCY                    1
+#    else
+#        define CONFIG_THRD_WAKE_LATENCY                    0
+#    endif
+#endif
+
+/**
+ * Let the owner of a mutex inherit the priority of the threads
+ * waiting for it, to bound priority inversion.
+ */
+#ifndef CONFIG_MUTEX_PRIORITY_INHERITANCE
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO)
+#        define CONFIG_MUTEX_PRIORITY_INHERITANCE           0
+#    else
+#        define CONFIG_MUTEX_PRIORITY_INHERITANCE           1
+#    endif
+#endif
+
+/**
+ * Fail with -EDEADLK instead of waiting forever for a mutex in a
+ * deadlock cycle, and with -EPERM when unlocking a mutex owned by
+ * another thread.
+ */
+#ifndef CONFIG_MUTEX_DEADLOCK_DETECTION
+#    if CONFIG_DEBUG == 1
+#        define CONFIG_MUTEX_DEADLOCK_DETECTION             1
+#    else
+#        define CONFIG_MUTEX_DEADLOCK_DETECTION             0
+#    endif
+#endif
+
 /**
  * USB device vendor id.
  */
@@ -2477,6 +2727,56 @@
 #    endif
 #endif
 
+/**
+ * Maximum number of SSL contexts.
+ */
+#ifndef CONFIG_SSL_CONTEXTS_MAX
+#    define CONFIG_SSL_CONTEXTS_MAX                         1
+#endif
+
+/**
+ * Maximum number of open SSL sockets.
+ */
+#ifndef CONFIG_SSL_SOCKETS_MAX
+#    define CONFIG_SSL_SOCKETS_MAX                          1
+#endif
+
+/**
+ * Number of client side SSL sessions to cache for session
+ * resumption, one per server hostname. Zero(0) to disable the cache.
+ */
+#ifndef CONFIG_SSL_SESSION_CACHE_SIZE
+#    define CONFIG_SSL_SESSION_CACHE_SIZE                   2
+#endif
+
+/**
+ * Issue session tickets on server side SSL sockets, letting clients
+ * resume sessions without any per client state on the server.
+ */
+#ifndef CONFIG_SSL_SESSION_TICKETS
+#    define CONFIG_SSL_SESSION_TICKETS                      1
+#endif
+
+/**
+ * Session ticket lifetime in seconds.
+ */
+#ifndef CONFIG_SSL_SESSION_TICKET_LIFETIME
+#    define CONFIG_SSL_SESSION_TICKET_LIFETIME              86400
+#endif
+
+/**
+ * Size of the SSL socket input buffer. Records are read into this
+ * buffer with a single socket read when enough data is
+ * available. Zero(0) to read directly from the socket.
+ */
+#ifndef CONFIG_SSL_INPUT_BUFFER_SIZE
+#    if defined(ARCH_LINUX) || defined(ARCH_ESP32)
+#        define CONFIG_SSL_INPUT_BUFFER_SIZE                1024
+#    else
+#        define CONFIG_SSL_INPUT_BUFFER_SIZE                256
+#    endif
+#endif
+
 /**
  * Sleep in the test harness before executing the first testcase.
  */
@@ -2529,6 +2829,20 @@
 #    endif
 #endif
 
+/**
+ * Number of hash buckets in the mock id index, required for
+ * harness_mock_() functions.
+ */
+#ifndef CONFIG_HARNESS_MOCK_ID_BUCKETS
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO)
+#        define CONFIG_HARNESS_MOCK_ID_BUCKETS              1
+#    elif defined(ARCH_LINUX) || defined(ARCH_ARM64)
+#        define CONFIG_HARNESS_MOCK_ID_BUCKETS            256
+#    else
+#        define CONFIG_HARNESS_MOCK_ID_BUCKETS             16
+#    endif
+#endif
+
 /**
  * Call sys_exit() immediately on test failure to stop the test suite
  * execution as early as possible.
@@ -2544,6 +2858,36 @@
 #    define CONFIG_HARNESS_DEBUG                            0
 #endif
 
+/**
+ * Number of measured samples per benchmark in the bench module.
+ */
+#ifndef CONFIG_BENCH_SAMPLES
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO)
+#        define CONFIG_BENCH_SAMPLES                        8
+#    elif defined(ARCH_LINUX) || defined(ARCH_ARM64)
+#        define CONFIG_BENCH_SAMPLES                       32
+#    else
+#        define CONFIG_BENCH_SAMPLES                       16
+#    endif
+#endif
+
+/**
+ * Number of discarded samples run after calibration and before the
+ * measured samples of a benchmark, to warm up caches and branch
+ * predictors.
+ */
+#ifndef CONFIG_BENCH_WARMUP_SAMPLES
+#    define CONFIG_BENCH_WARMUP_SAMPLES                     2
+#endif
+
+/**
+ * Minimum time of one benchmark sample in microseconds. Ports
+ * without a high resolution timer use a longer time.
+ */
+#ifndef CONFIG_BENCH_SAMPLE_TIME_US
+#    define CONFIG_BENCH_SAMPLE_TIME_US                  5000
+#endif
+
 /**
  * Size of the HTTP server request buffer. This buffer is used when
  * parsing received HTTP request headers.
@@ -2560,6 +2904,52 @@
 #    define CONFIG_CRC_TABLE_LOOKUP                         1
 #endif
 
+/**
+ * Number of bytes processed per iteration in table lookup CRC
+ * calculations; 1, 4 or 8. Slicing-by-4 and slicing-by-8 are faster,
+ * but need 3 and 7 additional tables of 256 entries each.
+ */
+#ifndef CONFIG_CRC_TABLE_SLICES
+#    if defined(FAMILY_LINUX)
+#        define CONFIG_CRC_TABLE_SLICES                     8
+#    else
+#        define CONFIG_CRC_TABLE_SLICES                     1
+#    endif
+#endif
+
+/**
+ * Use CRC hardware instructions when available. That is the ARMv8
+ * CRC32 instructions if enabled in the compiler, and carry-less
+ * multiplication (PCLMULQDQ) on x86 CPUs supporting it.
+ */
+#ifndef CONFIG_CRC_HARDWARE
+#    define CONFIG_CRC_HARDWARE                             1
+#endif
+
+/**
+ * Use the SHA instructions of x86 CPUs supporting them in the SHA-1
+ * and SHA-256 calculations.
+ */
+#ifndef CONFIG_SHA_HARDWARE
+#    define CONFIG_SHA_HARDWARE                             1
+#endif
+
+/**
+ * Maximum nesting depth of objects and arrays in the streaming JSON
+ * reader.
+ */
+#ifndef CONFIG_JSON_READER_DEPTH_MAX
+#    define CONFIG_JSON_READER_DEPTH_MAX                    8
+#endif
+
+/**
+ * Size of the path buffer in the streaming JSON reader, including
+ * null termination.
+ */
+#ifndef CONFIG_JSON_READER_PATH_MAX
+#    define CONFIG_JSON_READER_PATH_MAX                    64
+#endif
+
 /**
  */
 #ifndef CONFIG_SPC5_BOOT_ENTRY_RCHW
@@ -2598,6 +2988,13 @@
 #    define CONFIG_SOAM_EMBEDDED_DATABASE                   0
 #endif
 
+/**
+ * Maximum number of commands in a SOAM command batch request.
+ */
+#ifndef CONFIG_SOAM_COMMAND_BATCH_MAX
+#    define CONFIG_SOAM_COMMAND_BATCH_MAX                  16
+#endif
+
 /**
  * System module log mask.
  */
@@ -0,0 +1,428 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#include "bench_port.i"
+
+#if !defined(BENCH_PORT_HAS_TIME)
+
+/* Ports without a faster timer use the kernel timestamp. */
+
+static uint32_t bench_port_time(void)
+{
+    return (time_timestamp());
+}
+
+static uint32_t bench_port_time_frequency(void)
+{
+    return (1000000);
+}
+
+static uint32_t bench_port_time_resolution(void)
+{
+    return (time_timestamp_resolution());
+}
+
+#endif
+
+/* A sample must take at least this many timer resolutions. */
+#define RESOLUTION_FACTOR                                              50
+
+/* Maximum number of operations per sample. */
+#define ITERATIONS_MAX                                        0x40000000
+
+/* Number of empty samples used to measure the overhead. */
+#define OVERHEAD_SAMPLES                                               16
+
+struct module_t {
+    int8_t initialized;
+    int8_t has_cycles;
+    /* Timer ticks it takes to call an empty benchmark function. */
+    uint32_t overhead;
+    /* Timer ticks per sample. */
+    uint32_t samples[CONFIG_BENCH_SAMPLES];
+};
+
+static struct module_t module;
+
+static void empty_fn(void *arg_p, uint32_t iterations)
+{
+}
+
+/**
+ * Run given benchmark function once and return the elapsed time in
+ * timer ticks. Elapsed CPU cycles are added to given counter.
+ */
+static uint32_t run_sample(bench_fn_t fn,
+                           void *arg_p,
+                           uint32_t iterations,
+                           uint64_t *cycles_p)
+{
+    uint32_t start;
+    uint32_t stop;
+    uint32_t start_cycles;
+    uint32_t stop_cycles;
+    int res;
+
+    res = bench_port_cycles(&start_cycles);
+    start = bench_port_time();
+    fn(arg_p, iterations);
+    stop = bench_port_time();
+
+    if (res == 0) {
+        bench_port_cycles(&stop_cycles);
+        *cycles_p += (stop_cycles - start_cycles);
+    }
+
+    stop -= start;
+
+    if (stop > module.overhead) {
+        stop -= module.overhead;
+    } else {
+        stop = 0;
+    }
+
+    return (stop);
+}
+
+/**
+ * Returns the number of operations per sample needed for a sample to
+ * take at least given time.
+ */
+static uint32_t calibrate(bench_fn_t fn, void *arg_p, uint32_t target)
+{
+    uint32_t iterations;
+    uint32_t ticks;
+    uint64_t cycles;
+    uint64_t next;
+
+    iterations = 1;
+    cycles = 0;
+
+    while (iterations < ITERATIONS_MAX) {
+        ticks = run_sample(fn, arg_p, iterations, &cycles);
+
+        if (ticks >= target) {
+            break;
+        }
+
+        /* Aim 20% above the target as the time per operation often
+           decreases when the number of operations grows. Do not grow
+           more than 100 times per round. */
+        if (ticks < target / 100) {
+            next = (100ull * iterations);
+        } else {
+            next = ((uint64_t)iterations * target / ticks);
+            next += (next / 5);
+        }
+
+        next = MAX(next, iterations + 1ull);
+        iterations = MIN(next, ITERATIONS_MAX);
+    }
+
+    return (iterations);
+}
+
+static void sort_samples(uint32_t *samples_p, int length)
+{
+    int i;
+    int j;
+    uint32_t sample;
+
+    for (i = 1; i < length; i++) {
+        sample = samples_p[i];
+
+        for (j = i; (j > 0) && (samples_p[j - 1] > sample); j--) {
+            samples_p[j] = samples_p[j - 1];
+        }
+
+        samples_p[j] = sample;
+    }
+}
+
+/**
+ * Nearest rank percentile of given sorted samples.
+ */
+static uint32_t percentile(const uint32_t *samples_p,
+                           int length,
+                           int percent)
+{
+    int rank;
+
+    rank = ((percent * length + 99) / 100);
+
+    if (rank > 0) {
+        rank--;
+    }
+
+    return (samples_p[rank]);
+}
+
+/**
+ * Convert given number of timer ticks for given number of operations
+ * to picoseconds per operation.
+ */
+static uint64_t ticks_to_ps(uint32_t ticks, uint32_t iterations)
+{
+    uint64_t ns;
+
+    ns = ((uint64_t)ticks * 1000000000ull / bench_port_time_frequency());
+
+    return ((1000 * ns + iterations / 2) / iterations);
+}
+
+/**
+ * Format given value in thousandths as a decimal number with three
+ * decimals.
+ */
+static char *format_thousandths(char *buf_p, size_t size, uint64_t value)
+{
+    std_snprintf(buf_p,
+                 size,
+                 FSTR("%lu.%03lu"),
+                 (unsigned long)(value / 1000),
+                 (unsigned long)(value % 1000));
+
+    return (buf_p);
+}
+
+static int write_time(struct json_writer_t *writer_p,
+                      const char *key_p,
+                      uint64_t value)
+{
+    char buf[24];
+
+    json_writer_key(writer_p, key_p);
+
+    return (json_writer_primitive(writer_p,
+                                  format_thousandths(&buf[0],
+                                                     sizeof(buf),
+                                                     value)));
+}
+
+int bench_module_init()
+{
+    int i;
+    uint32_t ticks;
+    uint32_t overhead;
+    uint32_t value;
+    uint64_t cycles;
+
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+
+    bench_port_init();
+    module.has_cycles = (bench_port_cycles(&value) == 0);
+
+    /* Measure the overhead of reading the timer and calling the
+       benchmark function. */
+    module.overhead = 0;
+    overhead = 0xffffffff;
+    cycles = 0;
+
+    for (i = 0; i < OVERHEAD_SAMPLES; i++) {
+        ticks = run_sample(empty_fn, NULL, 0, &cycles);
+        overhead = MIN(overhead, ticks);
+    }
+
+    module.overhead = overhead;
+
+    return (0);
+}
+
+int bench_run(struct bench_result_t *result_p,
+              const char *name_p,
+              bench_fn_t fn,
+              void *arg_p)
+{
+    ASSERTN(result_p != NULL, EINVAL);
+    ASSERTN(name_p != NULL, EINVAL);
+    ASSERTN(fn != NULL, EINVAL);
+
+    int i;
+    uint32_t target;
+    uint32_t iterations;
+    uint64_t cycles;
+    uint64_t sum;
+
+    target = (((uint64_t)CONFIG_BENCH_SAMPLE_TIME_US
+               * bench_port_time_frequency()) / 1000000);
+    target = MAX(target, RESOLUTION_FACTOR * bench_port_time_resolution());
+    iterations = calibrate(fn, arg_p, target);
+    cycles = 0;
+
+    for (i = 0; i < CONFIG_BENCH_WARMUP_SAMPLES; i++) {
+        run_sample(fn, arg_p, iterations, &cycles);
+    }
+
+    cycles = 0;
+
+    for (i = 0; i < CONFIG_BENCH_SAMPLES; i++) {
+        module.samples[i] = run_sample(fn, arg_p, iterations, &cycles);
+    }
+
+    result_p->name_p = name_p;
+    result_p->iterations = iterations;
+    result_p->samples = CONFIG_BENCH_SAMPLES;
+
+    sum = 0;
+
+    for (i = 0; i < CONFIG_BENCH_SAMPLES; i++) {
+        sum += ticks_to_ps(module.samples[i], iterations);
+    }
+
+    result_p->time.mean = (sum / CONFIG_BENCH_SAMPLES);
+
+    sort_samples(&module.samples[0], CONFIG_BENCH_SAMPLES);
+
+    result_p->time.min = ticks_to_ps(module.samples[0], iterations);
+    result_p->time.p50 = ticks_to_ps(percentile(&module.samples[0],
+                                                CONFIG_BENCH_SAMPLES,
+                                                50),
+                                     iterations);
+    result_p->time.p90 = ticks_to_ps(percentile(&module.samples[0],
+                                                CONFIG_BENCH_SAMPLES,
+                                                90),
+                                     iterations);
+    result_p->time.p99 = ticks_to_ps(percentile(&module.samples[0],
+                                                CONFIG_BENCH_SAMPLES,
+                                                99),
+                                     iterations);
+    result_p->time.max = ticks_to_ps(module.samples[CONFIG_BENCH_SAMPLES - 1],
+                                     iterations);
+
+    if (module.has_cycles == 1) {
+        result_p->cycles = ((1000 * cycles)
+                            / ((uint64_t)CONFIG_BENCH_SAMPLES * iterations));
+    } else {
+        result_p->cycles = -1;
+    }
+
+    return (0);
+}
+
+int bench_print(void *chan_p, const struct bench_result_t *result_p)
+{
+    ASSERTN(chan_p != NULL, EINVAL);
+    ASSERTN(result_p != NULL, EINVAL);
+
+    char p50[24];
+    char p99[24];
+    char mean[24];
+    char cycles[24];
+
+    if (result_p->cycles >= 0) {
+        format_thousandths(&cycles[0], sizeof(cycles), result_p->cycles);
+    } else {
+        strcpy(&cycles[0], "-");
+    }
+
+    std_fprintf(chan_p,
+                OSTR("%s: %s ns/op (p99 %s ns, mean %s ns, "
+                     "%s cycles/op, %lu ops x %d samples)\r\n"),
+                result_p->name_p,
+                format_thousandths(&p50[0], sizeof(p50), result_p->time.p50),
+                format_thousandths(&p99[0], sizeof(p99), result_p->time.p99),
+                format_thousandths(&mean[0],
+                                   sizeof(mean),
+                                   result_p->time.mean),
+                &cycles[0],
+                (unsigned long)result_p->iterations,
+                result_p->samples);
+
+    return (0);
+}
+
+int bench_print_json(void *chan_p,
+                     const struct bench_result_t *results_p,
+                     size_t length)
+{
+    ASSERTN(chan_p != NULL, EINVAL);
+    ASSERTN((results_p != NULL) || (length == 0), EINVAL);
+
+    struct json_writer_t writer;
+    const struct bench_result_t *result_p;
+    size_t i;
+    int res;
+
+    json_writer_init(&writer, chan_p);
+    json_writer_object_begin(&writer);
+    json_writer_key(&writer, "timer_frequency");
+    json_writer_integer(&writer, bench_port_time_frequency());
+    json_writer_key(&writer, "timer_resolution");
+    json_writer_integer(&writer, bench_port_time_resolution());
+    json_writer_key(&writer, "benchmarks");
+    json_writer_array_begin(&writer);
+
+    for (i = 0; i < length; i++) {
+        result_p = &results_p[i];
+        json_writer_object_begin(&writer);
+        json_writer_key(&writer, "name");
+        json_writer_string(&writer, result_p->name_p);
+        json_writer_key(&writer, "iterations");
+        json_writer_integer(&writer, result_p->iterations);
+        json_writer_key(&writer, "samples");
+        json_writer_integer(&writer, result_p->samples);
+        json_writer_key(&writer, "ns");
+        json_writer_object_begin(&writer);
+        write_time(&writer, "min", result_p->time.min);
+        write_time(&writer, "p50", result_p->time.p50);
+        write_time(&writer, "p90", result_p->time.p90);
+        write_time(&writer, "p99", result_p->time.p99);
+        write_time(&writer, "max", result_p->time.max);
+        write_time(&writer, "mean", result_p->time.mean);
+        json_writer_object_end(&writer);
+
+        if (result_p->cycles >= 0) {
+            write_time(&writer, "cycles", result_p->cycles);
+        } else {
+            json_writer_key(&writer, "cycles");
+            json_writer_primitive(&writer, "null");
+        }
+
+        json_writer_object_end(&writer);
+    }
+
+    json_writer_array_end(&writer);
+    res = json_writer_object_end(&writer);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    if (chan_write(chan_p, "\r\n", 2) != 2) {
+        return (-EIO);
+    }
+
+    return (0);
+}
@@ -0,0 +1,131 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#ifndef __DEBUG_BENCH_H__
+#define __DEBUG_BENCH_H__
+
+#include "simba.h"
+
+/**
+ * A benchmark function. It shall perform the measured operation
+ * given number of times.
+ *
+ * @param[in] arg_p Benchmark argument.
+ * @param[in] iterations Number of operations to perform.
+ */
+typedef void (*bench_fn_t)(void *arg_p, uint32_t iterations);
+
+/**
+ * Benchmark result. All times are per operation, in picoseconds.
+ */
+struct bench_result_t {
+    const char *name_p;
+    /** Number of operations per sample, found by calibration. */
+    uint32_t iterations;
+    /** Number of measured samples. */
+    int samples;
+    struct {
+        uint64_t min;
+        uint64_t p50;
+        uint64_t p90;
+        uint64_t p99;
+        uint64_t max;
+        uint64_t mean;
+    } time;
+    /** Mean number of CPU cycles per operation, in thousandths of a
+        cycle, or -1 if the port has no cycle counter. */
+    int64_t cycles;
+};
+
+/**
+ * Initialize the bench module. This function must be called before
+ * calling any other function in this module.
+ *
+ * The module will only be initialized once even if this function is
+ * called multiple times.
+ *
+ * @return zero(0) or negative error code.
+ */
+int bench_module_init(void);
+
+/**
+ * Run given benchmark function and store the result in given result
+ * object.
+ *
+ * The number of operations per sample is doubled, or scaled by the
+ * measured time, until a sample takes at least
+ * ``CONFIG_BENCH_SAMPLE_TIME_US`` microseconds, and at least 50
+ * times the timer resolution. Then ``CONFIG_BENCH_WARMUP_SAMPLES``
+ * samples are discarded before ``CONFIG_BENCH_SAMPLES`` samples are
+ * measured. The time it takes to call an empty benchmark function
+ * is subtracted from all samples.
+ *
+ * This function is not thread safe.
+ *
+ * @param[out] result_p Benchmark result.
+ * @param[in] name_p Benchmark name. Must be valid as long as the
+ *                   result is used.
+ * @param[in] fn Benchmark function.
+ * @param[in] arg_p Argument passed to the benchmark function.
+ *
+ * @return zero(0) or negative error code.
+ */
+int bench_run(struct bench_result_t *result_p,
+              const char *name_p,
+              bench_fn_t fn,
+              void *arg_p);
+
+/**
+ * Print given benchmark result in a human readable format to given
+ * channel.
+ *
+ * @param[in] chan_p Output channel.
+ * @param[in] result_p Benchmark result.
+ *
+ * @return zero(0) or negative error code.
+ */
+int bench_print(void *chan_p, const struct bench_result_t *result_p);
+
+/**
+ * Write given benchmark results as a JSON object on a single line to
+ * given channel. Times are in nanoseconds per operation. Use
+ * ``bin/bench.py`` to extract the results from the output of an
+ * application and compare them to a baseline.
+ *
+ * @param[in] chan_p Output channel.
+ * @param[in] results_p Benchmark results.
+ * @param[in] length Number of results.
+ *
+ * @return zero(0) or negative error code.
+ */
+int bench_print_json(void *chan_p,
+                     const struct bench_result_t *results_p,
+                     size_t length);
+
+#endif
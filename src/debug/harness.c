@@ -34,16 +34,34 @@
 #    define DPRINT(fmt, ...)
 #endif
 
-/* A rough estimate of the average mock entry size, including heap
+/* A rough estimate of the average mock entry size, including
    allocation overhead. */
 #define MOCK_ENTRY_SIZE (sizeof(struct mock_entry_t) + 8 * sizeof(void *))
 
-#define HEAP_SIZE (MOCK_ENTRY_SIZE * CONFIG_HARNESS_MOCK_ENTRIES_MAX)
+#define ARENA_SIZE (MOCK_ENTRY_SIZE * CONFIG_HARNESS_MOCK_ENTRIES_MAX)
+
+/* Four size classes per power of two, up to blocks of 2^17 units. */
+#define ARENA_SIZE_CLASSES_MAX 64
+
+/**
+ * An arena block header, also the arena allocation unit. Free blocks
+ * are linked in per size class free lists.
+ */
+union arena_block_t {
+    union arena_block_t *next_p;
+    size_t size_class;
+    uint64_t align;
+};
+
+struct mock_entry_cb_t {
+    harness_mock_cb_t fn;
+    char arg[1];
+};
 
 struct mock_entry_t {
-    struct list_elem_t base;
-    struct entry_t *next_p;
-    const char *id_p;
+    struct mock_entry_t *next_p;
+    struct mock_id_t *mock_id_p;
+    struct mock_entry_cb_t *cb_p;
 #if CONFIG_HARNESS_WRITE_BACKTRACE_DEPTH_MAX > 0
     struct {
         void *array[CONFIG_HARNESS_WRITE_BACKTRACE_DEPTH_MAX];
@@ -56,21 +74,26 @@ struct mock_entry_t {
     } data;
 };
 
-struct mock_entry_cb_t {
-    struct list_elem_t base;
-    struct mock_entry_t *entry_p;
-    harness_mock_cb_t fn;
-    char arg[1];
+/**
+ * A FIFO of all mock entries with the same id.
+ */
+struct mock_id_t {
+    struct mock_id_t *next_p;
+    const char *id_p;
+    uint32_t hash;
+    struct mock_entry_t *head_p;
+    struct mock_entry_t *tail_p;
 };
 
 struct module_t {
     struct {
-        struct heap_t obj;
-        uint8_t buf[HEAP_SIZE];
-    } heap;
+        union arena_block_t *free_lists[ARENA_SIZE_CLASSES_MAX];
+        size_t offset;
+        union arena_block_t buf[DIV_CEIL(ARENA_SIZE,
+                                         sizeof(union arena_block_t))];
+    } arena;
     struct {
-        struct list_t list;
-        struct list_t cb_list;
+        struct mock_id_t *buckets[CONFIG_HARNESS_MOCK_ID_BUCKETS];
     } mock;
     struct mutex_t mutex;
     struct bus_t bus;
@@ -79,6 +102,11 @@ struct module_t {
     int failed;
     int skipped;
     int current_testcase_result;
+    struct harness_testcase_t *current_testcase_p;
+    struct {
+        struct time_t uptime;
+        int micros;
+    } testcase_start;
 };
 
 static struct module_t module;
@@ -146,6 +174,14 @@ static int mock_entry_create_write_backtrace(struct mock_entry_t *entry_p)
     return (0);
 }
 
+static int mock_entry_copy_write_backtrace(struct mock_entry_t *dst_p,
+                                           struct mock_entry_t *src_p)
+{
+    dst_p->backtrace = src_p->backtrace;
+
+    return (0);
+}
+
 static int mock_entry_print_write_backtrace(struct mock_entry_t *entry_p)
 {
     void *array[2 * CONFIG_HARNESS_BACKTRACE_DEPTH_MAX];
@@ -168,6 +204,12 @@ static int mock_entry_create_write_backtrace(struct mock_entry_t *entry_p)
     return (0);
 }
 
+static int mock_entry_copy_write_backtrace(struct mock_entry_t *dst_p,
+                                           struct mock_entry_t *src_p)
+{
+    return (0);
+}
+
 static int mock_entry_print_write_backtrace(struct mock_entry_t *entry_p)
 {
     return (0);
@@ -175,83 +217,212 @@ static int mock_entry_print_write_backtrace(struct mock_entry_t *entry_p)
 
 #endif
 
-static struct mock_entry_cb_t *alloc_mock_entry_cb(size_t size)
+/**
+ * Size class of a block of given number of units. The classes are
+ * spaced four per power of two, so at most a quarter of a block is
+ * unused.
+ */
+static int arena_size_class(size_t units)
 {
-    struct mock_entry_cb_t *entry_cb_p;
+    int power;
 
-    mutex_lock(&module.mutex);
-    entry_cb_p = heap_alloc(&module.heap.obj,
-                            sizeof(*entry_cb_p) + size - 1);
-    mutex_unlock(&module.mutex);
+    units--;
+    power = 0;
+
+    while ((units >> power) >= 8) {
+        power++;
+    }
 
-    return (entry_cb_p);
+    return (4 * power + (int)(units >> power));
 }
 
-static int free_mock_entry_cb_no_lock(struct mock_entry_cb_t *entry_cb_p)
+/**
+ * Number of units in a block of given size class.
+ */
+static size_t arena_size_class_units(int size_class)
 {
-    heap_free(&module.heap.obj, entry_cb_p);
+    if (size_class < 8) {
+        return (size_class + 1);
+    }
 
-    return (0);
+    return (((size_class % 4) + 5) << (size_class / 4 - 1));
 }
 
-static struct mock_entry_cb_t *find_mock_entry_cb(struct mock_entry_t *entry_p)
+static void arena_reset(void)
 {
-    struct list_iter_t iter;
-    struct mock_entry_cb_t *entry_cb_p;
+    memset(&module.arena.free_lists[0], 0, sizeof(module.arena.free_lists));
+    module.arena.offset = 0;
+}
 
-    list_iter_init(&iter, &module.mock.cb_list);
+/**
+ * Allocate a block from the free list of its size class, or from the
+ * unused end of the arena if the free list is empty. Both are
+ * constant time operations.
+ */
+static void *arena_alloc_no_lock(size_t size)
+{
+    union arena_block_t *block_p;
+    size_t units;
+    int size_class;
 
-    while (1) {
-        entry_cb_p = (struct mock_entry_cb_t *)list_iter_next(&iter);
+    units = (1 + DIV_CEIL(size, sizeof(union arena_block_t)));
+    size_class = arena_size_class(units);
 
-        if (entry_cb_p == NULL) {
-            break;
+    if (size_class >= ARENA_SIZE_CLASSES_MAX) {
+        return (NULL);
+    }
+
+    block_p = module.arena.free_lists[size_class];
+
+    if (block_p != NULL) {
+        module.arena.free_lists[size_class] = block_p->next_p;
+    } else {
+        units = arena_size_class_units(size_class);
+
+        if (units > membersof(module.arena.buf) - module.arena.offset) {
+            return (NULL);
         }
 
-        if (entry_cb_p->entry_p == entry_p) {
-            list_remove(&module.mock.cb_list, entry_cb_p);
-            break;
+        block_p = &module.arena.buf[module.arena.offset];
+        module.arena.offset += units;
+    }
+
+    block_p->size_class = size_class;
+
+    return (block_p + 1);
+}
+
+static void arena_free_no_lock(void *buf_p)
+{
+    union arena_block_t *block_p;
+    int size_class;
+
+    block_p = ((union arena_block_t *)buf_p - 1);
+    size_class = block_p->size_class;
+    block_p->next_p = module.arena.free_lists[size_class];
+    module.arena.free_lists[size_class] = block_p;
+}
+
+/**
+ * FNV-1a hash of given mock id.
+ */
+static uint32_t hash_id(const char *id_p)
+{
+    uint32_t hash;
+
+    hash = 2166136261UL;
+
+    while (*id_p != '\0') {
+        hash ^= (uint8_t)*id_p++;
+        hash *= 16777619UL;
+    }
+
+    return (hash);
+}
+
+/**
+ * Find the entry FIFO of given mock id. Optionally create it if
+ * missing.
+ */
+static struct mock_id_t *find_mock_id_no_lock(const char *id_p, int create)
+{
+    struct mock_id_t **bucket_pp;
+    struct mock_id_t *mock_id_p;
+    uint32_t hash;
+
+    hash = hash_id(id_p);
+    bucket_pp = &module.mock.buckets[hash % CONFIG_HARNESS_MOCK_ID_BUCKETS];
+    mock_id_p = *bucket_pp;
+
+    while (mock_id_p != NULL) {
+        if ((mock_id_p->hash == hash)
+            && ((mock_id_p->id_p == id_p)
+                || (strcmp(mock_id_p->id_p, id_p) == 0))) {
+            return (mock_id_p);
         }
+
+        mock_id_p = mock_id_p->next_p;
+    }
+
+    if (!create) {
+        return (NULL);
+    }
+
+    mock_id_p = arena_alloc_no_lock(sizeof(*mock_id_p));
+
+    if (mock_id_p != NULL) {
+        mock_id_p->id_p = id_p;
+        mock_id_p->hash = hash;
+        mock_id_p->head_p = NULL;
+        mock_id_p->tail_p = NULL;
+        mock_id_p->next_p = *bucket_pp;
+        *bucket_pp = mock_id_p;
+    }
+
+    return (mock_id_p);
+}
+
+/**
+ * Append given chain of entries to the entry FIFO of their mock id.
+ */
+static void add_mock_entries_no_lock(struct mock_entry_t *head_p,
+                                     struct mock_entry_t *tail_p)
+{
+    struct mock_id_t *mock_id_p;
+
+    mock_id_p = head_p->mock_id_p;
+    tail_p->next_p = NULL;
+
+    if (mock_id_p->tail_p != NULL) {
+        mock_id_p->tail_p->next_p = head_p;
+    } else {
+        mock_id_p->head_p = head_p;
     }
 
-    return (entry_cb_p);
+    mock_id_p->tail_p = tail_p;
 }
 
-static struct mock_entry_t *alloc_mock_entry_no_lock(const char *id_p,
+static void remove_mock_entry_no_lock(struct mock_id_t *mock_id_p)
+{
+    mock_id_p->head_p = mock_id_p->head_p->next_p;
+
+    if (mock_id_p->head_p == NULL) {
+        mock_id_p->tail_p = NULL;
+    }
+}
+
+static struct mock_entry_t *alloc_mock_entry_no_lock(struct mock_id_t *mock_id_p,
                                                      size_t size)
 {
     struct mock_entry_t *entry_p;
 
-    DPRINT("Allocating mock entry for id '%s'.\r\n", id_p);
+    DPRINT("Allocating mock entry for id '%s'.\r\n", mock_id_p->id_p);
 
-    entry_p = heap_alloc(&module.heap.obj,
-                         sizeof(*entry_p) + size - 1);
+    entry_p = arena_alloc_no_lock(sizeof(*entry_p) + size - 1);
 
     if (entry_p != NULL) {
-        entry_p->id_p = id_p;
+        entry_p->next_p = NULL;
+        entry_p->mock_id_p = mock_id_p;
+        entry_p->cb_p = NULL;
+        entry_p->data.size = size;
     }
 
     return (entry_p);
 }
 
-static struct mock_entry_t *alloc_mock_entry(const char *id_p,
-                                             size_t size)
+static int free_mock_entry_no_lock(struct mock_entry_t *entry_p)
 {
-    struct mock_entry_t *entry_p;
+    DPRINT("Freeing mock entry with id '%s'.\r\n", entry_p->mock_id_p->id_p);
 
-    mutex_lock(&module.mutex);
-    entry_p = alloc_mock_entry_no_lock(id_p, size);
-    mutex_unlock(&module.mutex);
+    arena_free_no_lock(entry_p);
 
-    return (entry_p);
+    return (0);
 }
 
 static int free_mock_entry(struct mock_entry_t *entry_p)
 {
-    DPRINT("Freeing mock entry with id '%s'.\r\n", entry_p->id_p);
-
     mutex_lock(&module.mutex);
-    heap_free(&module.heap.obj, entry_p);
+    free_mock_entry_no_lock(entry_p);
     mutex_unlock(&module.mutex);
 
     return (0);
@@ -261,57 +432,72 @@ static struct mock_entry_t *copy_mock_entry_no_lock(struct mock_entry_t *entry_p
 {
     struct mock_entry_t *copy_p;
 
-    copy_p = alloc_mock_entry_no_lock(entry_p->id_p,
+    copy_p = alloc_mock_entry_no_lock(entry_p->mock_id_p,
                                       entry_p->data.size);
-    memcpy(copy_p, entry_p, sizeof(*entry_p) + entry_p->data.size - 1);
+
+    if (copy_p != NULL) {
+        memcpy(copy_p, entry_p, sizeof(*entry_p) + entry_p->data.size - 1);
+    }
 
     return (copy_p);
 }
 
+static int mock_entry_alloc_failed(const char *id_p)
+{
+    std_printf(OSTR("Mock entry memory allocation failed for id '%s'\r\n"),
+               id_p);
+    print_write_backtrace();
+    harness_set_testcase_result(-1);
+
+    return (-ENOMEM);
+}
+
+/**
+ * Remove the first mock entry with given id, or return a modified
+ * copy of it if it has a callback. The returned entry must be freed
+ * by the caller.
+ */
 static struct mock_entry_t *find_mock_entry(const char *id_p)
 {
-    struct list_iter_t iter;
+    struct mock_id_t *mock_id_p;
     struct mock_entry_t *entry_p;
     struct mock_entry_t *new_entry_p;
     struct mock_entry_cb_t *entry_cb_p;
     int res;
 
-    mutex_lock(&module.mutex);
+    entry_p = NULL;
 
-    list_iter_init(&iter, &module.mock.list);
+    mutex_lock(&module.mutex);
 
-    while (1) {
-        entry_p = (struct mock_entry_t *)list_iter_next(&iter);
+    mock_id_p = find_mock_id_no_lock(id_p, 0);
 
-        if (entry_p == NULL) {
-            break;
-        }
+    if (mock_id_p != NULL) {
+        entry_p = mock_id_p->head_p;
+    }
 
-        if (strcmp(entry_p->id_p, id_p) == 0) {
-            entry_cb_p = find_mock_entry_cb(entry_p);
+    if (entry_p != NULL) {
+        entry_cb_p = entry_p->cb_p;
 
-            if (entry_cb_p == NULL) {
-                list_remove(&module.mock.list, entry_p);
-            } else {
-                /* Make a copy of the mock entry since the mock
-                   callback may modify it. */
-                new_entry_p = copy_mock_entry_no_lock(entry_p);
+        if (entry_cb_p == NULL) {
+            remove_mock_entry_no_lock(mock_id_p);
+        } else {
+            /* Make a copy of the mock entry since the mock
+               callback may modify it. */
+            new_entry_p = copy_mock_entry_no_lock(entry_p);
 
+            if (new_entry_p != NULL) {
                 res = entry_cb_p->fn(&entry_cb_p->arg[0],
                                      &new_entry_p->data.buf[0],
                                      &new_entry_p->data.size);
 
                 if (res == 1) {
-                    list_remove(&module.mock.list, entry_p);
-                    free_mock_entry_cb_no_lock(entry_cb_p);
-                } else {
-                    list_add_tail(&module.mock.cb_list, entry_cb_p);
+                    remove_mock_entry_no_lock(mock_id_p);
+                    arena_free_no_lock(entry_cb_p);
+                    free_mock_entry_no_lock(entry_p);
                 }
-
-                entry_p = new_entry_p;
             }
 
-            break;
+            entry_p = new_entry_p;
         }
     }
 
@@ -382,6 +568,26 @@ static int mwrite_cb(void *arg_p, void *buf_p, size_t *size_p)
     return (*length_p == 0);
 }
 
+static int check_mock_write(const char *id_p,
+                            const void *buf_p,
+                            size_t size)
+{
+    if ((buf_p == NULL) && (size > 0)) {
+        std_printf(OSTR("create_mock_entry(): Got NULL pointer with size "
+                        "greater than zero(0) for mock id '%s'\r\n"),
+                   id_p);
+        print_write_backtrace();
+        harness_set_testcase_result(-1);
+
+        return (-EINVAL);
+    }
+
+    return (0);
+}
+
+/**
+ * Create a mock entry. The entry is not added to its mock id FIFO.
+ */
 static ssize_t create_mock_entry(const char *id_p,
                                  const void *buf_p,
                                  size_t size,
@@ -389,28 +595,30 @@ static ssize_t create_mock_entry(const char *id_p,
 {
     ASSERTN(id_p != NULL, EINVAL);
 
+    struct mock_id_t *mock_id_p;
     struct mock_entry_t *entry_p;
+    int res;
 
-    if ((buf_p == NULL) && (size > 0)) {
-        std_printf(OSTR("create_mock_entry(): Got NULL pointer with size "
-                        "greater than zero(0) for mock id '%s'\r\n"),
-                   id_p);
-        print_write_backtrace();
-        harness_set_testcase_result(-1);
+    res = check_mock_write(id_p, buf_p, size);
 
-        return (-EINVAL);
+    if (res != 0) {
+        return (res);
     }
 
-    entry_p = alloc_mock_entry(id_p, size);
+    entry_p = NULL;
 
-    if (entry_p == NULL) {
-        std_printf(
-            OSTR("Mock entry memory allocation failed for id '%s'\r\n"),
-            id_p);
-        print_write_backtrace();
-        harness_set_testcase_result(-1);
+    mutex_lock(&module.mutex);
 
-        return (-ENOMEM);
+    mock_id_p = find_mock_id_no_lock(id_p, 1);
+
+    if (mock_id_p != NULL) {
+        entry_p = alloc_mock_entry_no_lock(mock_id_p, size);
+    }
+
+    mutex_unlock(&module.mutex);
+
+    if (entry_p == NULL) {
+        return (mock_entry_alloc_failed(id_p));
     }
 
     /* Initiate the object. */
@@ -418,7 +626,6 @@ static ssize_t create_mock_entry(const char *id_p,
         memcpy(&entry_p->data.buf[0], buf_p, size);
     }
 
-    entry_p->data.size = size;
     mock_entry_create_write_backtrace(entry_p);
 
     *entry_pp = entry_p;
@@ -426,6 +633,35 @@ static ssize_t create_mock_entry(const char *id_p,
     return (size);
 }
 
+static int fail_on_unread_mock_entries(void)
+{
+    int res;
+    int i;
+    struct mock_id_t *mock_id_p;
+    struct mock_entry_t *entry_p;
+
+    res = 0;
+
+    for (i = 0; i < CONFIG_HARNESS_MOCK_ID_BUCKETS; i++) {
+        mock_id_p = module.mock.buckets[i];
+
+        while (mock_id_p != NULL) {
+            entry_p = mock_id_p->head_p;
+
+            while (entry_p != NULL) {
+                std_printf(OSTR("Found unread mock id '%s'. Failing test.\r\n"),
+                           mock_id_p->id_p);
+                res = -1;
+                entry_p = entry_p->next_p;
+            }
+
+            mock_id_p = mock_id_p->next_p;
+        }
+    }
+
+    return (res);
+}
+
 static int number_of_testcases(struct harness_testcase_t *testcase_p)
 {
     int number_of_testcases;
@@ -440,6 +676,59 @@ static int number_of_testcases(struct harness_testcase_t *testcase_p)
     return (number_of_testcases);
 }
 
+static void start_testcase_timer(void)
+{
+    sys_uptime(&module.testcase_start.uptime);
+    module.testcase_start.micros = time_micros();
+}
+
+/**
+ * Wall time of the current testcase in microseconds. The uptime has
+ * system tick resolution, so it is refined with the microsecond
+ * counter if the testcase was shorter than the counter period.
+ */
+static unsigned long testcase_elapsed_us(void)
+{
+    struct time_t now;
+    struct time_t elapsed;
+    unsigned long elapsed_us;
+    int micros;
+    int maximum;
+
+    micros = time_micros();
+    sys_uptime(&now);
+    time_subtract(&elapsed, &now, &module.testcase_start.uptime);
+    elapsed_us = (1000000UL * elapsed.seconds + elapsed.nanoseconds / 1000);
+    maximum = time_micros_maximum();
+
+    if ((maximum > 0)
+        && (elapsed_us + 1000000UL / CONFIG_SYSTEM_TICK_FREQUENCY
+            < (unsigned long)maximum)) {
+        elapsed_us = time_micros_elapsed(module.testcase_start.micros, micros);
+    }
+
+    return (elapsed_us);
+}
+
+/**
+ * Print the exit line of the current testcase, including its wall
+ * time in milliseconds.
+ */
+static int print_testcase_exit(const char *result_p)
+{
+    unsigned long elapsed_us;
+
+    elapsed_us = testcase_elapsed_us();
+
+    std_printf(OSTR("exit: %s: %s (%lu.%03lu ms)\r\n"),
+               module.current_testcase_p->name_p,
+               result_p,
+               elapsed_us / 1000,
+               elapsed_us % 1000);
+
+    return (0);
+}
+
 static int print_report_and_stop(void)
 {
     int total;
@@ -474,10 +763,6 @@ int harness_run(struct harness_testcase_t *testcases_p)
 {
     int err;
     struct harness_testcase_t *testcase_p;
-    struct mock_entry_t *entry_p;
-    size_t sizes[HEAP_FIXED_SIZES_MAX] = {
-        8, 16, 32, 32, 32, 32, 32, 32
-    };
 
     mutex_init(&module.mutex);
 
@@ -496,53 +781,44 @@ int harness_run(struct harness_testcase_t *testcases_p)
                     "========================\r\n\r\n"));
     std_printf(sys_get_info());
     std_printf(OSTR("\r\n"));
-    std_printf(OSTR("mock heap size: %u bytes\r\n"), sizeof(module.heap.buf));
+    std_printf(OSTR("mock arena size: %u bytes\r\n"),
+               sizeof(module.arena.buf));
 
     while (testcase_p->callback != NULL) {
-        /* Reinitialize the heap before every testcase for minimal
-           memory usage. */
-        list_init(&module.mock.list);
-        list_init(&module.mock.cb_list);
-
-        heap_init(&module.heap.obj,
-                  &module.heap.buf[0],
-                  sizeof(module.heap.buf),
-                  &sizes[0]);
+        /* Reset the arena and the mock id index before every
+           testcase for minimal memory usage. */
+        arena_reset();
+        memset(&module.mock.buckets[0], 0, sizeof(module.mock.buckets));
 
         /* Mark current testcase as passed before its executed. */
         harness_set_testcase_result(0);
 
         std_printf(OSTR("\r\nenter: %s\r\n"), testcase_p->name_p);
 
-        err = testcase_p->callback();
+        module.current_testcase_p = testcase_p;
+        start_testcase_timer();
 
-        do {
-            entry_p = (struct mock_entry_t *)list_remove_head(&module.mock.list);
+        err = testcase_p->callback();
 
-            if (entry_p != NULL) {
-                std_printf(OSTR("Found unread mock id '%s'. Failing test.\r\n"),
-                           entry_p->id_p);
-                err = -1;
-            }
-        } while (entry_p != NULL);
+        if (fail_on_unread_mock_entries() != 0) {
+            err = -1;
+        }
 
         if ((err < 0) || (harness_get_testcase_result() == -1)) {
             module.failed++;
-            std_printf(OSTR("exit: %s: FAILED\r\n"),
-                       testcase_p->name_p);
+            print_testcase_exit("FAILED");
 #if CONFIG_HARNESS_EARLY_EXIT == 1
             print_report_and_stop();
 #endif
         } else if ((err == 0) && (harness_get_testcase_result() == 0)) {
             module.passed++;
-            std_printf(OSTR("exit: %s: PASSED\r\n"),
-                       testcase_p->name_p);
+            print_testcase_exit("PASSED");
         } else {
             module.skipped++;
-            std_printf(OSTR("exit: %s: SKIPPED\r\n"),
-                       testcase_p->name_p);
+            print_testcase_exit("SKIPPED");
         }
 
+        module.current_testcase_p = NULL;
         testcase_p++;
     }
 
@@ -615,14 +891,101 @@ ssize_t harness_mock_write(const char *id_p,
         return (res);
     }
 
-    /* Add the entry at the end of the list. */
+    /* Add the entry at the end of its FIFO. */
     mutex_lock(&module.mutex);
-    list_add_tail(&module.mock.list, entry_p);
+    add_mock_entries_no_lock(entry_p, entry_p);
     mutex_unlock(&module.mutex);
 
     return (res);
 }
 
+ssize_t harness_mock_write_many(const char *id_p,
+                                const void *buf_p,
+                                size_t size,
+                                size_t length)
+{
+    ASSERTN(id_p != NULL, EINVAL);
+
+    ssize_t res;
+    size_t i;
+    struct mock_id_t *mock_id_p;
+    struct mock_entry_t *head_p;
+    struct mock_entry_t *tail_p;
+    struct mock_entry_t *entry_p;
+
+    res = check_mock_write(id_p, buf_p, size);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    if (length == 0) {
+        return (0);
+    }
+
+    head_p = NULL;
+    tail_p = NULL;
+
+    /* Allocate all entries at once, and write none of them if the
+       arena is exhausted. */
+    mutex_lock(&module.mutex);
+
+    mock_id_p = find_mock_id_no_lock(id_p, 1);
+
+    for (i = 0; i < length; i++) {
+        entry_p = NULL;
+
+        if (mock_id_p != NULL) {
+            entry_p = alloc_mock_entry_no_lock(mock_id_p, size);
+        }
+
+        if (entry_p == NULL) {
+            while (head_p != NULL) {
+                entry_p = head_p;
+                head_p = head_p->next_p;
+                free_mock_entry_no_lock(entry_p);
+            }
+
+            break;
+        }
+
+        if (head_p == NULL) {
+            head_p = entry_p;
+        } else {
+            tail_p->next_p = entry_p;
+        }
+
+        tail_p = entry_p;
+    }
+
+    mutex_unlock(&module.mutex);
+
+    if (head_p == NULL) {
+        return (mock_entry_alloc_failed(id_p));
+    }
+
+    /* Initiate the objects, all with the same write backtrace. */
+    mock_entry_create_write_backtrace(head_p);
+    entry_p = head_p;
+
+    for (i = 0; i < length; i++) {
+        if (size > 0) {
+            memcpy(&entry_p->data.buf[0],
+                   (const uint8_t *)buf_p + i * size,
+                   size);
+        }
+
+        mock_entry_copy_write_backtrace(entry_p, head_p);
+        entry_p = entry_p->next_p;
+    }
+
+    mutex_lock(&module.mutex);
+    add_mock_entries_no_lock(head_p, tail_p);
+    mutex_unlock(&module.mutex);
+
+    return (size * length);
+}
+
 ssize_t harness_mock_mwrite(const char *id_p,
                             const void *buf_p,
                             size_t size,
@@ -657,7 +1020,9 @@ ssize_t harness_mock_cwrite(const char *id_p,
     }
 
     /* Allocate a callback entry. */
-    entry_cb_p = alloc_mock_entry_cb(arg_size);
+    mutex_lock(&module.mutex);
+    entry_cb_p = arena_alloc_no_lock(sizeof(*entry_cb_p) + arg_size - 1);
+    mutex_unlock(&module.mutex);
 
     if (entry_cb_p == NULL) {
         std_printf(
@@ -672,16 +1037,16 @@ ssize_t harness_mock_cwrite(const char *id_p,
     }
 
     /* Initiate the callback entry. */
-    entry_cb_p->entry_p = entry_p;
     entry_cb_p->fn = cb;
 
     if (arg_p != NULL) {
         memcpy(&entry_cb_p->arg[0], arg_p, arg_size);
     }
 
+    entry_p->cb_p = entry_cb_p;
+
     mutex_lock(&module.mutex);
-    list_add_tail(&module.mock.list, entry_p);
-    list_add_tail(&module.mock.cb_list, entry_cb_p);
+    add_mock_entries_no_lock(entry_p, entry_p);
     mutex_unlock(&module.mutex);
 
     return (size);
@@ -709,6 +1074,27 @@ ssize_t harness_mock_read(const char *id_p,
     return (res);
 }
 
+ssize_t harness_mock_read_many(const char *id_p,
+                               void *buf_p,
+                               size_t size,
+                               size_t length)
+{
+    ASSERTN(id_p != NULL, EINVAL);
+
+    ssize_t res;
+    size_t i;
+
+    for (i = 0; i < length; i++) {
+        res = harness_mock_read(id_p, (uint8_t *)buf_p + i * size, size);
+
+        if (res != size) {
+            return (res);
+        }
+    }
+
+    return (size * length);
+}
+
 ssize_t harness_mock_try_read(const char *id_p,
                               void *buf_p,
                               size_t size)
@@ -869,6 +1255,11 @@ int harness_set_testcase_result(int result)
 #if CONFIG_HARNESS_EARLY_EXIT == 1
     if (result == -1) {
         module.failed++;
+
+        if (module.current_testcase_p != NULL) {
+            print_testcase_exit("FAILED");
+        }
+
         print_report_and_stop();
     }
 #endif
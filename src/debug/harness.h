@@ -226,6 +226,30 @@ ssize_t harness_mock_write(const char *id_p,
                            const void *buf_p,
                            size_t size);
 
+/**
+ * Write `length` mock entries with given id at once, one per `size`
+ * bytes of given buffer. The mock entries can later be read in order
+ * with `harness_mock_read_many()`, or one by one with
+ * `harness_mock_read()`, `harness_mock_try_read()` or
+ * `harness_mock_assert()`. No mock entry is written on failure.
+ *
+ * @param[in] id_p Mock id string to write.
+ *
+ *                 NOTE: Only a reference to this string is stored in
+ *                       the mock entries.
+ * @param[in] buf_p Data for all mock entries, or NULL if no data
+ *                  shall be written.
+ * @param[in] size Size of each mock entry in words, or zero(0) if
+ *                 buf_p is NULL.
+ * @param[in] length Number of mock entries to write.
+ *
+ * @return Number of written words or negative error code.
+ */
+ssize_t harness_mock_write_many(const char *id_p,
+                                const void *buf_p,
+                                size_t size,
+                                size_t length);
+
 /**
  * Write given data buffer to a mock entry with given id. The mock
  * entry can later be read `length` times with `harness_mock_read()`,
@@ -292,6 +316,26 @@ ssize_t harness_mock_read(const char *id_p,
                           void *buf_p,
                           size_t size);
 
+/**
+ * Read data from `length` mock entries with given id into given
+ * buffer, `size` words per mock entry. The testcase fails if fewer
+ * mock entries are found or if given size does not match the size in
+ * a mock entry.
+ *
+ * @param[in] id_p Mock id string to read.
+ * @param[out] buf_p Buffer to read into, or NULL if no data shall
+ *                   be read.
+ * @param[in] size Size of each mock entry in words, or zero(0) if
+ *                 buf_p is NULL.
+ * @param[in] length Number of mock entries to read.
+ *
+ * @return Number of read words or negative error code.
+ */
+ssize_t harness_mock_read_many(const char *id_p,
+                               void *buf_p,
+                               size_t size,
+                               size_t length);
+
 /**
  * Try to read data from mock entry with given id. The testcase does
  * not fail if the mock entry is missing. However, the test case fails
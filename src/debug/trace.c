@@ -0,0 +1,586 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#if CONFIG_TRACE == 1
+
+#if defined(ARCH_LINUX)
+#    include <stdio.h>
+#endif
+
+#define BUFFER_MASK                     (CONFIG_TRACE_BUFFER_SIZE - 1)
+
+/* Thread name characters per name record. */
+#define NAME_CHUNK_SIZE                                                 4
+
+/* Maximum number of name records written per thread. */
+#define NAME_CHUNKS_MAX                                                 4
+
+/* Number of records read from the buffer at a time when printing or
+   dumping. */
+#define READ_CHUNK_SIZE                                                 8
+
+#if (CONFIG_TRACE_BUFFER_SIZE & BUFFER_MASK) != 0
+#    error "CONFIG_TRACE_BUFFER_SIZE must be a power of two."
+#endif
+
+typedef void (*record_writer_t)(void *arg_p,
+                                const struct trace_record_t *record_p);
+
+struct module_t {
+    int8_t initialized;
+    int8_t started;
+    /* Total number of records written since the trace was
+       started. */
+    uint32_t head;
+    struct trace_record_t records[CONFIG_TRACE_BUFFER_SIZE];
+#if defined(ARCH_LINUX)
+    FILE *output_p;
+#endif
+#if CONFIG_TRACE_FS_COMMANDS == 1
+    struct fs_command_t cmd_start;
+    struct fs_command_t cmd_stop;
+    struct fs_command_t cmd_print;
+    struct fs_command_t cmd_dump;
+#endif
+};
+
+static FAR const char event_thrd_name[] = "thrd_name";
+static FAR const char event_thrd_switch[] = "thrd_switch";
+static FAR const char event_isr_enter[] = "isr_enter";
+static FAR const char event_isr_exit[] = "isr_exit";
+static FAR const char event_sem_take_wait[] = "sem_take_wait";
+static FAR const char event_sem_take_done[] = "sem_take_done";
+static FAR const char event_mutex_lock_wait[] = "mutex_lock_wait";
+static FAR const char event_mutex_lock_done[] = "mutex_lock_done";
+static FAR const char event_queue_read_wait[] = "queue_read_wait";
+static FAR const char event_queue_read_done[] = "queue_read_done";
+static FAR const char event_queue_write_wait[] = "queue_write_wait";
+static FAR const char event_queue_write_done[] = "queue_write_done";
+static FAR const char event_can_input[] = "can_input";
+
+/* Event strings array, indexed by event. */
+static const char FAR *event_as_string[] = {
+    event_thrd_name,
+    event_thrd_switch,
+    event_isr_enter,
+    event_isr_exit,
+    event_sem_take_wait,
+    event_sem_take_done,
+    event_mutex_lock_wait,
+    event_mutex_lock_done,
+    event_queue_read_wait,
+    event_queue_read_done,
+    event_queue_write_wait,
+    event_queue_write_done,
+    event_can_input
+};
+
+/* The module state. */
+static struct module_t module;
+
+static uint32_t thrd_to_id(struct thrd_t *thrd_p)
+{
+    return ((uint32_t)(uintptr_t)thrd_p);
+}
+
+static int number_of_records_isr(void)
+{
+    return (MIN(module.head, CONFIG_TRACE_BUFFER_SIZE));
+}
+
+/**
+ * Get the name of the thread with given id, or NULL if no such thread
+ * exists anymore.
+ */
+static const char *thrd_id_to_name(uint32_t id)
+{
+    struct thrd_t *thrd_p;
+
+    thrd_p = thrd_get_next(NULL);
+
+    while (thrd_p != NULL) {
+        if (thrd_to_id(thrd_p) == id) {
+            return (thrd_p->name_p);
+        }
+
+        thrd_p = thrd_get_next(thrd_p);
+    }
+
+    return (NULL);
+}
+
+/**
+ * Call given writer with name records for all threads, or just count
+ * them if the writer is NULL. Names are split into chunks of four
+ * characters, and at least one record is written per thread.
+ */
+static int write_name_records(record_writer_t writer, void *arg_p)
+{
+    struct thrd_t *thrd_p;
+    struct trace_record_t record;
+    const char *name_p;
+    size_t offset;
+    size_t length;
+    int number_of_records;
+
+    number_of_records = 0;
+    thrd_p = thrd_get_next(NULL);
+
+    while (thrd_p != NULL) {
+        name_p = thrd_p->name_p;
+
+        if (name_p == NULL) {
+            name_p = "";
+        }
+
+        length = MIN(strlen(name_p), NAME_CHUNK_SIZE * NAME_CHUNKS_MAX);
+        offset = 0;
+
+        do {
+            if (writer != NULL) {
+                record.timestamp = 0;
+                record.event = TRACE_EVENT_THRD_NAME;
+                record.data = offset;
+                record.thrd = thrd_to_id(thrd_p);
+                record.arg = 0;
+                memcpy(&record.arg,
+                       &name_p[offset],
+                       MIN(length - offset, NAME_CHUNK_SIZE));
+                writer(arg_p, &record);
+            }
+
+            number_of_records++;
+            offset += NAME_CHUNK_SIZE;
+        } while (offset < length);
+
+        thrd_p = thrd_get_next(thrd_p);
+    }
+
+    return (number_of_records);
+}
+
+static void write_record_to_chan(void *arg_p,
+                                 const struct trace_record_t *record_p)
+{
+    chan_write(arg_p, record_p, sizeof(*record_p));
+}
+
+#if defined(ARCH_LINUX)
+
+static void write_record_to_file(void *arg_p,
+                                 const struct trace_record_t *record_p)
+{
+    fwrite(record_p, sizeof(*record_p), 1, arg_p);
+}
+
+#endif
+
+#if CONFIG_TRACE_FS_COMMANDS == 1
+
+/**
+ * The shell command callback for "/debug/trace/start".
+ */
+static int cmd_start_cb(int argc,
+                        const char *argv[],
+                        void *out_p,
+                        void *in_p,
+                        void *arg_p,
+                        void *call_arg_p)
+{
+    return (trace_start());
+}
+
+/**
+ * The shell command callback for "/debug/trace/stop".
+ */
+static int cmd_stop_cb(int argc,
+                       const char *argv[],
+                       void *out_p,
+                       void *in_p,
+                       void *arg_p,
+                       void *call_arg_p)
+{
+    return (trace_stop());
+}
+
+/**
+ * The shell command callback for "/debug/trace/print".
+ */
+static int cmd_print_cb(int argc,
+                        const char *argv[],
+                        void *out_p,
+                        void *in_p,
+                        void *arg_p,
+                        void *call_arg_p)
+{
+    return (trace_print(out_p));
+}
+
+/**
+ * The shell command callback for "/debug/trace/dump".
+ */
+static int cmd_dump_cb(int argc,
+                       const char *argv[],
+                       void *out_p,
+                       void *in_p,
+                       void *arg_p,
+                       void *call_arg_p)
+{
+    return (trace_dump(out_p));
+}
+
+#endif
+
+int trace_module_init()
+{
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+    module.started = 0;
+    module.head = 0;
+
+#if CONFIG_TRACE_FS_COMMANDS == 1
+    fs_command_init(&module.cmd_start,
+                    CSTR("/debug/trace/start"),
+                    cmd_start_cb,
+                    NULL);
+    fs_command_register(&module.cmd_start);
+
+    fs_command_init(&module.cmd_stop,
+                    CSTR("/debug/trace/stop"),
+                    cmd_stop_cb,
+                    NULL);
+    fs_command_register(&module.cmd_stop);
+
+    fs_command_init(&module.cmd_print,
+                    CSTR("/debug/trace/print"),
+                    cmd_print_cb,
+                    NULL);
+    fs_command_register(&module.cmd_print);
+
+    fs_command_init(&module.cmd_dump,
+                    CSTR("/debug/trace/dump"),
+                    cmd_dump_cb,
+                    NULL);
+    fs_command_register(&module.cmd_dump);
+#endif
+
+    return (0);
+}
+
+int trace_start()
+{
+    sys_lock();
+    module.head = 0;
+    module.started = 1;
+    sys_unlock();
+
+    return (0);
+}
+
+int trace_stop()
+{
+    sys_lock();
+    module.started = 0;
+    sys_unlock();
+
+    return (0);
+}
+
+void trace_write(int event, int data, uint32_t arg)
+{
+    sys_lock();
+    trace_write_isr(event, data, arg);
+    sys_unlock();
+}
+
+RAM_CODE void trace_write_isr(int event, int data, uint32_t arg)
+{
+    struct trace_record_t *record_p;
+
+    if (module.started == 0) {
+        return;
+    }
+
+    /* Overwrite the oldest record when the buffer is full. */
+    record_p = &module.records[module.head & BUFFER_MASK];
+    /* Microseconds, truncated to 32 bits. The host side converter
+       handles the wrap around. */
+    record_p->timestamp = time_timestamp_isr();
+    record_p->event = event;
+    record_p->data = data;
+    record_p->thrd = thrd_to_id(thrd_self());
+    record_p->arg = arg;
+    module.head++;
+
+#if defined(ARCH_LINUX)
+    if (module.output_p != NULL) {
+        write_record_to_file(module.output_p, record_p);
+    }
+#endif
+}
+
+int trace_get_number_of_records()
+{
+    int res;
+
+    sys_lock();
+    res = number_of_records_isr();
+    sys_unlock();
+
+    return (res);
+}
+
+uint32_t trace_get_number_of_overwritten_records()
+{
+    uint32_t res;
+
+    res = 0;
+
+    sys_lock();
+
+    if (module.head > CONFIG_TRACE_BUFFER_SIZE) {
+        res = (module.head - CONFIG_TRACE_BUFFER_SIZE);
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+ssize_t trace_read(struct trace_record_t *records_p,
+                   int offset,
+                   size_t length)
+{
+    ASSERTN(records_p != NULL, EINVAL);
+    ASSERTN(offset >= 0, EINVAL);
+
+    uint32_t tail;
+    size_t i;
+
+    sys_lock();
+
+    if (offset > number_of_records_isr()) {
+        offset = number_of_records_isr();
+    }
+
+    length = MIN(length, (size_t)(number_of_records_isr() - offset));
+    tail = (module.head - number_of_records_isr() + offset);
+
+    for (i = 0; i < length; i++) {
+        records_p[i] = module.records[(tail + i) & BUFFER_MASK];
+    }
+
+    sys_unlock();
+
+    return (length);
+}
+
+/**
+ * Stop tracing and return true(1) if tracing was started, otherwise
+ * false(0).
+ */
+static int8_t pause_tracing(void)
+{
+    int8_t started;
+
+    sys_lock();
+    started = module.started;
+    module.started = 0;
+    sys_unlock();
+
+    return (started);
+}
+
+/**
+ * Restart tracing, without clearing the buffer, if it was started
+ * when paused.
+ */
+static void resume_tracing(int8_t started)
+{
+    sys_lock();
+    module.started = started;
+    sys_unlock();
+}
+
+int trace_print(void *chan_p)
+{
+    ASSERTN(chan_p != NULL, EINVAL);
+
+    struct trace_record_t records[READ_CHUNK_SIZE];
+    const char *name_p;
+    int8_t started;
+    int offset;
+    ssize_t size;
+    ssize_t i;
+
+    /* Pause tracing to get a consistent buffer. */
+    started = pause_tracing();
+
+    std_fprintf(chan_p,
+                OSTR("   TIMESTAMP  THREAD            EVENT"
+                     "               DATA  ARG\r\n"));
+
+    offset = 0;
+
+    while (1) {
+        size = trace_read(&records[0], offset, membersof(records));
+
+        if (size <= 0) {
+            break;
+        }
+
+        for (i = 0; i < size; i++) {
+            name_p = thrd_id_to_name(records[i].thrd);
+
+            if (name_p != NULL) {
+                std_fprintf(chan_p,
+                            OSTR("%12lu  %-16s  "),
+                            (unsigned long)records[i].timestamp,
+                            name_p);
+            } else {
+                std_fprintf(chan_p,
+                            OSTR("%12lu  0x%08lx        "),
+                            (unsigned long)records[i].timestamp,
+                            (unsigned long)records[i].thrd);
+            }
+
+            if (records[i].event < membersof(event_as_string)) {
+                std_fprintf(chan_p,
+                            OSTR("%-17s"),
+                            event_as_string[records[i].event]);
+            } else {
+                std_fprintf(chan_p,
+                            OSTR("user+%-12u"),
+                            records[i].event - TRACE_EVENT_USER);
+            }
+
+            std_fprintf(chan_p,
+                        OSTR("  %5u  0x%08lx\r\n"),
+                        records[i].data,
+                        (unsigned long)records[i].arg);
+        }
+
+        offset += size;
+    }
+
+    std_fprintf(chan_p,
+                OSTR("%d record(s), %lu overwritten\r\n"),
+                offset,
+                (unsigned long)trace_get_number_of_overwritten_records());
+
+    resume_tracing(started);
+
+    return (0);
+}
+
+int trace_dump(void *chan_p)
+{
+    ASSERTN(chan_p != NULL, EINVAL);
+
+    struct trace_header_t header;
+    struct trace_record_t records[READ_CHUNK_SIZE];
+    int8_t started;
+    int offset;
+    ssize_t size;
+
+    /* Pause tracing to get a consistent buffer. */
+    started = pause_tracing();
+
+    header.magic = TRACE_MAGIC;
+    header.version = TRACE_VERSION;
+    header.record_size = sizeof(struct trace_record_t);
+    header.number_of_records = (write_name_records(NULL, NULL)
+                                + trace_get_number_of_records());
+    chan_write(chan_p, &header, sizeof(header));
+    write_name_records(write_record_to_chan, chan_p);
+
+    offset = 0;
+
+    while (1) {
+        size = trace_read(&records[0], offset, membersof(records));
+
+        if (size <= 0) {
+            break;
+        }
+
+        chan_write(chan_p, &records[0], size * sizeof(records[0]));
+        offset += size;
+    }
+
+    resume_tracing(started);
+
+    return (0);
+}
+
+#if defined(ARCH_LINUX)
+
+int trace_set_output_file(const char *path_p)
+{
+    struct trace_header_t header;
+    FILE *output_p;
+
+    output_p = NULL;
+
+    if (path_p != NULL) {
+        output_p = fopen(path_p, "wb");
+
+        if (output_p == NULL) {
+            return (-ENOENT);
+        }
+
+        header.magic = TRACE_MAGIC;
+        header.version = TRACE_VERSION;
+        header.record_size = sizeof(struct trace_record_t);
+        header.number_of_records = 0;
+        fwrite(&header, sizeof(header), 1, output_p);
+    }
+
+    sys_lock();
+
+    if (module.output_p != NULL) {
+        write_name_records(write_record_to_file, module.output_p);
+        fclose(module.output_p);
+    }
+
+    module.output_p = output_p;
+
+    sys_unlock();
+
+    return (0);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,237 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#ifndef __DEBUG_TRACE_H__
+#define __DEBUG_TRACE_H__
+
+#include "simba.h"
+
+/** Trace dump and stream file magic, written in native byte order. */
+#define TRACE_MAGIC                                     0x53545243
+
+/** Trace dump and stream file format version. */
+#define TRACE_VERSION                                            1
+
+/* Trace events. */
+
+/** Four characters of a thread name. ``data`` is the character
+    offset and ``arg`` the characters. Only written in dumps. */
+#define TRACE_EVENT_THRD_NAME                                    0
+/** Context switch. ``thrd`` is the outgoing thread and ``arg`` the
+    incoming thread. */
+#define TRACE_EVENT_THRD_SWITCH                                  1
+/** Interrupt service routine entry. ``arg`` is the routine. */
+#define TRACE_EVENT_ISR_ENTER                                    2
+/** Interrupt service routine exit. ``arg`` is the routine. */
+#define TRACE_EVENT_ISR_EXIT                                     3
+/** A thread started waiting for a semaphore. ``arg`` is the
+    semaphore. */
+#define TRACE_EVENT_SEM_TAKE_WAIT                                4
+/** A thread stopped waiting for a semaphore. ``arg`` is the
+    semaphore. */
+#define TRACE_EVENT_SEM_TAKE_DONE                                5
+/** A thread started waiting for a mutex. ``arg`` is the mutex. */
+#define TRACE_EVENT_MUTEX_LOCK_WAIT                              6
+/** A thread acquired a contended mutex. ``arg`` is the mutex. */
+#define TRACE_EVENT_MUTEX_LOCK_DONE                              7
+/** A thread started waiting for queue data. ``arg`` is the
+    queue. */
+#define TRACE_EVENT_QUEUE_READ_WAIT                              8
+/** A thread stopped waiting for queue data. ``arg`` is the
+    queue. */
+#define TRACE_EVENT_QUEUE_READ_DONE                              9
+/** A thread started waiting for queue space. ``arg`` is the
+    queue. */
+#define TRACE_EVENT_QUEUE_WRITE_WAIT                            10
+/** A thread stopped waiting for queue space. ``arg`` is the
+    queue. */
+#define TRACE_EVENT_QUEUE_WRITE_DONE                            11
+/** CAN frames received. ``data`` is the number of frames and
+    ``arg`` the driver. */
+#define TRACE_EVENT_CAN_INPUT                                   12
+/** First application defined event. */
+#define TRACE_EVENT_USER                                       128
+
+#if CONFIG_TRACE == 1
+/**
+ * Write a trace record from thread context. Expands to nothing if
+ * tracing is disabled at compile time.
+ */
+#    define TRACE(event, data, arg)                             \
+    trace_write(event, data, (uint32_t)(uintptr_t)(arg))
+
+/**
+ * Write a trace record from interrupt context, or with the system
+ * lock taken. Expands to nothing if tracing is disabled at compile
+ * time.
+ */
+#    define TRACE_ISR(event, data, arg)                         \
+    trace_write_isr(event, data, (uint32_t)(uintptr_t)(arg))
+#else
+#    define TRACE(event, data, arg)
+#    define TRACE_ISR(event, data, arg)
+#endif
+
+/**
+ * A trace record. All records have the same size so the trace buffer
+ * can be dumped and parsed without any framing.
+ */
+struct trace_record_t {
+    /** Timestamp in microseconds, wrapping at 2^32. */
+    uint32_t timestamp;
+    uint16_t event;
+    uint16_t data;
+    /** The thread that was running when the record was written. */
+    uint32_t thrd;
+    uint32_t arg;
+};
+
+/**
+ * Header of a binary trace dump or stream. A stream has zero(0)
+ * ``number_of_records`` and lasts until end of file.
+ */
+struct trace_header_t {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t number_of_records;
+};
+
+/**
+ * Initialize the trace module. This function must be called before
+ * calling any other function in this module.
+ *
+ * The module will only be initialized once even if this function is
+ * called multiple times.
+ *
+ * @return zero(0) or negative error code.
+ */
+int trace_module_init(void);
+
+/**
+ * Start recording trace records into the trace buffer. The trace
+ * buffer is cleared.
+ *
+ * @return zero(0) or negative error code.
+ */
+int trace_start(void);
+
+/**
+ * Stop recording trace records. The trace buffer is left untouched
+ * so it can be printed or dumped.
+ *
+ * @return zero(0) or negative error code.
+ */
+int trace_stop(void);
+
+/**
+ * Write a trace record. Use the ``TRACE()`` macro instead of calling
+ * this function directly so the trace point is removed when tracing
+ * is disabled.
+ *
+ * @param[in] event Trace event, one of ``TRACE_EVENT_*``.
+ * @param[in] data Event specific 16 bits data.
+ * @param[in] arg Event specific 32 bits argument.
+ */
+void trace_write(int event, int data, uint32_t arg);
+
+/**
+ * Same as `trace_write()`, but may only be called from interrupt
+ * context or with the system lock taken.
+ */
+void trace_write_isr(int event, int data, uint32_t arg);
+
+/**
+ * Get the number of records in the trace buffer.
+ *
+ * @return Number of records.
+ */
+int trace_get_number_of_records(void);
+
+/**
+ * Get the number of records overwritten since the trace was started.
+ *
+ * @return Number of overwritten records.
+ */
+uint32_t trace_get_number_of_overwritten_records(void);
+
+/**
+ * Copy records from the trace buffer, oldest first.
+ *
+ * @param[out] records_p Records buffer.
+ * @param[in] offset Index of the first record to copy, where zero(0)
+ *                   is the oldest record in the buffer.
+ * @param[in] length Maximum number of records to copy.
+ *
+ * @return Number of copied records or negative error code.
+ */
+ssize_t trace_read(struct trace_record_t *records_p,
+                   int offset,
+                   size_t length);
+
+/**
+ * Print all records in the trace buffer in a human readable format
+ * to given channel.
+ *
+ * @param[in] chan_p Output channel.
+ *
+ * @return zero(0) or negative error code.
+ */
+int trace_print(void *chan_p);
+
+/**
+ * Write a binary dump of the trace buffer to given channel. The dump
+ * is a header followed by thread name records for all threads and
+ * then all records in the trace buffer. Use ``bin/trace.py`` to
+ * convert it to a Chrome trace file.
+ *
+ * @param[in] chan_p Output channel.
+ *
+ * @return zero(0) or negative error code.
+ */
+int trace_dump(void *chan_p);
+
+#if defined(ARCH_LINUX)
+
+/**
+ * Stream all trace records to given file, in addition to writing them
+ * to the trace buffer. The file has the same format as a dump, but
+ * the number of records is unknown and set to zero(0). Thread name
+ * records are appended when the stream is stopped.
+ *
+ * @param[in] path_p File path, or NULL to stop streaming and close
+ *                   the file.
+ *
+ * @return zero(0) or negative error code.
+ */
+int trace_set_output_file(const char *path_p);
+
+#endif
+
+#endif
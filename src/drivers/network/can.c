@@ -30,6 +30,15 @@
 
 #if CONFIG_CAN == 1
 
+struct module_t {
+    int initialized;
+#if CONFIG_CAN_FILTER == 1
+    struct fs_counter_t rx_rejected;
+#endif
+};
+
+static struct module_t module;
+
 #include "can_port.i"
 
 static ssize_t base_chan_read(void *base_p, void *buf_p, size_t size)
@@ -52,6 +61,20 @@ static size_t base_chan_size(void *base_p)
 
 int can_module_init(void)
 {
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+
+#if CONFIG_CAN_FILTER == 1
+    fs_counter_init(&module.rx_rejected,
+                    FSTR("/drivers/can/rx_rejected"),
+                    0);
+    fs_counter_register(&module.rx_rejected);
+#endif
+
     return (can_port_module_init());
 }
 
@@ -77,6 +100,10 @@ int can_init(struct can_driver_t *self_p,
 
     mutex_init(&self_p->mutex);
 
+#if CONFIG_CAN_FILTER == 1
+    can_filter_bank_init(&self_p->filters);
+#endif
+
     return (can_port_init(self_p, dev_p, speed));
 }
 
@@ -116,4 +143,73 @@ ssize_t can_write(struct can_driver_t *self_p,
     return (chan_write(&self_p->base, frame_p, size));
 }
 
+#if CONFIG_CAN_FILTER == 1
+
+int can_filter_add(struct can_driver_t *self_p,
+                   struct can_filter_t *filter_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (can_filter_bank_add(&self_p->filters, filter_p));
+}
+
+int can_filter_remove(struct can_driver_t *self_p,
+                      struct can_filter_t *filter_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (can_filter_bank_remove(&self_p->filters, filter_p));
+}
+
+#endif
+
+RAM_CODE size_t can_input_isr(struct can_driver_t *self_p,
+                              const struct can_frame_t *frames_p,
+                              size_t number_of_frames)
+{
+    size_t i;
+#if CONFIG_CAN_FILTER == 1
+    uint32_t id;
+#endif
+
+    TRACE_ISR(TRACE_EVENT_CAN_INPUT, number_of_frames, self_p);
+
+#if CONFIG_CAN_FILTER == 1
+    /* Filtered frames are never written to the input channel. */
+    if (!can_filter_bank_is_empty_isr(&self_p->filters)) {
+        for (i = 0; i < number_of_frames; i++) {
+            id = frames_p[i].id;
+
+            if (frames_p[i].extended_frame == 1) {
+                id |= CAN_ID_EXTENDED;
+            }
+
+            if (can_filter_bank_dispatch_isr(&self_p->filters,
+                                             id,
+                                             &frames_p[i],
+                                             sizeof(frames_p[i])) == -ENOENT) {
+                fs_counter_increment(&module.rx_rejected, 1);
+            }
+        }
+
+        return (number_of_frames);
+    }
+#endif
+
+    i = MIN(number_of_frames,
+            queue_unused_size_isr(&self_p->chin) / sizeof(*frames_p));
+
+    if (i > 0) {
+        queue_write_isr(&self_p->chin, frames_p, i * sizeof(*frames_p));
+
+        /* Resume any polling thread. */
+        if (chan_is_polled_isr(&self_p->base)) {
+            thrd_resume_isr(self_p->base.reader_p, 0);
+            self_p->base.reader_p = NULL;
+        }
+    }
+
+    return (i);
+}
+
 #endif
@@ -133,4 +133,47 @@ ssize_t can_write(struct can_driver_t *self_p,
                   const struct can_frame_t *frame_p,
                   size_t size);
 
+/**
+ * Add given filter to given driver. Once a filter has been added,
+ * received frames are only written to the subscribers of matching
+ * filters, and no longer to the driver input channel. Frames not
+ * matching any filter are dropped and counted by the counter
+ * ``/drivers/can/rx_rejected``.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[in] filter_p Initialized filter to add.
+ *
+ * @return zero(0) or negative error code, -EEXIST if the filter or
+ *         an equal filter already has been added.
+ */
+int can_filter_add(struct can_driver_t *self_p,
+                   struct can_filter_t *filter_p);
+
+/**
+ * Remove given filter from given driver.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[in] filter_p Filter to remove.
+ *
+ * @return zero(0) or negative error code.
+ */
+int can_filter_remove(struct can_driver_t *self_p,
+                      struct can_filter_t *filter_p);
+
+/**
+ * Pass given received frames to the filters, or to the input channel
+ * if no filter has been added. Called by the ports with the system
+ * lock taken.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[in] frames_p Received frames.
+ * @param[in] number_of_frames Number of received frames.
+ *
+ * @return Number of handled frames. Less than given number of frames
+ *         if the input channel is full.
+ */
+size_t can_input_isr(struct can_driver_t *self_p,
+                     const struct can_frame_t *frames_p,
+                     size_t number_of_frames);
+
 #endif
@@ -0,0 +1,302 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#if CONFIG_CAN_FILTER == 1
+
+static int hash(uint32_t id)
+{
+    return ((id ^ (id >> 5) ^ (id >> 13))
+            & (CONFIG_CAN_FILTER_EXACT_TABLE_SIZE - 1));
+}
+
+static int filter_init(struct can_filter_t *self_p,
+                       int type,
+                       uint32_t id,
+                       uint32_t mask_or_high,
+                       struct can_subscriber_t *subscriber_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(subscriber_p != NULL, EINVAL);
+
+    self_p->type = type;
+    self_p->id = id;
+    self_p->mask = mask_or_high;
+    self_p->subscriber_p = subscriber_p;
+    self_p->next_p = NULL;
+
+    return (0);
+}
+
+/**
+ * Remove given filter from given list, if present.
+ */
+static int filters_remove(struct can_filter_t **list_pp,
+                          struct can_filter_t *filter_p)
+{
+    while (*list_pp != NULL) {
+        if (*list_pp == filter_p) {
+            *list_pp = filter_p->next_p;
+
+            return (0);
+        }
+
+        list_pp = &(*list_pp)->next_p;
+    }
+
+    return (-ENOENT);
+}
+
+/**
+ * Returns true(1) if given filter, or an equal filter, is in given
+ * list. An equal filter would never match as it is evaluated after
+ * the first one.
+ */
+static int filters_contains(struct can_filter_t *list_p,
+                            struct can_filter_t *filter_p)
+{
+    while (list_p != NULL) {
+        if ((list_p == filter_p)
+            || ((list_p->type == filter_p->type)
+                && (list_p->id == filter_p->id)
+                && (list_p->mask == filter_p->mask))) {
+            return (1);
+        }
+
+        list_p = list_p->next_p;
+    }
+
+    return (0);
+}
+
+static int is_match(struct can_filter_t *filter_p, uint32_t id)
+{
+    if (filter_p->type == CAN_FILTER_TYPE_MASK) {
+        return (((id ^ filter_p->id) & filter_p->mask) == 0);
+    } else {
+        return ((id >= filter_p->id) && (id <= filter_p->high));
+    }
+}
+
+int can_subscriber_init(struct can_subscriber_t *self_p,
+                        void *buf_p,
+                        size_t size,
+                        far_string_t dropped_path_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size > 0, EINVAL);
+    ASSERTN(dropped_path_p != NULL, EINVAL);
+
+    queue_init(&self_p->queue, buf_p, size);
+    fs_counter_init(&self_p->dropped, dropped_path_p, 0);
+    fs_counter_register(&self_p->dropped);
+
+    return (0);
+}
+
+ssize_t can_subscriber_read(struct can_subscriber_t *self_p,
+                            void *frame_p,
+                            size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(frame_p != NULL, EINVAL);
+    ASSERTN(size > 0, EINVAL);
+
+    return (queue_read(&self_p->queue, frame_p, size));
+}
+
+int can_filter_init_exact(struct can_filter_t *self_p,
+                          uint32_t id,
+                          struct can_subscriber_t *subscriber_p)
+{
+    return (filter_init(self_p,
+                        CAN_FILTER_TYPE_EXACT,
+                        id,
+                        0,
+                        subscriber_p));
+}
+
+int can_filter_init_mask(struct can_filter_t *self_p,
+                         uint32_t id,
+                         uint32_t mask,
+                         struct can_subscriber_t *subscriber_p)
+{
+    return (filter_init(self_p,
+                        CAN_FILTER_TYPE_MASK,
+                        id,
+                        mask | CAN_ID_EXTENDED,
+                        subscriber_p));
+}
+
+int can_filter_init_range(struct can_filter_t *self_p,
+                          uint32_t low,
+                          uint32_t high,
+                          struct can_subscriber_t *subscriber_p)
+{
+    ASSERTN(low <= high, EINVAL);
+    ASSERTN(((low ^ high) & CAN_ID_EXTENDED) == 0, EINVAL);
+
+    return (filter_init(self_p,
+                        CAN_FILTER_TYPE_RANGE,
+                        low,
+                        high,
+                        subscriber_p));
+}
+
+int can_filter_bank_init(struct can_filter_bank_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    memset(self_p, 0, sizeof(*self_p));
+
+    return (0);
+}
+
+int can_filter_bank_add(struct can_filter_bank_t *self_p,
+                        struct can_filter_t *filter_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(filter_p != NULL, EINVAL);
+
+    struct can_filter_t **list_pp;
+
+    sys_lock();
+
+    if (filter_p->type == CAN_FILTER_TYPE_EXACT) {
+        list_pp = &self_p->exact[hash(filter_p->id)];
+    } else {
+        list_pp = &self_p->list_p;
+    }
+
+    if (filters_contains(*list_pp, filter_p)) {
+        sys_unlock();
+
+        return (-EEXIST);
+    }
+
+    if (filter_p->type == CAN_FILTER_TYPE_EXACT) {
+        filter_p->next_p = *list_pp;
+        *list_pp = filter_p;
+    } else {
+        /* Append to keep the evaluation order. */
+        while (*list_pp != NULL) {
+            list_pp = &(*list_pp)->next_p;
+        }
+
+        filter_p->next_p = NULL;
+        *list_pp = filter_p;
+    }
+
+    self_p->number_of_filters++;
+
+    sys_unlock();
+
+    return (0);
+}
+
+int can_filter_bank_remove(struct can_filter_bank_t *self_p,
+                           struct can_filter_t *filter_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(filter_p != NULL, EINVAL);
+
+    int res;
+
+    sys_lock();
+
+    if (filter_p->type == CAN_FILTER_TYPE_EXACT) {
+        res = filters_remove(&self_p->exact[hash(filter_p->id)], filter_p);
+    } else {
+        res = filters_remove(&self_p->list_p, filter_p);
+    }
+
+    if (res == 0) {
+        self_p->number_of_filters--;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+int can_filter_bank_is_empty_isr(struct can_filter_bank_t *self_p)
+{
+    return (self_p->number_of_filters == 0);
+}
+
+RAM_CODE int can_filter_bank_dispatch_isr(struct can_filter_bank_t *self_p,
+                                          uint32_t id,
+                                          const void *frame_p,
+                                          size_t size)
+{
+    struct can_filter_t *filter_p;
+    struct can_subscriber_t *subscriber_p;
+
+    filter_p = self_p->exact[hash(id)];
+
+    while (filter_p != NULL) {
+        if (filter_p->id == id) {
+            break;
+        }
+
+        filter_p = filter_p->next_p;
+    }
+
+    if (filter_p == NULL) {
+        filter_p = self_p->list_p;
+
+        while (filter_p != NULL) {
+            if (is_match(filter_p, id)) {
+                break;
+            }
+
+            filter_p = filter_p->next_p;
+        }
+
+        if (filter_p == NULL) {
+            return (-ENOENT);
+        }
+    }
+
+    subscriber_p = filter_p->subscriber_p;
+
+    if (queue_unused_size_isr(&subscriber_p->queue) < size) {
+        fs_counter_increment(&subscriber_p->dropped, 1);
+
+        return (-ENOBUFS);
+    }
+
+    queue_write_isr(&subscriber_p->queue, frame_p, size);
+
+    return (0);
+}
+
+#endif
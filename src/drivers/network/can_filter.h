@@ -0,0 +1,224 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#ifndef __DRIVERS_CAN_FILTER_H__
+#define __DRIVERS_CAN_FILTER_H__
+
+#include "simba.h"
+
+/* Filter types. */
+#define CAN_FILTER_TYPE_EXACT                                0
+#define CAN_FILTER_TYPE_MASK                                 1
+#define CAN_FILTER_TYPE_RANGE                                2
+
+/**
+ * Or:ed with a frame id to give the id of an extended (29 bits)
+ * frame. Standard (11 bits) and extended frames with the same id
+ * never match the same filter.
+ */
+#define CAN_ID_EXTENDED                              (1UL << 31)
+
+/**
+ * A subscriber receives all frames matching its filters in its own
+ * queue.
+ */
+struct can_subscriber_t {
+    struct queue_t queue;
+    struct fs_counter_t dropped;
+};
+
+struct can_filter_t {
+    int type;
+    uint32_t id;
+    union {
+        uint32_t mask;
+        uint32_t high;
+    };
+    struct can_subscriber_t *subscriber_p;
+    struct can_filter_t *next_p;
+};
+
+/**
+ * Exact filters in a hash table and mask and range filters in a list,
+ * in the order they were added.
+ */
+struct can_filter_bank_t {
+    struct can_filter_t *exact[CONFIG_CAN_FILTER_EXACT_TABLE_SIZE];
+    struct can_filter_t *list_p;
+    int number_of_filters;
+};
+
+/**
+ * Initialize given subscriber.
+ *
+ * @param[in] self_p Subscriber to initialize.
+ * @param[in] buf_p Frame reception buffer.
+ * @param[in] size Size of the reception buffer in bytes.
+ * @param[in] dropped_path_p File system path of the counter of
+ *                           frames dropped since the reception buffer
+ *                           was full.
+ *
+ * @return zero(0) or negative error code.
+ */
+int can_subscriber_init(struct can_subscriber_t *self_p,
+                        void *buf_p,
+                        size_t size,
+                        far_string_t dropped_path_p);
+
+/**
+ * Read one or more frames from given subscriber. Blocks until the
+ * frame(s) are received.
+ *
+ * @param[in] self_p Initialized subscriber.
+ * @param[out] frame_p Array of read frames.
+ * @param[in] size Size of frames buffer in bytes. Must be a multiple
+ *                 of the driver frame size.
+ *
+ * @return Number of bytes read or negative error code.
+ */
+ssize_t can_subscriber_read(struct can_subscriber_t *self_p,
+                            void *frame_p,
+                            size_t size);
+
+/**
+ * Initialize given filter to match frames with given id.
+ *
+ * @param[in] self_p Filter to initialize.
+ * @param[in] id Frame id, or:ed with ``CAN_ID_EXTENDED`` for an
+ *               extended frame.
+ * @param[in] subscriber_p Subscriber of matching frames.
+ *
+ * @return zero(0) or negative error code.
+ */
+int can_filter_init_exact(struct can_filter_t *self_p,
+                          uint32_t id,
+                          struct can_subscriber_t *subscriber_p);
+
+/**
+ * Initialize given filter to match frames where the id bits set in
+ * given mask equals the corresponding bits in given id. The frame
+ * format is always compared.
+ *
+ * @param[in] self_p Filter to initialize.
+ * @param[in] id Frame id, or:ed with ``CAN_ID_EXTENDED`` to match
+ *               extended frames.
+ * @param[in] mask Id bits to compare.
+ * @param[in] subscriber_p Subscriber of matching frames.
+ *
+ * @return zero(0) or negative error code.
+ */
+int can_filter_init_mask(struct can_filter_t *self_p,
+                         uint32_t id,
+                         uint32_t mask,
+                         struct can_subscriber_t *subscriber_p);
+
+/**
+ * Initialize given filter to match frames with an id in given
+ * inclusive range.
+ *
+ * @param[in] self_p Filter to initialize.
+ * @param[in] low Lowest frame id, or:ed with ``CAN_ID_EXTENDED`` to
+ *                match extended frames.
+ * @param[in] high Highest frame id, in the same frame format as
+ *                 ``low``.
+ * @param[in] subscriber_p Subscriber of matching frames.
+ *
+ * @return zero(0) or negative error code.
+ */
+int can_filter_init_range(struct can_filter_t *self_p,
+                          uint32_t low,
+                          uint32_t high,
+                          struct can_subscriber_t *subscriber_p);
+
+/**
+ * Initialize given filter bank.
+ *
+ * @param[in] self_p Filter bank to initialize.
+ *
+ * @return zero(0) or negative error code.
+ */
+int can_filter_bank_init(struct can_filter_bank_t *self_p);
+
+/**
+ * Add given filter to given filter bank.
+ *
+ * @param[in] self_p Initialized filter bank.
+ * @param[in] filter_p Filter to add.
+ *
+ * @return zero(0) or negative error code, -EEXIST if the filter, or
+ *         a filter with the same type, identifier and mask or range,
+ *         already is in the filter bank.
+ */
+int can_filter_bank_add(struct can_filter_bank_t *self_p,
+                        struct can_filter_t *filter_p);
+
+/**
+ * Remove given filter from given filter bank.
+ *
+ * @param[in] self_p Initialized filter bank.
+ * @param[in] filter_p Filter to remove.
+ *
+ * @return zero(0) or negative error code.
+ */
+int can_filter_bank_remove(struct can_filter_bank_t *self_p,
+                           struct can_filter_t *filter_p);
+
+/**
+ * Check if given filter bank is empty. Drivers pass all frames to
+ * their input channel if it is.
+ *
+ * @param[in] self_p Initialized filter bank.
+ *
+ * @return true(1) if the filter bank has no filters, otherwise
+ *         false(0).
+ */
+int can_filter_bank_is_empty_isr(struct can_filter_bank_t *self_p);
+
+/**
+ * Write given frame to the subscriber of the matching filter. Exact
+ * filters are evaluated first, then mask and range filters in the
+ * order they were added. The frame is only written to the subscriber
+ * of the first matching filter.
+ *
+ * @param[in] self_p Initialized filter bank.
+ * @param[in] id Frame id, or:ed with ``CAN_ID_EXTENDED`` for an
+ *               extended frame.
+ * @param[in] frame_p Frame to write.
+ * @param[in] size Frame size in bytes.
+ *
+ * @return zero(0) if the frame was written to a subscriber,
+ *         -ENOBUFS if the subscriber queue was full, or -ENOENT if
+ *         no filter matched.
+ */
+int can_filter_bank_dispatch_isr(struct can_filter_bank_t *self_p,
+                                 uint32_t id,
+                                 const void *frame_p,
+                                 size_t size);
+
+#endif
@@ -159,6 +159,15 @@ struct spi_frame_t {
     uint8_t canstat;
 } PACKED;
 
+struct module_t {
+    int initialized;
+#if CONFIG_CAN_FILTER == 1
+    struct fs_counter_t rx_rejected;
+#endif
+};
+
+static struct module_t module;
+
 /* Interrupt service routine serving the INT from the hardware. */
 static void isr(struct mcp2515_driver_t *self_p)
 {
@@ -373,6 +382,42 @@ static int speed_to_cnf(int speed,
     return (0);
 }
 
+/**
+ * Write given received frame to the subscriber of the matching
+ * filter, or to the input channel if no filter has been added.
+ */
+static void input(struct mcp2515_driver_t *self_p,
+                  struct mcp2515_frame_t *frame_p)
+{
+#if CONFIG_CAN_FILTER == 1
+    int filtered;
+
+    sys_lock();
+
+    filtered = !can_filter_bank_is_empty_isr(&self_p->filters);
+
+    if (filtered) {
+        if (can_filter_bank_dispatch_isr(&self_p->filters,
+                                         frame_p->id,
+                                         frame_p,
+                                         sizeof(*frame_p)) == -ENOENT) {
+            fs_counter_increment(&module.rx_rejected, 1);
+        }
+    }
+
+    sys_unlock();
+
+    if (filtered) {
+        return;
+    }
+#endif
+
+    /* Write the frame to the input channel. */
+    if (chan_write(self_p->chin_p, frame_p, sizeof(*frame_p)) != sizeof(*frame_p)) {
+        PRINT_FILE_LINE();
+    }
+}
+
 static void *isr_main(void *arg_p)
 {
     struct mcp2515_driver_t *self_p = arg_p;
@@ -408,10 +453,7 @@ static void *isr_main(void *arg_p)
             frame.rtr = spi_frame.rtr;
             memcpy(frame.data, spi_frame.data, frame.size);
 
-            /* Write the frame to the input channel. */
-            if (chan_write(self_p->chin_p, &frame, sizeof(frame)) != sizeof(frame)) {
-                PRINT_FILE_LINE();
-            }
+            input(self_p, &frame);
 
             /* Read status flags. */
             if (read_status(self_p, &status) != 0) {
@@ -436,6 +478,25 @@ static void *isr_main(void *arg_p)
     return (NULL);
 }
 
+int mcp2515_module_init(void)
+{
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+
+#if CONFIG_CAN_FILTER == 1
+    fs_counter_init(&module.rx_rejected,
+                    FSTR("/drivers/mcp2515/rx_rejected"),
+                    0);
+    fs_counter_register(&module.rx_rejected);
+#endif
+
+    return (0);
+}
+
 int mcp2515_init(struct mcp2515_driver_t *self_p,
                  struct spi_device_t *spi_p,
                  struct pin_device_t *cs_p,
@@ -457,6 +518,10 @@ int mcp2515_init(struct mcp2515_driver_t *self_p,
     sem_init(&self_p->isr_sem, 1, 1);
     sem_init(&self_p->tx_sem, 0, 1);
 
+#if CONFIG_CAN_FILTER == 1
+    can_filter_bank_init(&self_p->filters);
+#endif
+
     exti_init(&self_p->exti,
               exti_p,
               EXTI_TRIGGER_FALLING_EDGE,
@@ -584,4 +649,24 @@ ssize_t mcp2515_write(struct mcp2515_driver_t *self_p,
     return (self_p->chout.write(&self_p->chout, frame_p, sizeof(*frame_p)));
 }
 
+#if CONFIG_CAN_FILTER == 1
+
+int mcp2515_filter_add(struct mcp2515_driver_t *self_p,
+                       struct can_filter_t *filter_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (can_filter_bank_add(&self_p->filters, filter_p));
+}
+
+int mcp2515_filter_remove(struct mcp2515_driver_t *self_p,
+                          struct can_filter_t *filter_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (can_filter_bank_remove(&self_p->filters, filter_p));
+}
+
+#endif
+
 #endif
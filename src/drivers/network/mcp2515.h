@@ -58,9 +58,23 @@ struct mcp2515_driver_t {
     struct chan_t *chin_p;
     struct sem_t isr_sem;
     struct sem_t tx_sem;
+#if CONFIG_CAN_FILTER == 1
+    struct can_filter_bank_t filters;
+#endif
     THRD_STACK(stack, 1024);
 };
 
+/**
+ * Initialize the mcp2515 module. This function must be called before
+ * calling any other function in this module.
+ *
+ * The module will only be initialized once even if this function is
+ * called multiple times.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mcp2515_module_init(void);
+
 /**
  * Initialize given driver object.
  *
@@ -123,4 +137,32 @@ ssize_t mcp2515_read(struct mcp2515_driver_t *self_p,
 ssize_t mcp2515_write(struct mcp2515_driver_t *self_p,
                       const struct mcp2515_frame_t *frame_p);
 
+/**
+ * Add given filter to given driver. Once a filter has been added,
+ * received frames are only written to the subscribers of matching
+ * filters, and no longer to the input channel. The subscribers
+ * receive ``struct mcp2515_frame_t`` frames. Frames not matching any
+ * filter are dropped and counted by the counter
+ * ``/drivers/mcp2515/rx_rejected``.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[in] filter_p Initialized filter to add.
+ *
+ * @return zero(0) or negative error code, -EEXIST if the filter or
+ *         an equal filter already has been added.
+ */
+int mcp2515_filter_add(struct mcp2515_driver_t *self_p,
+                       struct can_filter_t *filter_p);
+
+/**
+ * Remove given filter from given driver.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[in] filter_p Filter to remove.
+ *
+ * @return zero(0) or negative error code.
+ */
+int mcp2515_filter_remove(struct mcp2515_driver_t *self_p,
+                          struct can_filter_t *filter_p);
+
 #endif
@@ -63,6 +63,9 @@ struct can_driver_t {
     size_t txsize;
     struct queue_t chin;
     struct mutex_t mutex;
+#if CONFIG_CAN_FILTER == 1
+    struct can_filter_bank_t filters;
+#endif
 };
 
 #endif
@@ -42,6 +42,9 @@ struct can_driver_t {
     struct can_device_t *dev_p;
     struct queue_t chin;
     struct mutex_t mutex;
+#if CONFIG_CAN_FILTER == 1
+    struct can_filter_bank_t filters;
+#endif
 };
 
 #endif
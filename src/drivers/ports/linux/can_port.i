@@ -33,23 +33,11 @@ static ssize_t write_cb(void *arg_p,
                         size_t size)
 {
     struct can_driver_t *self_p;
-    struct can_device_t *dev_p;
-    ssize_t res;
 
     self_p = arg_p;
-    dev_p = self_p->dev_p;
 
-    sys_lock();
-
-    if (socket_device_is_can_device_connected_isr(dev_p) == 1) {
-        res = socket_device_can_device_write_isr(dev_p, buf_p, size);
-    } else {
-        res = size;
-    }
-
-    sys_unlock();
-
-    return (res);
+    /* Do not block other threads while writing to the socket. */
+    return (socket_device_can_device_write(self_p->dev_p, buf_p, size));
 }
 
 static int can_port_module_init()
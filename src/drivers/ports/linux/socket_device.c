@@ -48,6 +48,30 @@
 #define TYPE_CAN_DEVICE_RESPONSE                          (8)
 #define TYPE_I2C_DEVICE_REQUEST                           (9)
 #define TYPE_I2C_DEVICE_RESPONSE                         (10)
+#define TYPE_CAN_DEVICE_BINARY_REQUEST                   (11)
+#define TYPE_CAN_DEVICE_BINARY_RESPONSE                  (12)
+
+/**
+ * A binary can frame is a one byte length followed by the frame id
+ * and data. The length is the number of bytes following it. The
+ * frame id is in network byte order with the most significant bit
+ * set for extended frames.
+ */
+#define CAN_BINARY_EXTENDED_FRAME                 0x80000000
+#define CAN_BINARY_HEADER_SIZE                             5
+#define CAN_BINARY_FRAME_SIZE_MAX   (CAN_BINARY_HEADER_SIZE + 8)
+
+/**
+ * Maximum number of can frames received from the socket and written
+ * to the driver input queue at a time.
+ */
+#define CAN_BATCH_MAX                                     64
+
+/**
+ * Maximum number of bytes received from an uart socket and written
+ * to the driver input queue at a time.
+ */
+#define UART_BATCH_MAX                                   256
 
 /**
  * Convert given device pointer to its index.
@@ -107,6 +131,11 @@ struct pwm_client_t {
 
 struct can_client_t {
     int socket;
+    int binary;
+    /* Held while writing frames to the socket, and while closing or
+       replacing it, so writers never use a closed or reused socket
+       or the wrong format. */
+    pthread_mutex_t write_mutex;
     struct can_device_t *dev_p;
     char name[64];
     pthread_t thrd;
@@ -133,7 +162,7 @@ static void *uart_client_main(void *arg_p)
 {
     struct uart_client_t *client_p;
     ssize_t size;
-    uint8_t byte;
+    uint8_t buf[UART_BATCH_MAX];
 
     client_p = arg_p;
 
@@ -142,18 +171,17 @@ static void *uart_client_main(void *arg_p)
     fflush(stdout);
 
     while (1) {
-        size = read(client_p->socket, &byte, sizeof(byte));
+        /* Read all available data, up to the buffer size. */
+        size = read(client_p->socket, &buf[0], sizeof(buf));
 
-        if (size != sizeof(byte)) {
+        if (size <= 0) {
             break;
         }
 
         sys_lock();
 
         if (client_p->dev_p->drv_p != NULL) {
-            queue_write_isr(&client_p->dev_p->drv_p->base,
-                            &byte,
-                            sizeof(byte));
+            queue_write_isr(&client_p->dev_p->drv_p->base, &buf[0], size);
         }
 
         sys_unlock();
@@ -441,11 +469,160 @@ static int handle_pwm_device_request(struct device_request_t *request_p,
 #endif
 
 /**
- * Handle a can client connection.
+ * Decode given binary can frame of given size, excluding the length
+ * byte.
+ *
+ * @return zero(0) or negative error code.
  */
-static void *can_client_main(void *arg_p)
+static int can_frame_decode_binary(struct can_frame_t *frame_p,
+                                   const uint8_t *buf_p,
+                                   size_t size)
+{
+    uint32_t id;
+
+    if ((size < CAN_BINARY_HEADER_SIZE - 1)
+        || (size > CAN_BINARY_FRAME_SIZE_MAX - 1)) {
+        return (-EINVAL);
+    }
+
+    memcpy(&id, buf_p, sizeof(id));
+    id = ntohl(id);
+    frame_p->id = (id & ~CAN_BINARY_EXTENDED_FRAME);
+    frame_p->extended_frame = ((id & CAN_BINARY_EXTENDED_FRAME) != 0);
+    frame_p->size = (size - sizeof(id));
+    memcpy(&frame_p->data.u8[0], &buf_p[sizeof(id)], frame_p->size);
+
+    return (0);
+}
+
+/**
+ * Encode given can frame in binary format.
+ *
+ * @return Number of encoded bytes.
+ */
+static size_t can_frame_encode_binary(uint8_t *buf_p,
+                                      const struct can_frame_t *frame_p)
+{
+    uint32_t id;
+
+    id = frame_p->id;
+
+    if (frame_p->extended_frame == 1) {
+        id |= CAN_BINARY_EXTENDED_FRAME;
+    }
+
+    id = htonl(id);
+    buf_p[0] = (sizeof(id) + frame_p->size);
+    memcpy(&buf_p[1], &id, sizeof(id));
+    memcpy(&buf_p[CAN_BINARY_HEADER_SIZE],
+           &frame_p->data.u8[0],
+           frame_p->size);
+
+    return (CAN_BINARY_HEADER_SIZE + frame_p->size);
+}
+
+/**
+ * Pass given frames to the driver filters or input queue. Only
+ * complete frames are written, and the client is not read while the
+ * input queue is full, so a fast client is throttled instead of
+ * frames being dropped. Filter subscribers are not throttled.
+ */
+static void can_client_binary_write(struct can_client_t *client_p,
+                                    const struct can_frame_t *frames_p,
+                                    size_t number_of_frames)
+{
+    struct can_driver_t *drv_p;
+    size_t number_of_written_frames;
+
+    while (number_of_frames > 0) {
+        sys_lock();
+
+        drv_p = client_p->dev_p->drv_p;
+
+        if (drv_p == NULL) {
+            number_of_frames = 0;
+            number_of_written_frames = 0;
+        } else {
+            number_of_written_frames = can_input_isr(drv_p,
+                                                     frames_p,
+                                                     number_of_frames);
+        }
+
+        sys_unlock();
+
+        frames_p += number_of_written_frames;
+        number_of_frames -= number_of_written_frames;
+
+        /* Give the application some time to read frames if the queue
+           is full. */
+        if (number_of_frames > 0) {
+            usleep(1000);
+        }
+    }
+}
+
+/**
+ * Receive binary can frames from the client. All complete frames
+ * received by a single read are decoded and written to the driver
+ * input queue with the system lock taken only once.
+ */
+static void can_client_binary(struct can_client_t *client_p)
+{
+    ssize_t size;
+    uint8_t buf[CAN_BATCH_MAX * CAN_BINARY_FRAME_SIZE_MAX];
+    struct can_frame_t frames[CAN_BATCH_MAX];
+    size_t number_of_frames;
+    size_t length;
+    size_t offset;
+    size_t pos;
+
+    length = 0;
+
+    while (1) {
+        size = read(client_p->socket, &buf[length], sizeof(buf) - length);
+
+        if (size <= 0) {
+            break;
+        }
+
+        length += size;
+        number_of_frames = 0;
+        pos = 0;
+
+        /* Decode all complete frames, up to the batch size. */
+        while ((pos < length) && (number_of_frames < CAN_BATCH_MAX)) {
+            offset = (pos + 1 + buf[pos]);
+
+            if (offset > length) {
+                break;
+            }
+
+            if (can_frame_decode_binary(&frames[number_of_frames],
+                                        &buf[pos + 1],
+                                        buf[pos]) == 0) {
+                number_of_frames++;
+            } else {
+                printf("warning: bad binary can frame size %d\n",
+                       (int)buf[pos]);
+                fflush(stdout);
+            }
+
+            pos = offset;
+        }
+
+        /* Keep any partial frame for the next read. */
+        length -= pos;
+        memmove(&buf[0], &buf[pos], length);
+
+        can_client_binary_write(client_p, &frames[0], number_of_frames);
+    }
+}
+
+/**
+ * Receive can frames as text lines from the client.
+ */
+static void can_client_text(struct can_client_t *client_p)
 {
-    struct can_client_t *client_p;
     ssize_t size;
     char buf[64];
     struct can_frame_t frame;
@@ -454,12 +631,6 @@ static void *can_client_main(void *arg_p)
     size_t i;
     int extended_frame;
 
-    client_p = arg_p;
-
-    printf("socket_device: can device %s connected\n",
-           &client_p->name[0]);
-    fflush(stdout);
-
     while (1) {
         size = read(client_p->socket, &buf[0], 35);
 
@@ -537,16 +708,37 @@ static void *can_client_main(void *arg_p)
         sys_lock();
 
         if (client_p->dev_p->drv_p != NULL) {
-            queue_write_isr(&client_p->dev_p->drv_p->chin,
-                            &frame,
-                            sizeof(frame));
+            (void)can_input_isr(client_p->dev_p->drv_p, &frame, 1);
         }
 
         sys_unlock();
     }
+}
+
+/**
+ * Handle a can client connection.
+ */
+static void *can_client_main(void *arg_p)
+{
+    struct can_client_t *client_p;
+
+    client_p = arg_p;
+
+    printf("socket_device: can device %s connected%s\n",
+           &client_p->name[0],
+           client_p->binary ? " (binary)" : "");
+    fflush(stdout);
+
+    if (client_p->binary == 1) {
+        can_client_binary(client_p);
+    } else {
+        can_client_text(client_p);
+    }
 
+    pthread_mutex_lock(&client_p->write_mutex);
     close(client_p->socket);
     client_p->socket = -2;
+    pthread_mutex_unlock(&client_p->write_mutex);
 
     printf("socket_device: can device %s disconnected\n",
            &client_p->name[0]);
@@ -556,7 +748,8 @@ static void *can_client_main(void *arg_p)
 }
 
 static int handle_can_device_request(struct device_request_t *request_p,
-                                      int client)
+                                      int client,
+                                      int binary)
 {
     struct device_response_t response;
     int res;
@@ -573,7 +766,12 @@ static int handle_can_device_request(struct device_request_t *request_p,
     }
 
     /* Prepare the response. */
-    response.header.type = htonl(TYPE_CAN_DEVICE_RESPONSE);
+    if (binary == 1) {
+        response.header.type = htonl(TYPE_CAN_DEVICE_BINARY_RESPONSE);
+    } else {
+        response.header.type = htonl(TYPE_CAN_DEVICE_RESPONSE);
+    }
+
     response.header.size = htonl(4);
 
     if ((index < 0) || (index >= CAN_DEVICE_MAX)) {
@@ -599,9 +797,12 @@ static int handle_can_device_request(struct device_request_t *request_p,
 
     /* Start the client thread if everything went well so far. */
     if (res == sizeof(response)) {
-        can_clients[index].socket = client;
+        pthread_mutex_lock(&can_clients[index].write_mutex);
+        can_clients[index].binary = binary;
         can_clients[index].dev_p = &can_device[index];
         strcpy(&can_clients[index].name[0], device_p);
+        can_clients[index].socket = client;
+        pthread_mutex_unlock(&can_clients[index].write_mutex);
         res = pthread_create(&can_clients[index].thrd,
                              NULL,
                              can_client_main,
@@ -856,7 +1057,9 @@ static void *listener_main(void *arg_p)
             res = handle_pwm_device_request(&request, client);
 #endif
         } else if (request.header.type == TYPE_CAN_DEVICE_REQUEST) {
-            res = handle_can_device_request(&request, client);
+            res = handle_can_device_request(&request, client, 0);
+        } else if (request.header.type == TYPE_CAN_DEVICE_BINARY_REQUEST) {
+            res = handle_can_device_request(&request, client, 1);
         } else if (request.header.type == TYPE_I2C_DEVICE_REQUEST) {
             res = handle_i2c_device_request(&request, client);
         } else {
@@ -900,6 +1103,7 @@ int socket_device_module_init()
 
     for (i = 0; i < membersof(can_clients); i++) {
         can_clients[i].socket = -1;
+        pthread_mutex_init(&can_clients[i].write_mutex, NULL);
     }
 
     for (i = 0; i < membersof(i2c_clients); i++) {
@@ -986,49 +1190,68 @@ int socket_device_is_can_device_connected_isr(
     return (client >= 0);
 }
 
-ssize_t socket_device_can_device_write_isr(const struct can_device_t *dev_p,
-                                           const void *buf_p,
-                                           size_t size)
+ssize_t socket_device_can_device_write(const struct can_device_t *dev_p,
+                                       const void *buf_p,
+                                       size_t size)
 {
     const struct can_frame_t *frame_p;
-    char buf[64];
+    char buf[CAN_BATCH_MAX * 64];
+    size_t number_of_frames;
+    size_t pos;
     ssize_t res;
+    struct can_client_t *client_p;
     int socket;
-    size_t i;
+    int binary;
 
-    socket = can_clients[CAN_INDEX(dev_p)].socket;
+    client_p = &can_clients[CAN_INDEX(dev_p)];
+    frame_p = buf_p;
+    number_of_frames = (size / sizeof(*frame_p));
+    pos = 0;
 
-    frame_p = (struct can_frame_t *)buf_p;
+    pthread_mutex_lock(&client_p->write_mutex);
+    socket = client_p->socket;
+    binary = client_p->binary;
 
-    /* Format the line to send to the client. */
-    sprintf(&buf[0],
-            "id=%08x,extended=%d,size=%d,data=",
-            frame_p->id,
-            (int)frame_p->extended_frame,
-            (int)frame_p->size);
+    /* Drop the frames if no client is connected. */
+    if (socket < 0) {
+        number_of_frames = 0;
+    }
 
-    res = write(socket, &buf[0], strlen(&buf[0]));
+    /* Encode the frames and write up to CAN_BATCH_MAX of them at a
+       time. */
+    while (number_of_frames > 0) {
+        if (binary == 1) {
+            pos += can_frame_encode_binary((uint8_t *)&buf[pos], frame_p);
+        } else {
+            pos += sprintf(&buf[pos],
+                           "id=%08x,extended=%d,size=%d,data=",
+                           frame_p->id,
+                           (int)frame_p->extended_frame,
+                           (int)frame_p->size);
+            pos += hex_from_bin(&buf[pos],
+                                &frame_p->data.u8[0],
+                                frame_p->size);
+            pos += sprintf(&buf[pos], "\r\n");
+        }
 
-    if (res != strlen(&buf[0])) {
-        return (-1);
-    }
+        frame_p++;
+        number_of_frames--;
 
-    /* Write the data, one byte at a time. */
-    for (i = 0; i < frame_p->size; i++) {
-        sprintf(&buf[0], "%02x", frame_p->data.u8[i]);
+        if ((number_of_frames == 0) || (pos > sizeof(buf) - 64)) {
+            /* The client may have disconnected, but the client
+               thread has not yet noticed. Drop the frames instead of
+               raising SIGPIPE. */
+            res = send(socket, &buf[0], pos, MSG_NOSIGNAL);
 
-        res = write(socket, &buf[0], 2);
+            if (res != pos) {
+                break;
+            }
 
-        if (res != 2) {
-            return (-1);
+            pos = 0;
         }
     }
 
-    res = write(socket, "\r\n", 2);
-
-    if (res != 2) {
-        return (-1);
-    }
+    pthread_mutex_unlock(&client_p->write_mutex);
 
     return (size);
 }
@@ -1048,41 +1271,40 @@ ssize_t socket_device_i2c_device_write_isr(const struct i2c_device_t *dev_p,
                                            const void *buf_p,
                                            size_t size)
 {
-    char buf[64];
+    char buf[256];
     ssize_t res;
     int socket;
-    size_t i;
+    size_t pos;
+    size_t n;
     const uint8_t *byte_p;
 
     socket = i2c_clients[I2C_INDEX(dev_p)].socket;
 
     /* Write the address. */
-    sprintf(&buf[0], "address=%04x,size=%04lx,data=", address, size);
-
-    res = write(socket, &buf[0], strlen(&buf[0]));
-
-    if (res != strlen(&buf[0])) {
-        return (-1);
-    }
+    pos = sprintf(&buf[0], "address=%04x,size=%04lx,data=", address, size);
 
-    /* Write the data, one byte at a time. */
+    /* Write the data, as many bytes at a time as fits in the
+       buffer. */
     byte_p = buf_p;
 
-    for (i = 0; i < size; i++) {
-        sprintf(&buf[0], "%02x", byte_p[i]);
+    do {
+        n = MIN(size, (sizeof(buf) - pos - 3) / 2);
+        pos += hex_from_bin(&buf[pos], byte_p, n);
+        byte_p += n;
+        size -= n;
 
-        res = write(socket, &buf[0], 2);
+        if (size == 0) {
+            pos += sprintf(&buf[pos], "\r\n");
+        }
 
-        if (res != 2) {
+        res = write(socket, &buf[0], pos);
+
+        if (res != pos) {
             return (-1);
         }
-    }
 
-    res = write(socket, "\r\n", 2);
+        pos = 0;
+    } while (size > 0);
 
-    if (res != 2) {
-        return (-1);
-    }
-
-    return (size);
+    return (byte_p - (const uint8_t *)buf_p);
 }
@@ -123,7 +123,12 @@ int socket_device_is_can_device_connected_isr(
     const struct can_device_t *dev_p);
 
 /**
- * Write data to given can device.
+ * Write data to given can device. All frames in the buffer are sent
+ * to the client, in binary or text format depending on the format
+ * requested by the client. The frames are dropped if no client is
+ * connected, or if the client disconnects during the write. Must be
+ * called without the system lock taken, as writing to the socket may
+ * block.
  *
  * @param[in] dev_p Can device.
  * @param[in] buf_p Buffer to write.
@@ -131,9 +136,9 @@ int socket_device_is_can_device_connected_isr(
  *
  * @return Number of bytes written, or negative error code.
  */
-ssize_t socket_device_can_device_write_isr(const struct can_device_t *dev_p,
-                                           const void *buf_p,
-                                           size_t size);
+ssize_t socket_device_can_device_write(const struct can_device_t *dev_p,
+                                       const void *buf_p,
+                                       size_t size);
 
 /**
  * Check if a client is connected for given i2c device.
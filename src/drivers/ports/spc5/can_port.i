@@ -68,18 +68,9 @@ static void read_frame_from_hw(struct can_driver_t *self_p,
         msgbuf_p->CTRL_STATUS = SPC5_FLEXCAN_MSGBUF_CTRL_STATUS_CODE(4);
     }
 
-    /* Write the received frame to the application input channel. */
-    if (queue_unused_size_isr(&self_p->chin) >= sizeof(frame)) {
-        queue_write_isr(&self_p->chin,
-                        &frame,
-                        sizeof(frame));
-
-        /* Resume any polling thread. */
-        if (chan_is_polled_isr(&self_p->base)) {
-            thrd_resume_isr(self_p->base.reader_p, 0);
-            self_p->base.reader_p = NULL;
-        }
-    } else {
+    /* Pass the received frame to the filters or the application
+       input channel. */
+    if (can_input_isr(self_p, &frame, 1) != 1) {
         fs_counter_increment(&rx_channel_overflow, 1);
     }
 }
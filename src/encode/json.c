@@ -56,6 +56,29 @@
 
 #include "simba.h"
 
+/* Key hash index states. */
+#define INDEX_STATE_STALE                                   0
+#define INDEX_STATE_BUILT                                   1
+#define INDEX_STATE_FAILED                                 -1
+
+/* Streaming reader states. */
+#define READER_STATE_VALUE                                  0
+#define READER_STATE_VALUE_OR_END                           1
+#define READER_STATE_KEY                                    2
+#define READER_STATE_KEY_OR_END                             3
+#define READER_STATE_KEY_STRING                             4
+#define READER_STATE_KEY_STRING_ESCAPE                      5
+#define READER_STATE_COLON                                  6
+#define READER_STATE_STRING                                 7
+#define READER_STATE_STRING_ESCAPE                          8
+#define READER_STATE_PRIMITIVE                              9
+#define READER_STATE_AFTER_VALUE                           10
+#define READER_STATE_DONE                                  11
+#define READER_STATE_ERROR                                 12
+
+/* Maximum nesting depth of the streaming writer. */
+#define WRITER_DEPTH_MAX                                   32
+
 struct dump_t {
     struct json_t *self_p;
     struct json_tok_t *tokens_p;
@@ -69,7 +92,13 @@ struct string_t {
     char *buf_p;
 };
 
+/* Characters ending a span of plain string characters. */
+static const char string_delimiters[] = { '\"', '\\', '\0' };
+
+static const char whitespace[] = { ' ', '\t', '\r', '\n' };
+
 static ssize_t dump(struct dump_t *state_p);
+static int reader_input(struct json_reader_t *self_p, char c);
 
 /**
  * Copy given buffer to the output buffer. It is not null terminated.
@@ -100,6 +129,7 @@ static struct json_tok_t *alloc_token(struct json_t *self_p)
     tok_p->buf_p = NULL;
     tok_p->size = -1;
     tok_p->num_tokens = 0;
+    tok_p->num_descendants = -1;
 #ifdef JSON_PARENT_LINKS
     tok_p->parent = -1;
 #endif
@@ -371,11 +401,20 @@ static int parse_string(struct json_t *self_p,
 
     int start = self_p->pos;
 
+    /* Skip starting quote */
     self_p->pos++;
 
-    /* Skip starting quote */
-    for (; ((self_p->pos < len)
-            && (js_p[self_p->pos] != '\0')); self_p->pos++) {
+    while (1) {
+        /* Skip plain characters in as few steps as possible. */
+        self_p->pos += std_memcspn(&js_p[self_p->pos],
+                                   len - self_p->pos,
+                                   &string_delimiters[0],
+                                   sizeof(string_delimiters));
+
+        if ((self_p->pos == len) || (js_p[self_p->pos] == '\0')) {
+            break;
+        }
+
         char c = js_p[self_p->pos];
 
         /* Quote: end of string */
@@ -456,6 +495,8 @@ static int parse_string(struct json_t *self_p,
                 return (JSON_ERROR_INVAL);
             }
         }
+
+        self_p->pos++;
     }
 
     self_p->pos = start;
@@ -487,6 +528,204 @@ static int get_number_of_children(struct json_tok_t *token_p)
     return (number_of_children);
 }
 
+/**
+ * Get the token following given token and all its descendants.
+ */
+static struct json_tok_t *get_next_sibling(struct json_tok_t *token_p)
+{
+    int number_of_children;
+
+    if (token_p->num_descendants >= 0) {
+        number_of_children = token_p->num_descendants;
+    } else {
+        number_of_children = get_number_of_children(token_p);
+    }
+
+    return (token_p + number_of_children + 1);
+}
+
+/**
+ * Calculate the number of descendants of all parsed tokens in a
+ * single pass. Children are always found after their parent, so
+ * iterating backwards makes the descendants of all children known
+ * when their parent is visited.
+ */
+static void update_descendants(struct json_t *self_p)
+{
+    int i;
+    int j;
+    int k;
+    int toknext;
+    struct json_tok_t *token_p;
+
+    toknext = self_p->toknext;
+
+    for (i = toknext - 1; i >= 0; i--) {
+        token_p = &self_p->tokens_p[i];
+        j = (i + 1);
+
+        for (k = 0; (k < token_p->num_tokens) && (j < toknext); k++) {
+            j += (self_p->tokens_p[j].num_descendants + 1);
+        }
+
+        if (j > toknext) {
+            j = toknext;
+        }
+
+        token_p->num_descendants = (j - i - 1);
+    }
+}
+
+static int is_key_equal(struct json_tok_t *token_p,
+                        const char *key_p,
+                        int key_length)
+{
+    return ((token_p->size == key_length)
+            && (memcmp(token_p->buf_p, key_p, key_length) == 0));
+}
+
+/**
+ * FNV-1a hash of given key, mixed with given object token index.
+ */
+static uint32_t hash_key(int object, const char *key_p, int key_length)
+{
+    uint32_t hash;
+    int i;
+
+    hash = (2166136261UL ^ ((uint32_t)object * 2654435761UL));
+
+    for (i = 0; i < key_length; i++) {
+        hash ^= (uint8_t)key_p[i];
+        hash *= 16777619UL;
+    }
+
+    return (hash);
+}
+
+/**
+ * Add all keys of all parsed objects to the key hash index.
+ */
+static int index_build(struct json_t *self_p)
+{
+    int i;
+    int object;
+    int number_of_keys;
+    uint32_t pos;
+    struct json_tok_t *object_p;
+    struct json_tok_t *key_p;
+    struct json_index_entry_t *entries_p;
+
+    entries_p = self_p->index.entries_p;
+
+    for (i = 0; i < self_p->index.length; i++) {
+        entries_p[i].object = -1;
+    }
+
+    number_of_keys = 0;
+
+    for (object = 0; object < self_p->toknext; object++) {
+        object_p = &self_p->tokens_p[object];
+
+        /* Descendants are only known after a successful parse. */
+        if (object_p->num_descendants < 0) {
+            return (-1);
+        }
+
+        if (object_p->type != JSON_OBJECT) {
+            continue;
+        }
+
+        key_p = (object_p + 1);
+
+        for (i = 0; i < object_p->num_tokens; i++) {
+            if (key_p >= &self_p->tokens_p[self_p->toknext]) {
+                break;
+            }
+
+            /* Keep the load factor at or below 3/4. */
+            number_of_keys++;
+
+            if (4 * number_of_keys > 3 * self_p->index.length) {
+                return (-1);
+            }
+
+            pos = (hash_key(object, key_p->buf_p, key_p->size)
+                   % self_p->index.length);
+
+            while (entries_p[pos].object != -1) {
+                pos = ((pos + 1) % self_p->index.length);
+            }
+
+            entries_p[pos].object = object;
+            entries_p[pos].key = (key_p - self_p->tokens_p);
+            key_p = get_next_sibling(key_p);
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * Get the value of given key in given object using the key hash
+ * index.
+ */
+static struct json_tok_t *index_get(struct json_t *self_p,
+                                    const char *key_p,
+                                    int key_length,
+                                    int object,
+                                    int type)
+{
+    uint32_t pos;
+    struct json_tok_t *token_p;
+    struct json_index_entry_t *entry_p;
+
+    pos = (hash_key(object, key_p, key_length) % self_p->index.length);
+    entry_p = &self_p->index.entries_p[pos];
+
+    while (entry_p->object != -1) {
+        if (entry_p->object == object) {
+            token_p = &self_p->tokens_p[entry_p->key];
+
+            if ((token_p->type == type)
+                && is_key_equal(token_p, key_p, key_length)) {
+                return (token_p + 1);
+            }
+        }
+
+        pos = ((pos + 1) % self_p->index.length);
+        entry_p = &self_p->index.entries_p[pos];
+    }
+
+    return (NULL);
+}
+
+/**
+ * Returns true(1) if the key hash index can be used to get values
+ * from given object, otherwise false(0).
+ */
+static int index_is_usable(struct json_t *self_p,
+                           struct json_tok_t *object_p)
+{
+    if (self_p->index.entries_p == NULL) {
+        return (0);
+    }
+
+    if ((object_p < self_p->tokens_p)
+        || (object_p >= &self_p->tokens_p[self_p->toknext])) {
+        return (0);
+    }
+
+    if (self_p->index.state == INDEX_STATE_STALE) {
+        if (index_build(self_p) == 0) {
+            self_p->index.state = INDEX_STATE_BUILT;
+        } else {
+            self_p->index.state = INDEX_STATE_FAILED;
+        }
+    }
+
+    return (self_p->index.state == INDEX_STATE_BUILT);
+}
+
 static struct json_tok_t *object_get(struct json_t *self_p,
                                      const char *key_p,
                                      struct json_tok_t *object_p,
@@ -497,7 +736,6 @@ static struct json_tok_t *object_get(struct json_t *self_p,
 
     int i;
     int key_length;
-    int number_of_children;
     struct json_tok_t *token_p;
 
     /* Return immediatly if no object is found. */
@@ -512,152 +750,801 @@ static struct json_tok_t *object_get(struct json_t *self_p,
 
     key_length = strlen(key_p);
 
+    if (index_is_usable(self_p, object_p)) {
+        return (index_get(self_p,
+                          key_p,
+                          key_length,
+                          object_p - self_p->tokens_p,
+                          type));
+    }
+
     /* The first child token. */
     token_p = (object_p + 1);
 
     /* Find given key in the object. */
     for (i = 0; i < object_p->num_tokens; i++) {
         if (token_p->type == type) {
-            if (strncmp(key_p, token_p->buf_p, key_length) == 0) {
+            if (is_key_equal(token_p, key_p, key_length)) {
                 return (token_p + 1);
             }
         }
 
         /* Get the next child token. */
-        number_of_children = get_number_of_children(token_p);
-        token_p += (number_of_children + 1);
+        token_p = get_next_sibling(token_p);
     }
 
     return (NULL);
 }
 
-int json_init(struct json_t *self_p,
-              struct json_tok_t *tokens_p,
-              int num_tokens)
+static int is_whitespace(char c)
 {
-    ASSERTN(self_p != NULL, EINVAL);
-    ASSERTN(((tokens_p != NULL) && (num_tokens > 0))
-            || (num_tokens == 0), EINVAL);
+    return ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'));
+}
 
-    self_p->pos = 0;
-    self_p->toknext = 0;
-    self_p->toksuper = -1;
-    self_p->tokens_p = tokens_p;
-    self_p->num_tokens = num_tokens;
+static int is_escape_valid(char c)
+{
+    switch (c) {
+
+    case '\"':
+    case '/':
+    case '\\':
+    case 'b':
+    case 'f':
+    case 'r':
+    case 'n':
+    case 't':
+    case 'u':
+        return (1);
 
-    return (0);
+    default:
+        return (0);
+    }
 }
 
-int json_parse(struct json_t *self_p,
-               const char *js_p,
-               size_t len)
+/**
+ * Call the event callback with the current path.
+ */
+static int reader_emit(struct json_reader_t *self_p,
+                       enum json_event_t event,
+                       const char *buf_p,
+                       size_t size)
 {
-    ASSERTN(self_p != NULL, EINVAL);
-    ASSERTN(js_p != NULL, EINVAL);
-    ASSERTN(len > 0, EINVAL);
+    self_p->path[self_p->path_length] = '\0';
 
-    int r;
-    int i;
-    struct json_tok_t *token_p;
-    int count;
+    return (self_p->on_event(self_p->arg_p,
+                             event,
+                             &self_p->path[0],
+                             buf_p,
+                             size));
+}
 
-    count = self_p->toknext;
+/**
+ * Append given character to the path.
+ */
+static int reader_path_append(struct json_reader_t *self_p, char c)
+{
+    if (self_p->path_length >= sizeof(self_p->path) - 1) {
+        return (JSON_ERROR_NOMEM);
+    }
 
-    for (; ((self_p->pos < len)
-            && (js_p[self_p->pos] != '\0')); self_p->pos++) {
-        char c;
-        enum json_type_t type;
+    self_p->path[self_p->path_length++] = c;
 
-        c = js_p[self_p->pos];
+    return (0);
+}
 
-        switch (c) {
+/**
+ * Append given key character to the path, escaped as in a JSON
+ * pointer.
+ */
+static int reader_path_append_key(struct json_reader_t *self_p, char c)
+{
+    int res;
 
-        case '{':
-        case '[':
-            count++;
+    switch (c) {
 
-            if (self_p->tokens_p == NULL) {
-                break;
-            }
+    case '~':
+        res = reader_path_append(self_p, '~');
 
-            token_p = alloc_token(self_p);
+        if (res == 0) {
+            res = reader_path_append(self_p, '0');
+        }
 
-            if (token_p == NULL) {
-                return (JSON_ERROR_NOMEM);
-            }
+        break;
 
-            if (self_p->toksuper != -1) {
-                self_p->tokens_p[self_p->toksuper].num_tokens++;
-#ifdef JSON_PARENT_LINKS
-                token_p->parent = self_p->toksuper;
-#endif
-            }
+    case '/':
+        res = reader_path_append(self_p, '~');
 
-            token_p->type = (c == '{' ? JSON_OBJECT : JSON_ARRAY);
-            token_p->buf_p = js_p + self_p->pos;
-            self_p->toksuper = self_p->toknext - 1;
-            break;
+        if (res == 0) {
+            res = reader_path_append(self_p, '1');
+        }
 
-        case '}':
-        case ']':
-            if (self_p->tokens_p == NULL) {
-                break;
-            }
+        break;
 
-            type = (c == '}' ? JSON_OBJECT : JSON_ARRAY);
+    default:
+        res = reader_path_append(self_p, c);
+        break;
+    }
 
-#ifdef JSON_PARENT_LINKS
-            if (self_p->toknext < 1) {
-                return (JSON_ERROR_INVAL);
-            }
+    return (res);
+}
 
-            token = &tokens_p[self_p->toknext - 1];
+/**
+ * A value begins. Array elements add their index to the path, while
+ * object members already added their key.
+ */
+static int reader_begin_value(struct json_reader_t *self_p)
+{
+    struct json_reader_level_t *level_p;
+    char buf[12];
+    int size;
+    int res;
+    int i;
 
-            for (;;) {
-                if ((token_p->start != -1) && (token_p->end == -1)) {
-                    if (token_p->type != type) {
-                        return (JSON_ERROR_INVAL);
-                    }
+    if (self_p->depth == 0) {
+        return (0);
+    }
 
-                    token_p->size = (&js_p[self_p->pos]
-                                     - self_p->buf_p + 1);
-                    self_p->toksuper = token_p->parent;
-                    break;
-                }
+    level_p = &self_p->levels[self_p->depth - 1];
 
-                if (token_p->parent == -1) {
-                    break;
-                }
+    if (level_p->type != JSON_ARRAY) {
+        return (0);
+    }
 
-                token = &tokens_p[token_p->parent];
-            }
-#else
-            for (i = self_p->toknext - 1; i >= 0; i--) {
-                token_p = &self_p->tokens_p[i];
+    size = std_sprintf(&buf[0], FSTR("/%d"), level_p->index);
 
-                if ((token_p->buf_p != NULL) && (token_p->size == -1)) {
-                    if (token_p->type != type) {
-                        return (JSON_ERROR_INVAL);
-                    }
+    for (i = 0; i < size; i++) {
+        res = reader_path_append(self_p, buf[i]);
 
-                    self_p->toksuper = -1;
-                    token_p->size = (&js_p[self_p->pos]
-                                     - token_p->buf_p + 1);
-                    break;
-                }
-            }
+        if (res != 0) {
+            return (res);
+        }
+    }
 
-            /* Error if unmatched closing bracket */
-            if (i == -1) {
-                return (JSON_ERROR_INVAL);
-            }
+    return (0);
+}
 
-            for (; i >= 0; i--) {
-                token_p = &self_p->tokens_p[i];
+/**
+ * A value ended. Remove it from the path.
+ */
+static void reader_end_value(struct json_reader_t *self_p)
+{
+    struct json_reader_level_t *level_p;
 
-                if ((token_p->buf_p != NULL) && (token_p->size == -1)) {
-                    self_p->toksuper = i;
-                    break;
+    if (self_p->depth == 0) {
+        self_p->path_length = 0;
+        self_p->state = READER_STATE_DONE;
+
+        return;
+    }
+
+    level_p = &self_p->levels[self_p->depth - 1];
+    level_p->index++;
+    self_p->path_length = level_p->path_length;
+    self_p->state = READER_STATE_AFTER_VALUE;
+}
+
+static int reader_begin_container(struct json_reader_t *self_p,
+                                  enum json_type_t type)
+{
+    struct json_reader_level_t *level_p;
+    int res;
+
+    if (self_p->depth == membersof(self_p->levels)) {
+        return (JSON_ERROR_NOMEM);
+    }
+
+    res = reader_begin_value(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    level_p = &self_p->levels[self_p->depth];
+    level_p->type = type;
+    level_p->index = 0;
+    level_p->path_length = self_p->path_length;
+    self_p->depth++;
+
+    if (type == JSON_OBJECT) {
+        self_p->state = READER_STATE_KEY_OR_END;
+        res = reader_emit(self_p, JSON_EVENT_OBJECT_BEGIN, NULL, 0);
+    } else {
+        self_p->state = READER_STATE_VALUE_OR_END;
+        res = reader_emit(self_p, JSON_EVENT_ARRAY_BEGIN, NULL, 0);
+    }
+
+    return (res);
+}
+
+static int reader_end_container(struct json_reader_t *self_p,
+                                enum json_type_t type)
+{
+    struct json_reader_level_t *level_p;
+    int res;
+
+    if (self_p->depth == 0) {
+        return (JSON_ERROR_INVAL);
+    }
+
+    level_p = &self_p->levels[self_p->depth - 1];
+
+    if (level_p->type != type) {
+        return (JSON_ERROR_INVAL);
+    }
+
+    self_p->depth--;
+    self_p->path_length = level_p->path_length;
+
+    if (type == JSON_OBJECT) {
+        res = reader_emit(self_p, JSON_EVENT_OBJECT_END, NULL, 0);
+    } else {
+        res = reader_emit(self_p, JSON_EVENT_ARRAY_END, NULL, 0);
+    }
+
+    reader_end_value(self_p);
+
+    return (res);
+}
+
+static int reader_input_value(struct json_reader_t *self_p, char c)
+{
+    int res;
+
+    switch (c) {
+
+    case '{':
+        res = reader_begin_container(self_p, JSON_OBJECT);
+        break;
+
+    case '[':
+        res = reader_begin_container(self_p, JSON_ARRAY);
+        break;
+
+    case '\"':
+        self_p->pos = 0;
+        self_p->state = READER_STATE_STRING;
+        res = reader_begin_value(self_p);
+        break;
+
+    case ',':
+    case ':':
+    case ']':
+    case '}':
+        res = JSON_ERROR_INVAL;
+        break;
+
+    default:
+        if (is_whitespace(c)) {
+            res = 0;
+        } else if ((c < 32) || (c >= 127)) {
+            res = JSON_ERROR_INVAL;
+        } else {
+            self_p->buf_p[0] = c;
+            self_p->pos = 1;
+            self_p->state = READER_STATE_PRIMITIVE;
+            res = reader_begin_value(self_p);
+        }
+
+        break;
+    }
+
+    return (res);
+}
+
+static int reader_input_string(struct json_reader_t *self_p, char c)
+{
+    int res;
+
+    res = 0;
+
+    if (self_p->state == READER_STATE_STRING_ESCAPE) {
+        if (!is_escape_valid(c)) {
+            return (JSON_ERROR_INVAL);
+        }
+
+        self_p->state = READER_STATE_STRING;
+    } else if (c == '\"') {
+        res = reader_emit(self_p,
+                          JSON_EVENT_STRING,
+                          self_p->buf_p,
+                          self_p->pos);
+        reader_end_value(self_p);
+
+        return (res);
+    } else if (c == '\\') {
+        self_p->state = READER_STATE_STRING_ESCAPE;
+    }
+
+    /* Give the buffered part of the string to the user if the buffer
+       is full. */
+    if (self_p->pos == self_p->size) {
+        res = reader_emit(self_p,
+                          JSON_EVENT_STRING_PART,
+                          self_p->buf_p,
+                          self_p->pos);
+        self_p->pos = 0;
+    }
+
+    self_p->buf_p[self_p->pos++] = c;
+
+    return (res);
+}
+
+static int reader_input_primitive(struct json_reader_t *self_p, char c)
+{
+    int res;
+
+    switch (c) {
+
+    case ',':
+    case ']':
+    case '}':
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+        res = reader_emit(self_p,
+                          JSON_EVENT_PRIMITIVE,
+                          self_p->buf_p,
+                          self_p->pos);
+        reader_end_value(self_p);
+
+        if ((res == 0) && (self_p->state != READER_STATE_DONE)) {
+            res = reader_input(self_p, c);
+        }
+
+        break;
+
+    default:
+        if ((c < 32) || (c >= 127)) {
+            res = JSON_ERROR_INVAL;
+        } else if (self_p->pos == self_p->size) {
+            res = JSON_ERROR_NOMEM;
+        } else {
+            self_p->buf_p[self_p->pos++] = c;
+            res = 0;
+        }
+
+        break;
+    }
+
+    return (res);
+}
+
+/**
+ * Parse given character.
+ */
+static int reader_input(struct json_reader_t *self_p, char c)
+{
+    int res;
+
+    res = 0;
+
+    switch (self_p->state) {
+
+    case READER_STATE_VALUE_OR_END:
+        if (c == ']') {
+            res = reader_end_container(self_p, JSON_ARRAY);
+        } else {
+            res = reader_input_value(self_p, c);
+        }
+
+        break;
+
+    case READER_STATE_VALUE:
+        res = reader_input_value(self_p, c);
+        break;
+
+    case READER_STATE_KEY_OR_END:
+    case READER_STATE_KEY:
+        if (c == '\"') {
+            res = reader_path_append(self_p, '/');
+            self_p->state = READER_STATE_KEY_STRING;
+        } else if ((c == '}') && (self_p->state == READER_STATE_KEY_OR_END)) {
+            res = reader_end_container(self_p, JSON_OBJECT);
+        } else if (!is_whitespace(c)) {
+            res = JSON_ERROR_INVAL;
+        }
+
+        break;
+
+    case READER_STATE_KEY_STRING:
+        if (c == '\"') {
+            self_p->state = READER_STATE_COLON;
+        } else {
+            if (c == '\\') {
+                self_p->state = READER_STATE_KEY_STRING_ESCAPE;
+            }
+
+            res = reader_path_append_key(self_p, c);
+        }
+
+        break;
+
+    case READER_STATE_KEY_STRING_ESCAPE:
+        if (is_escape_valid(c)) {
+            self_p->state = READER_STATE_KEY_STRING;
+            res = reader_path_append_key(self_p, c);
+        } else {
+            res = JSON_ERROR_INVAL;
+        }
+
+        break;
+
+    case READER_STATE_COLON:
+        if (c == ':') {
+            self_p->state = READER_STATE_VALUE;
+        } else if (!is_whitespace(c)) {
+            res = JSON_ERROR_INVAL;
+        }
+
+        break;
+
+    case READER_STATE_STRING:
+    case READER_STATE_STRING_ESCAPE:
+        res = reader_input_string(self_p, c);
+        break;
+
+    case READER_STATE_PRIMITIVE:
+        res = reader_input_primitive(self_p, c);
+        break;
+
+    case READER_STATE_AFTER_VALUE:
+        if (c == ',') {
+            if (self_p->levels[self_p->depth - 1].type == JSON_OBJECT) {
+                self_p->state = READER_STATE_KEY;
+            } else {
+                self_p->state = READER_STATE_VALUE;
+            }
+        } else if (c == '}') {
+            res = reader_end_container(self_p, JSON_OBJECT);
+        } else if (c == ']') {
+            res = reader_end_container(self_p, JSON_ARRAY);
+        } else if (!is_whitespace(c)) {
+            res = JSON_ERROR_INVAL;
+        }
+
+        break;
+
+    case READER_STATE_DONE:
+        break;
+
+    default:
+        res = JSON_ERROR_INVAL;
+        break;
+    }
+
+    return (res);
+}
+
+static int writer_write(struct json_writer_t *self_p,
+                        const void *buf_p,
+                        size_t size)
+{
+    if (chan_write(self_p->chan_p, buf_p, size) != size) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+/**
+ * Write a comma before all but the first value or key in the current
+ * container.
+ */
+static int writer_begin_element(struct json_writer_t *self_p)
+{
+    uint32_t mask;
+
+    mask = (1UL << (self_p->depth - 1));
+
+    if (self_p->has_value & mask) {
+        return (writer_write(self_p, ",", 1));
+    }
+
+    self_p->has_value |= mask;
+
+    return (0);
+}
+
+/**
+ * Check that a value may be written, and write a comma if needed. A
+ * value in an object must follow a key, and there is only one top
+ * level value.
+ */
+static int writer_begin_value(struct json_writer_t *self_p)
+{
+    if (self_p->is_key == 1) {
+        self_p->is_key = 0;
+
+        return (0);
+    }
+
+    if (self_p->depth == 0) {
+        if (self_p->has_root == 1) {
+            return (-EINVAL);
+        }
+
+        self_p->has_root = 1;
+
+        return (0);
+    }
+
+    if (self_p->is_object & (1UL << (self_p->depth - 1))) {
+        return (-EINVAL);
+    }
+
+    return (writer_begin_element(self_p));
+}
+
+static int writer_begin_container(struct json_writer_t *self_p, char c)
+{
+    uint32_t mask;
+    int res;
+
+    if (self_p->depth == WRITER_DEPTH_MAX) {
+        return (-ENOMEM);
+    }
+
+    res = writer_begin_value(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    self_p->depth++;
+    mask = (1UL << (self_p->depth - 1));
+    self_p->has_value &= ~mask;
+
+    if (c == '{') {
+        self_p->is_object |= mask;
+    } else {
+        self_p->is_object &= ~mask;
+    }
+
+    return (writer_write(self_p, &c, 1));
+}
+
+static int writer_end_container(struct json_writer_t *self_p, char c)
+{
+    int is_object;
+
+    if ((self_p->depth == 0) || (self_p->is_key == 1)) {
+        return (-EINVAL);
+    }
+
+    is_object = ((self_p->is_object & (1UL << (self_p->depth - 1))) != 0);
+
+    if (is_object != (c == '}')) {
+        return (-EINVAL);
+    }
+
+    self_p->depth--;
+
+    return (writer_write(self_p, &c, 1));
+}
+
+/**
+ * Write given string within quotes. Unescaped spans are written in
+ * one call.
+ */
+static int writer_write_string(struct json_writer_t *self_p,
+                               const char *value_p)
+{
+    const char *begin_p;
+    char escaped[7];
+    size_t size;
+    int res;
+
+    res = writer_write(self_p, "\"", 1);
+    begin_p = value_p;
+
+    while (res == 0) {
+        if ((*value_p != '\0')
+            && (*value_p != '\"')
+            && (*value_p != '\\')
+            && ((uint8_t)*value_p >= 32)) {
+            value_p++;
+            continue;
+        }
+
+        if (value_p > begin_p) {
+            res = writer_write(self_p, begin_p, value_p - begin_p);
+
+            if (res != 0) {
+                break;
+            }
+        }
+
+        if (*value_p == '\0') {
+            res = writer_write(self_p, "\"", 1);
+            break;
+        }
+
+        switch (*value_p) {
+
+        case '\"':
+        case '\\':
+            escaped[0] = '\\';
+            escaped[1] = *value_p;
+            size = 2;
+            break;
+
+        case '\n':
+            size = std_sprintf(&escaped[0], FSTR("\\n"));
+            break;
+
+        case '\r':
+            size = std_sprintf(&escaped[0], FSTR("\\r"));
+            break;
+
+        case '\t':
+            size = std_sprintf(&escaped[0], FSTR("\\t"));
+            break;
+
+        default:
+            size = std_sprintf(&escaped[0],
+                               FSTR("\\u00%02x"),
+                               (uint8_t)*value_p);
+            break;
+        }
+
+        res = writer_write(self_p, &escaped[0], size);
+        value_p++;
+        begin_p = value_p;
+    }
+
+    return (res);
+}
+
+int json_init(struct json_t *self_p,
+              struct json_tok_t *tokens_p,
+              int num_tokens)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(((tokens_p != NULL) && (num_tokens > 0))
+            || (num_tokens == 0), EINVAL);
+
+    self_p->pos = 0;
+    self_p->toknext = 0;
+    self_p->toksuper = -1;
+    self_p->tokens_p = tokens_p;
+    self_p->num_tokens = num_tokens;
+    self_p->index.entries_p = NULL;
+    self_p->index.length = 0;
+    self_p->index.state = INDEX_STATE_STALE;
+    self_p->cursor.array_p = NULL;
+
+    return (0);
+}
+
+int json_set_index(struct json_t *self_p,
+                   struct json_index_entry_t *entries_p,
+                   int length)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(((entries_p != NULL) && (length > 0))
+            || (entries_p == NULL), EINVAL);
+
+    self_p->index.entries_p = entries_p;
+    self_p->index.length = length;
+    self_p->index.state = INDEX_STATE_STALE;
+
+    return (0);
+}
+
+int json_parse(struct json_t *self_p,
+               const char *js_p,
+               size_t len)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(js_p != NULL, EINVAL);
+    ASSERTN(len > 0, EINVAL);
+
+    int r;
+    int i;
+    struct json_tok_t *token_p;
+    int count;
+
+    count = self_p->toknext;
+    self_p->index.state = INDEX_STATE_STALE;
+    self_p->cursor.array_p = NULL;
+
+    for (; ((self_p->pos < len)
+            && (js_p[self_p->pos] != '\0')); self_p->pos++) {
+        char c;
+        enum json_type_t type;
+
+        c = js_p[self_p->pos];
+
+        switch (c) {
+
+        case '{':
+        case '[':
+            count++;
+
+            if (self_p->tokens_p == NULL) {
+                break;
+            }
+
+            token_p = alloc_token(self_p);
+
+            if (token_p == NULL) {
+                return (JSON_ERROR_NOMEM);
+            }
+
+            if (self_p->toksuper != -1) {
+                self_p->tokens_p[self_p->toksuper].num_tokens++;
+#ifdef JSON_PARENT_LINKS
+                token_p->parent = self_p->toksuper;
+#endif
+            }
+
+            token_p->type = (c == '{' ? JSON_OBJECT : JSON_ARRAY);
+            token_p->buf_p = js_p + self_p->pos;
+            self_p->toksuper = self_p->toknext - 1;
+            break;
+
+        case '}':
+        case ']':
+            if (self_p->tokens_p == NULL) {
+                break;
+            }
+
+            type = (c == '}' ? JSON_OBJECT : JSON_ARRAY);
+
+#ifdef JSON_PARENT_LINKS
+            if (self_p->toknext < 1) {
+                return (JSON_ERROR_INVAL);
+            }
+
+            token = &tokens_p[self_p->toknext - 1];
+
+            for (;;) {
+                if ((token_p->start != -1) && (token_p->end == -1)) {
+                    if (token_p->type != type) {
+                        return (JSON_ERROR_INVAL);
+                    }
+
+                    token_p->size = (&js_p[self_p->pos]
+                                     - self_p->buf_p + 1);
+                    self_p->toksuper = token_p->parent;
+                    break;
+                }
+
+                if (token_p->parent == -1) {
+                    break;
+                }
+
+                token = &tokens_p[token_p->parent];
+            }
+#else
+            for (i = self_p->toknext - 1; i >= 0; i--) {
+                token_p = &self_p->tokens_p[i];
+
+                if ((token_p->buf_p != NULL) && (token_p->size == -1)) {
+                    if (token_p->type != type) {
+                        return (JSON_ERROR_INVAL);
+                    }
+
+                    self_p->toksuper = -1;
+                    token_p->size = (&js_p[self_p->pos]
+                                     - token_p->buf_p + 1);
+                    break;
+                }
+            }
+
+            /* Error if unmatched closing bracket */
+            if (i == -1) {
+                return (JSON_ERROR_INVAL);
+            }
+
+            for (; i >= 0; i--) {
+                token_p = &self_p->tokens_p[i];
+
+                if ((token_p->buf_p != NULL) && (token_p->size == -1)) {
+                    self_p->toksuper = i;
+                    break;
                 }
             }
 #endif
@@ -681,6 +1568,11 @@ int json_parse(struct json_t *self_p,
         case '\r':
         case '\n':
         case ' ':
+            /* Skip all consecutive whitespace characters. */
+            self_p->pos += (std_memspn(&js_p[self_p->pos],
+                                       len - self_p->pos,
+                                       &whitespace[0],
+                                       sizeof(whitespace)) - 1);
             break;
 
         case ':':
@@ -770,6 +1662,8 @@ int json_parse(struct json_t *self_p,
                 return (JSON_ERROR_PART);
             }
         }
+
+        update_descendants(self_p);
     }
 
     return (count);
@@ -851,7 +1745,6 @@ struct json_tok_t *json_array_get(struct json_t *self_p,
     ASSERTNRN(index >= 0, EINVAL);
 
     int i;
-    int number_of_children;
     struct json_tok_t *token_p;
 
     /* Return immediatly if no array is found. */
@@ -864,18 +1757,29 @@ struct json_tok_t *json_array_get(struct json_t *self_p,
         return (NULL);
     }
 
-    /* The first child token. */
-    token_p = (array_p + 1);
+    /* Continue from the previously found element if possible, which
+       makes iterating over the array elements in order fast. */
+    if ((self_p->cursor.array_p == array_p)
+        && (self_p->cursor.index <= index)) {
+        i = self_p->cursor.index;
+        token_p = self_p->cursor.element_p;
+    } else {
+        i = 0;
+        token_p = (array_p + 1);
+    }
 
-    /* Find given key in the object. */
-    for (i = 0; i < array_p->num_tokens; i++) {
+    /* Find given index in the array. */
+    for (; i < array_p->num_tokens; i++) {
         if (i == index) {
+            self_p->cursor.array_p = array_p;
+            self_p->cursor.index = index;
+            self_p->cursor.element_p = token_p;
+
             return (token_p);
         }
 
         /* Get the next child token. */
-        number_of_children = get_number_of_children(token_p);
-        token_p += (number_of_children + 1);
+        token_p = get_next_sibling(token_p);
     }
 
     return (NULL);
@@ -888,6 +1792,7 @@ void json_token_object(struct json_tok_t *token_p,
     token_p->buf_p = NULL;
     token_p->size = -1;
     token_p->num_tokens = num_keys;
+    token_p->num_descendants = -1;
 }
 
 void json_token_array(struct json_tok_t *token_p,
@@ -897,6 +1802,7 @@ void json_token_array(struct json_tok_t *token_p,
     token_p->buf_p = NULL;
     token_p->size = -1;
     token_p->num_tokens = num_elements;
+    token_p->num_descendants = -1;
 }
 
 void json_token_true(struct json_tok_t *token_p)
@@ -905,6 +1811,7 @@ void json_token_true(struct json_tok_t *token_p)
     token_p->buf_p = "true";
     token_p->size = 4;
     token_p->num_tokens = -1;
+    token_p->num_descendants = 0;
 }
 
 void json_token_false(struct json_tok_t *token_p)
@@ -913,6 +1820,7 @@ void json_token_false(struct json_tok_t *token_p)
     token_p->buf_p = "false";
     token_p->size = 5;
     token_p->num_tokens = -1;
+    token_p->num_descendants = 0;
 }
 
 void json_token_null(struct json_tok_t *token_p)
@@ -921,6 +1829,7 @@ void json_token_null(struct json_tok_t *token_p)
     token_p->buf_p = "null";
     token_p->size = 4;
     token_p->num_tokens = -1;
+    token_p->num_descendants = 0;
 }
 
 void json_token_number(struct json_tok_t *token_p,
@@ -931,6 +1840,7 @@ void json_token_number(struct json_tok_t *token_p,
     token_p->buf_p = buf_p;
     token_p->size = size;
     token_p->num_tokens = -1;
+    token_p->num_descendants = 0;
 }
 
 void json_token_string(struct json_tok_t *token_p,
@@ -941,4 +1851,273 @@ void json_token_string(struct json_tok_t *token_p,
     token_p->buf_p = buf_p;
     token_p->size = size;
     token_p->num_tokens = -1;
+    token_p->num_descendants = 0;
+}
+
+int json_reader_init(struct json_reader_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     json_reader_on_event_t on_event,
+                     void *arg_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size > 0, EINVAL);
+    ASSERTN(on_event != NULL, EINVAL);
+
+    self_p->state = READER_STATE_VALUE;
+    self_p->depth = 0;
+    self_p->path_length = 0;
+    self_p->buf_p = buf_p;
+    self_p->size = size;
+    self_p->pos = 0;
+    self_p->on_event = on_event;
+    self_p->arg_p = arg_p;
+
+    return (0);
+}
+
+int json_reader_feed(struct json_reader_t *self_p,
+                     const void *buf_p,
+                     size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN((buf_p != NULL) || (size == 0), EINVAL);
+
+    const char *c_p;
+    size_t span;
+    int res;
+
+    c_p = buf_p;
+
+    while ((size > 0) && (self_p->state != READER_STATE_DONE)) {
+        /* Copy plain string characters in one go. */
+        if (self_p->state == READER_STATE_STRING) {
+            span = std_memcspn(c_p,
+                               MIN(size, self_p->size - self_p->pos),
+                               &string_delimiters[0],
+                               2);
+            memcpy(&self_p->buf_p[self_p->pos], c_p, span);
+            self_p->pos += span;
+            c_p += span;
+            size -= span;
+
+            if (size == 0) {
+                break;
+            }
+        }
+
+        res = reader_input(self_p, *c_p++);
+
+        if (res != 0) {
+            self_p->state = READER_STATE_ERROR;
+
+            return (res);
+        }
+
+        size--;
+    }
+
+    return (self_p->state == READER_STATE_DONE);
+}
+
+int json_reader_read(struct json_reader_t *self_p,
+                     void *chan_p,
+                     size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(chan_p != NULL, EINVAL);
+
+    char buf[32];
+    size_t chunk_size;
+    int res;
+
+    res = (self_p->state == READER_STATE_DONE);
+
+    /* Always read given number of bytes to leave the channel at the
+       end of the document. */
+    while (size > 0) {
+        chunk_size = MIN(size, sizeof(buf));
+
+        if (chan_read(chan_p, &buf[0], chunk_size) != chunk_size) {
+            return (-EIO);
+        }
+
+        size -= chunk_size;
+
+        if (res == 0) {
+            res = json_reader_feed(self_p, &buf[0], chunk_size);
+
+            if (res < 0) {
+                return (res);
+            }
+        }
+    }
+
+    return (res);
+}
+
+int json_path_match(const char *pattern_p, const char *path_p)
+{
+    ASSERTN(pattern_p != NULL, EINVAL);
+    ASSERTN(path_p != NULL, EINVAL);
+
+    while ((*pattern_p != '\0') || (*path_p != '\0')) {
+        if ((*pattern_p != '/') || (*path_p != '/')) {
+            return (0);
+        }
+
+        pattern_p++;
+        path_p++;
+
+        if ((pattern_p[0] == '+')
+            && ((pattern_p[1] == '/') || (pattern_p[1] == '\0'))) {
+            /* Wildcard, skip one path component. */
+            pattern_p++;
+
+            while ((*path_p != '/') && (*path_p != '\0')) {
+                path_p++;
+            }
+        } else {
+            while ((*pattern_p != '/') && (*pattern_p != '\0')) {
+                if (*pattern_p != *path_p) {
+                    return (0);
+                }
+
+                pattern_p++;
+                path_p++;
+            }
+
+            if ((*path_p != '/') && (*path_p != '\0')) {
+                return (0);
+            }
+        }
+    }
+
+    return (1);
+}
+
+int json_writer_init(struct json_writer_t *self_p, void *chan_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(chan_p != NULL, EINVAL);
+
+    self_p->chan_p = chan_p;
+    self_p->depth = 0;
+    self_p->has_value = 0;
+    self_p->is_object = 0;
+    self_p->is_key = 0;
+    self_p->has_root = 0;
+
+    return (0);
+}
+
+int json_writer_object_begin(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_begin_container(self_p, '{'));
+}
+
+int json_writer_object_end(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_end_container(self_p, '}'));
+}
+
+int json_writer_array_begin(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_begin_container(self_p, '['));
+}
+
+int json_writer_array_end(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_end_container(self_p, ']'));
+}
+
+int json_writer_key(struct json_writer_t *self_p, const char *key_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(key_p != NULL, EINVAL);
+
+    int res;
+
+    if ((self_p->depth == 0)
+        || (self_p->is_key == 1)
+        || !(self_p->is_object & (1UL << (self_p->depth - 1)))) {
+        return (-EINVAL);
+    }
+
+    res = writer_begin_element(self_p);
+
+    if (res == 0) {
+        res = writer_write_string(self_p, key_p);
+    }
+
+    if (res == 0) {
+        res = writer_write(self_p, ":", 1);
+    }
+
+    if (res == 0) {
+        self_p->is_key = 1;
+    }
+
+    return (res);
+}
+
+int json_writer_string(struct json_writer_t *self_p, const char *value_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(value_p != NULL, EINVAL);
+
+    int res;
+
+    res = writer_begin_value(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (writer_write_string(self_p, value_p));
+}
+
+int json_writer_integer(struct json_writer_t *self_p, long value)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    char buf[24];
+    int res;
+    size_t size;
+
+    res = writer_begin_value(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    size = std_sprintf(&buf[0], FSTR("%ld"), value);
+
+    return (writer_write(self_p, &buf[0], size));
+}
+
+int json_writer_primitive(struct json_writer_t *self_p,
+                          const char *value_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(value_p != NULL, EINVAL);
+
+    int res;
+
+    res = writer_begin_value(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (writer_write(self_p, value_p, strlen(value_p)));
 }
@@ -102,11 +102,74 @@ struct json_tok_t {
     size_t size;
     /* Number of children of this token. Not recursive. */
     int num_tokens;
+    /* Number of tokens below this token. Recursive. Set by
+       `json_parse()`, -1 if unknown. */
+    int num_descendants;
 #ifdef JSON_PARENT_LINKS
     int parent;
 #endif
 };
 
+/**
+ * Streaming JSON reader event.
+ */
+enum json_event_t {
+    /** Beginning of an object, ``{``. */
+    JSON_EVENT_OBJECT_BEGIN = 0,
+
+    /** End of an object, ``}``. */
+    JSON_EVENT_OBJECT_END,
+
+    /** Beginning of an array, ``[``. */
+    JSON_EVENT_ARRAY_BEGIN,
+
+    /** End of an array, ``]``. */
+    JSON_EVENT_ARRAY_END,
+
+    /** A string, or the last part of a string that did not fit in
+        the value buffer. */
+    JSON_EVENT_STRING,
+
+    /** Part of a string that did not fit in the value buffer. More
+        parts follow. */
+    JSON_EVENT_STRING_PART,
+
+    /** Other primitive: number, boolean (true/false) or null. */
+    JSON_EVENT_PRIMITIVE
+};
+
+/**
+ * Streaming JSON reader event callback.
+ *
+ * @param[in] arg_p Argument given to `json_reader_init()`.
+ * @param[in] event Event type.
+ * @param[in] path_p Null terminated path of the value, in JSON
+ *                   pointer format. For example
+ *                   ``/settings/limits/0``. The root value has the
+ *                   empty path ``""``.
+ * @param[in] buf_p Value of strings and primitives, otherwise NULL.
+ *                  Strings are not unescaped.
+ * @param[in] size Size of the value in bytes.
+ *
+ * @return zero(0) to continue parsing, or negative error code to
+ *         abort.
+ */
+typedef int (*json_reader_on_event_t)(void *arg_p,
+                                      enum json_event_t event,
+                                      const char *path_p,
+                                      const char *buf_p,
+                                      size_t size);
+
+/**
+ * An entry in the key hash index of a JSON object.
+ */
+struct json_index_entry_t {
+    /** Index of the object token, or -1 if the entry is unused. */
+    int object;
+    /** Index of the key token. */
+    int key;
+};
+
 /*
  * JSON parser. Contains an array of token blocks available. Also
  * stores the string being parsed now and current position in that
@@ -123,6 +186,56 @@ struct json_t {
     struct json_tok_t *tokens_p;
     /** Number of tokens in the tokens array. */
     int num_tokens;
+    /** Optional key hash index. */
+    struct {
+        struct json_index_entry_t *entries_p;
+        int length;
+        int state;
+    } index;
+    /** Last array element found by `json_array_get()`. */
+    struct {
+        struct json_tok_t *array_p;
+        int index;
+        struct json_tok_t *element_p;
+    } cursor;
+};
+
+struct json_reader_level_t {
+    char type;
+    int index;
+    size_t path_length;
+};
+
+/**
+ * Streaming JSON reader. Uses a constant amount of memory regardless
+ * of the size of the parsed document.
+ */
+struct json_reader_t {
+    int state;
+    int depth;
+    struct json_reader_level_t levels[CONFIG_JSON_READER_DEPTH_MAX];
+    char path[CONFIG_JSON_READER_PATH_MAX];
+    size_t path_length;
+    char *buf_p;
+    size_t size;
+    size_t pos;
+    json_reader_on_event_t on_event;
+    void *arg_p;
+};
+
+/**
+ * Streaming JSON writer. Values are written to the output channel as
+ * they are added, without building any tokens.
+ */
+struct json_writer_t {
+    void *chan_p;
+    int depth;
+    /* Bit N is set if the container at depth N + 1 has a value. */
+    uint32_t has_value;
+    /* Bit N is set if the container at depth N + 1 is an object. */
+    uint32_t is_object;
+    int is_key;
+    int has_root;
 };
 
  /**
@@ -158,6 +271,26 @@ int json_parse(struct json_t *self_p,
                const char *js_p,
                size_t len);
 
+/**
+ * Use given array of entries as a key hash index when getting values
+ * from objects. The index is built on the first lookup after a
+ * successful call to `json_parse()`, and makes all following lookups
+ * take constant time on average. Lookups fall back to walking the
+ * object keys if the index is too small for the parsed data.
+ *
+ * @param[in] self_p Initialized JSON object.
+ * @param[in] entries_p Array of index entries, or NULL to remove the
+ *                      index.
+ * @param[in] length Number of entries in the array. Should be at
+ *                   least 4/3 of the total number of keys in the
+ *                   parsed data.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_set_index(struct json_t *self_p,
+                   struct json_index_entry_t *entries_p,
+                   int length);
+
 /**
  * Format and write given JSON tokens into a string.
  *
@@ -224,7 +357,8 @@ struct json_tok_t *json_object_get_primitive(struct json_t *self_p,
                                              struct json_tok_t *object_p);
 
 /**
- * Get the token of given array index.
+ * Get the token of given array index. Getting the elements in
+ * increasing index order takes constant time per element.
  *
  * @param[in] self_p JSON object.
  * @param[in] index Index to get.
@@ -297,4 +431,166 @@ void json_token_string(struct json_tok_t *token_p,
                        const char *buf_p,
                        size_t size);
 
+/**
+ * Initialize given streaming JSON reader.
+ *
+ * @param[out] self_p Reader to initialize.
+ * @param[in] buf_p Value buffer. Primitives must fit in this buffer,
+ *                  while longer strings are given to the callback in
+ *                  parts.
+ * @param[in] size Size of the value buffer.
+ * @param[in] on_event Callback called for each parsed event.
+ * @param[in] arg_p Argument passed to the callback.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_reader_init(struct json_reader_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     json_reader_on_event_t on_event,
+                     void *arg_p);
+
+/**
+ * Parse given chunk of a JSON document. The document can be split
+ * into any number of chunks of any size.
+ *
+ * @param[in] self_p Initialized reader.
+ * @param[in] buf_p Chunk to parse.
+ * @param[in] size Chunk size in bytes.
+ *
+ * @return one(1) if the document is complete, zero(0) if more data
+ *         is expected, otherwise negative error code. Data after a
+ *         complete document is ignored.
+ */
+int json_reader_feed(struct json_reader_t *self_p,
+                     const void *buf_p,
+                     size_t size);
+
+/**
+ * Read given number of bytes from given channel and parse them.
+ *
+ * @param[in] self_p Initialized reader.
+ * @param[in] chan_p Channel to read from.
+ * @param[in] size Number of bytes to read.
+ *
+ * @return one(1) if the document is complete, zero(0) if more data
+ *         is expected, otherwise negative error code.
+ */
+int json_reader_read(struct json_reader_t *self_p,
+                     void *chan_p,
+                     size_t size);
+
+/**
+ * Check if given path matches given pattern. A ``+`` component in
+ * the pattern matches any single path component.
+ *
+ * @param[in] pattern_p Pattern, for example ``/entries/+/id``.
+ * @param[in] path_p Path given to the event callback.
+ *
+ * @return true(1) if the path matches, otherwise false(0).
+ */
+int json_path_match(const char *pattern_p, const char *path_p);
+
+/**
+ * Initialize given streaming JSON writer. The writer writes a single
+ * value, often an object or an array, with at most 32 levels of
+ * nested containers. Keys and strings are written as they are
+ * escaped, and have no length limit.
+ *
+ * All functions return -EINVAL if the call would make the document
+ * invalid, for example a value in an object without a key, or a
+ * second top level value. Nothing is written in that case.
+ *
+ * @param[out] self_p Writer to initialize.
+ * @param[in] chan_p Channel to write the JSON document to.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_init(struct json_writer_t *self_p, void *chan_p);
+
+/**
+ * Begin an object.
+ *
+ * @param[in] self_p Initialized writer.
+ *
+ * @return zero(0) or negative error code, -ENOMEM if the containers
+ *         are nested too deep.
+ */
+int json_writer_object_begin(struct json_writer_t *self_p);
+
+/**
+ * End the current object.
+ *
+ * @param[in] self_p Initialized writer.
+ *
+ * @return zero(0) or negative error code, -EINVAL if the current
+ *         container is not an object, or if its last key has no
+ *         value.
+ */
+int json_writer_object_end(struct json_writer_t *self_p);
+
+/**
+ * Begin an array.
+ *
+ * @param[in] self_p Initialized writer.
+ *
+ * @return zero(0) or negative error code, -ENOMEM if the containers
+ *         are nested too deep.
+ */
+int json_writer_array_begin(struct json_writer_t *self_p);
+
+/**
+ * End the current array.
+ *
+ * @param[in] self_p Initialized writer.
+ *
+ * @return zero(0) or negative error code, -EINVAL if the current
+ *         container is not an array.
+ */
+int json_writer_array_end(struct json_writer_t *self_p);
+
+/**
+ * Write an object key. Must be followed by a value.
+ *
+ * @param[in] self_p Initialized writer.
+ * @param[in] key_p Key to write.
+ *
+ * @return zero(0) or negative error code, -EINVAL if the current
+ *         container is not an object, or if the previous key has no
+ *         value.
+ */
+int json_writer_key(struct json_writer_t *self_p, const char *key_p);
+
+/**
+ * Write a string value. Quotes, backslashes and control characters
+ * are escaped.
+ *
+ * @param[in] self_p Initialized writer.
+ * @param[in] value_p String to write.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_string(struct json_writer_t *self_p, const char *value_p);
+
+/**
+ * Write an integer value.
+ *
+ * @param[in] self_p Initialized writer.
+ * @param[in] value Integer to write.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_integer(struct json_writer_t *self_p, long value);
+
+/**
+ * Write given primitive as is, for example ``true`` or ``1.5``.
+ *
+ * @param[in] self_p Initialized writer.
+ * @param[in] value_p Primitive to write.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_primitive(struct json_writer_t *self_p,
+                          const char *value_p);
+
 #endif
@@ -34,6 +34,8 @@
 struct module_t {
     int8_t initialized;
     struct fs_command_t *commands_p;
+    struct fs_command_t *last_registered_p;
+    struct fs_command_t *commands_table[CONFIG_FS_COMMAND_HASH_TABLE_SIZE];
     struct fs_filesystem_t *filesystems_p;
     struct fs_counter_t *counters_p;
     struct fs_parameter_t *parameters_p;
@@ -540,6 +542,27 @@ static int command_parse(char *command_p, const char *argv[])
     return (argc);
 }
 
+/**
+ * FNV-1a hash of given command path, ignoring any leading slash.
+ */
+static int path_hash(far_string_t path_p)
+{
+    uint32_t hash;
+
+    if (*path_p == '/') {
+        path_p++;
+    }
+
+    hash = 2166136261UL;
+
+    while (*path_p != '\0') {
+        hash ^= (uint8_t)*path_p++;
+        hash *= 16777619UL;
+    }
+
+    return (hash & (CONFIG_FS_COMMAND_HASH_TABLE_SIZE - 1));
+}
+
 static int cmd_counter_cb(int argc,
                           const char *argv[],
                           void *chout_p,
@@ -563,6 +586,8 @@ int fs_module_init()
 
     module.initialized = 1;
     module.commands_p = NULL;
+    module.last_registered_p = NULL;
+    memset(&module.commands_table[0], 0, sizeof(module.commands_table));
     module.filesystems_p = NULL;
     module.counters_p = NULL;
     module.parameters_p = NULL;
@@ -650,6 +675,29 @@ int fs_module_init()
     return (0);
 }
 
+/**
+ * Find the registered command with given path. The leading slash is
+ * optional.
+ */
+static struct fs_command_t *command_find(const char *path_p)
+{
+    int skip_slash;
+    struct fs_command_t *current_p;
+
+    current_p = module.commands_table[path_hash(path_p)];
+    skip_slash = (path_p[0] != '/');
+
+    while (current_p != NULL) {
+        if (std_strcmp(path_p, &current_p->path_p[skip_slash]) == 0) {
+            return (current_p);
+        }
+
+        current_p = current_p->hash_next_p;
+    }
+
+    return (NULL);
+}
+
 int fs_call(char *command_p,
             void *chin_p,
             void *chout_p,
@@ -657,7 +705,7 @@ int fs_call(char *command_p,
 {
     ASSERTN(command_p != NULL, EINVAL);
 
-    int argc, skip_slash;
+    int argc;
     const char *argv[CONFIG_FS_COMMAND_ARGS_MAX];
     struct fs_command_t *current_p;
 
@@ -668,20 +716,15 @@ int fs_call(char *command_p,
     }
 
     /* Find given command. */
-    current_p = module.commands_p;
-    skip_slash = (argv[0][0] != '/');
+    current_p = command_find(argv[0]);
 
-    while (current_p != NULL) {
-        if (std_strcmp(argv[0], &current_p->path_p[skip_slash]) == 0) {
-            return (current_p->callback(argc,
-                                        argv,
-                                        chout_p,
-                                        chin_p,
-                                        current_p->arg_p,
-                                        arg_p));
-        }
-
-        current_p = current_p->next_p;
+    if (current_p != NULL) {
+        return (current_p->callback(argc,
+                                    argv,
+                                    chout_p,
+                                    chin_p,
+                                    current_p->arg_p,
+                                    arg_p));
     }
 
     std_fprintf(chout_p, OSTR("%s: command not found\r\n"), argv[0]);
@@ -1833,6 +1876,7 @@ int fs_command_init(struct fs_command_t *self_p,
     ASSERTN(callback != NULL, EINVAL);
 
     self_p->next_p = NULL;
+    self_p->hash_next_p = NULL;
     self_p->path_p = path_p;
     self_p->callback = callback;
     self_p->arg_p = arg_p;
@@ -1845,10 +1889,31 @@ int fs_command_register(struct fs_command_t *command_p)
     ASSERTN(command_p != NULL, EINVAL);
 
     struct fs_command_t *current_p, *prev_p;
+    struct fs_command_t **bucket_pp;
+
+    /* Append to the hash table bucket, so the first registered
+       command with a path is found first. */
+    bucket_pp = &module.commands_table[path_hash(command_p->path_p)];
+
+    while (*bucket_pp != NULL) {
+        bucket_pp = &(*bucket_pp)->hash_next_p;
+    }
 
-    /* Insert in alphabetical order. */
-    prev_p = NULL;
-    current_p = module.commands_p;
+    command_p->hash_next_p = NULL;
+    *bucket_pp = command_p;
+
+    /* Insert in alphabetical order. Commands are often registered in
+       alphabetical order, so start after the last registered command
+       if possible. */
+    prev_p = module.last_registered_p;
+
+    if ((prev_p != NULL)
+        && (std_strcmp_f(command_p->path_p, prev_p->path_p) >= 0)) {
+        current_p = prev_p->next_p;
+    } else {
+        prev_p = NULL;
+        current_p = module.commands_p;
+    }
 
     while (current_p != NULL) {
         if (std_strcmp_f(command_p->path_p, current_p->path_p) < 0) {
@@ -1868,6 +1933,8 @@ int fs_command_register(struct fs_command_t *command_p)
         prev_p->next_p = command_p;
     }
 
+    module.last_registered_p = command_p;
+
     return (0);
 }
 
@@ -1926,6 +1993,21 @@ int fs_counter_deregister(struct fs_counter_t *counter_p)
     return (0);
 }
 
+struct fs_counter_t *fs_counter_get_by_path(const char *path_p)
+{
+    ASSERTNRN(path_p != NULL, EINVAL);
+
+    struct fs_command_t *command_p;
+
+    command_p = command_find(path_p);
+
+    if ((command_p == NULL) || (command_p->callback != cmd_counter_cb)) {
+        return (NULL);
+    }
+
+    return (command_p->arg_p);
+}
+
 int fs_parameter_init(struct fs_parameter_t *self_p,
                       far_string_t path_p,
                       fs_parameter_set_callback_t set_cb,
@@ -1971,6 +2053,21 @@ int fs_parameter_deregister(struct fs_parameter_t *parameter_p)
     return (0);
 }
 
+struct fs_parameter_t *fs_parameter_get_by_path(const char *path_p)
+{
+    ASSERTNRN(path_p != NULL, EINVAL);
+
+    struct fs_command_t *command_p;
+
+    command_p = command_find(path_p);
+
+    if ((command_p == NULL) || (command_p->callback != cmd_parameter_cb)) {
+        return (NULL);
+    }
+
+    return (command_p->arg_p);
+}
+
 int fs_parameter_int_set(void *value_p, const char *src_p)
 {
     long value;
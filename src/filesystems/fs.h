@@ -220,6 +220,7 @@ struct fs_command_t {
     fs_callback_t callback;
     void *arg_p;
     struct fs_command_t *next_p;
+    struct fs_command_t *hash_next_p;
 };
 
 /* Counter. */
@@ -615,7 +616,9 @@ int fs_command_init(struct fs_command_t *self_p,
 
 /**
  * Register given command. Registered commands are called by the
- * function `fs_call()`.
+ * function `fs_call()`, which finds them in a hash table. Commands
+ * are also kept in alphabetical order for listing and auto
+ * completion.
  *
  * @param[in] command_p Command to register.
  *
@@ -674,6 +677,16 @@ int fs_counter_register(struct fs_counter_t *counter_p);
  */
 int fs_counter_deregister(struct fs_counter_t *counter_p);
 
+/**
+ * Get the registered counter with given path.
+ *
+ * @param[in] path_p Counter path. The leading slash is optional.
+ *
+ * @return The counter, or NULL if no counter with given path is
+ *         registered.
+ */
+struct fs_counter_t *fs_counter_get_by_path(const char *path_p);
+
 /**
  * Initialize given parameter.
  *
@@ -710,6 +723,16 @@ int fs_parameter_register(struct fs_parameter_t *parameter_p);
  */
 int fs_parameter_deregister(struct fs_parameter_t *parameter_p);
 
+/**
+ * Get the registered parameter with given path.
+ *
+ * @param[in] path_p Parameter path. The leading slash is optional.
+ *
+ * @return The parameter, or NULL if no parameter with given path is
+ *         registered.
+ */
+struct fs_parameter_t *fs_parameter_get_by_path(const char *path_p);
+
 /**
  * Integer parameter setter function callback
  *
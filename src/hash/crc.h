@@ -48,6 +48,21 @@
  */
 uint32_t crc_32(uint32_t crc, const void *buf_p, size_t size);
 
+/**
+ * Combine the 32 bits crcs of two consecutive buffers into the crc of
+ * both buffers, as if calculated by a single call to
+ * `crc_32()`. Useful to calculate the crc of parts of a buffer
+ * separately, in any order.
+ *
+ * @param[in] crc_1 Crc of the first buffer.
+ * @param[in] crc_2 Crc of the second buffer, with 0x00000000 as
+ *                  initial crc.
+ * @param[in] size_2 Size of the second buffer.
+ *
+ * @return Crc of both buffers.
+ */
+uint32_t crc_32_combine(uint32_t crc_1, uint32_t crc_2, size_t size_2);
+
 /**
  * Calculate a 16 bits crc using the CCITT algorithm (polynomial
  * ``x^16+x^12+x^5+x^1``).
@@ -72,6 +87,19 @@ uint16_t crc_ccitt(uint16_t crc, const void *buf_p, size_t size);
  */
 uint16_t crc_xmodem(uint16_t crc, const void *buf_p, size_t size);
 
+/**
+ * Combine the XModem crcs of two consecutive buffers into the crc of
+ * both buffers, as if calculated by a single call to `crc_xmodem()`.
+ *
+ * @param[in] crc_1 Crc of the first buffer.
+ * @param[in] crc_2 Crc of the second buffer, with 0x0000 as initial
+ *                  crc.
+ * @param[in] size_2 Size of the second buffer.
+ *
+ * @return Crc of both buffers.
+ */
+uint16_t crc_xmodem_combine(uint16_t crc_1, uint16_t crc_2, size_t size_2);
+
 /**
  * Calculate a 8 bits crc using the CRC-7 algorithm (polynomial
  * ``x^7+x^3+1``).
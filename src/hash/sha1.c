@@ -28,76 +28,363 @@
 
 #include "simba.h"
 
-static inline uint32_t rotateleft(uint32_t value, int positions)
+#if CONFIG_SHA_HARDWARE == 1
+#    if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#        include <immintrin.h>
+#        define SHA1_HARDWARE_SHA_NI
+#    endif
+#endif
+
+#define BLOCK_SIZE                                           64
+
+/* Number of buffers hashed in parallel by sha1_digest_multi(). */
+#define LANES                                                 4
+
+/* One 32 bits word of each lane. Compiled to SIMD instructions on
+   targets having them. */
+typedef uint32_t lanes_t __attribute__((vector_size(4 * LANES)));
+
+/* A macro to work on both words and lanes. */
+#define rotateleft(value, positions)                                    \
+    (((value) << (positions)) | ((value) >> (32 - (positions))))
+
+static inline uint32_t load_be32(const uint8_t *buf_p)
 {
-    return ((value << positions) | (value >> (32 - positions)));
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | ((uint32_t)buf_p[3] << 0));
 }
 
-static void block_update(struct sha1_t *self_p,
-                         uint8_t *block_p)
+static inline lanes_t load_be32_lanes(const uint8_t **blocks_pp,
+                                      int offset)
 {
-    uint32_t a ,b ,c ,d ,e, f, i ,t ,w[80];
-    uint32_t *b_p = (uint32_t *)block_p;
+    lanes_t value;
+    int i;
+
+    for (i = 0; i < LANES; i++) {
+        value[i] = load_be32(&blocks_pp[i][offset]);
+    }
+
+    return (value);
+}
+
+/* The message schedule is kept in a circular buffer of 16 words. */
+#define W0(i) (w[(i)] = load_be32(&block_p[4 * (i)]))
+#define WL0(i) (w[(i)] = load_be32_lanes(&blocks_p[0], 4 * (i)))
+#define W(i)                                                    \
+    (w[(i) & 15] = rotateleft(w[((i) + 13) & 15]                \
+                              ^ w[((i) + 8) & 15]               \
+                              ^ w[((i) + 2) & 15]               \
+                              ^ w[(i) & 15], 1))
+
+/* One round each, given the message schedule word. The variables are
+   rotated by the caller instead of moving the values between them. */
+#define R1(a, b, c, d, e, w)                                            \
+    e += ((b & (c ^ d)) ^ d) + w + 0x5a827999 + rotateleft(a, 5);       \
+    b = rotateleft(b, 30)
+#define R2(a, b, c, d, e, w)                                    \
+    e += (b ^ c ^ d) + w + 0x6ed9eba1 + rotateleft(a, 5);       \
+    b = rotateleft(b, 30)
+#define R3(a, b, c, d, e, w)                                            \
+    e += (((b | c) & d) | (b & c)) + w + 0x8f1bbcdc + rotateleft(a, 5); \
+    b = rotateleft(b, 30)
+#define R4(a, b, c, d, e, w)                                    \
+    e += (b ^ c ^ d) + w + 0xca62c1d6 + rotateleft(a, 5);       \
+    b = rotateleft(b, 30)
+
+static void blocks_update_software(uint32_t *h_p,
+                                   const uint8_t *block_p,
+                                   size_t number_of_blocks)
+{
+    uint32_t a, b, c, d, e, w[16];
+    int i;
+
+    while (number_of_blocks > 0) {
+        a = h_p[0];
+        b = h_p[1];
+        c = h_p[2];
+        d = h_p[3];
+        e = h_p[4];
+
+        for (i = 0; i < 15; i += 5) {
+            R1(a, b, c, d, e, W0(i + 0));
+            R1(e, a, b, c, d, W0(i + 1));
+            R1(d, e, a, b, c, W0(i + 2));
+            R1(c, d, e, a, b, W0(i + 3));
+            R1(b, c, d, e, a, W0(i + 4));
+        }
+
+        R1(a, b, c, d, e, W0(15));
+        R1(e, a, b, c, d, W(16));
+        R1(d, e, a, b, c, W(17));
+        R1(c, d, e, a, b, W(18));
+        R1(b, c, d, e, a, W(19));
+
+        for (i = 20; i < 40; i += 5) {
+            R2(a, b, c, d, e, W(i + 0));
+            R2(e, a, b, c, d, W(i + 1));
+            R2(d, e, a, b, c, W(i + 2));
+            R2(c, d, e, a, b, W(i + 3));
+            R2(b, c, d, e, a, W(i + 4));
+        }
+
+        for (; i < 60; i += 5) {
+            R3(a, b, c, d, e, W(i + 0));
+            R3(e, a, b, c, d, W(i + 1));
+            R3(d, e, a, b, c, W(i + 2));
+            R3(c, d, e, a, b, W(i + 3));
+            R3(b, c, d, e, a, W(i + 4));
+        }
 
-    for (i = 0; i < 16; i++) {
-        w[i] = ntohl(b_p[i]);
+        for (; i < 80; i += 5) {
+            R4(a, b, c, d, e, W(i + 0));
+            R4(e, a, b, c, d, W(i + 1));
+            R4(d, e, a, b, c, W(i + 2));
+            R4(c, d, e, a, b, W(i + 3));
+            R4(b, c, d, e, a, W(i + 4));
+        }
+
+        h_p[0] += a;
+        h_p[1] += b;
+        h_p[2] += c;
+        h_p[3] += d;
+        h_p[4] += e;
+
+        block_p += BLOCK_SIZE;
+        number_of_blocks--;
     }
+}
+
+/**
+ * Process given number of blocks in each lane, with the rounds of all
+ * lanes interleaved.
+ */
+static void blocks_update_lanes(lanes_t *h_p,
+                                const uint8_t **blocks_pp,
+                                size_t number_of_blocks)
+{
+    lanes_t a, b, c, d, e, w[16];
+    const uint8_t *blocks_p[LANES];
+    int i;
+
+    memcpy(&blocks_p[0], blocks_pp, sizeof(blocks_p));
+
+    while (number_of_blocks > 0) {
+        a = h_p[0];
+        b = h_p[1];
+        c = h_p[2];
+        d = h_p[3];
+        e = h_p[4];
+
+        for (i = 0; i < 15; i += 5) {
+            R1(a, b, c, d, e, WL0(i + 0));
+            R1(e, a, b, c, d, WL0(i + 1));
+            R1(d, e, a, b, c, WL0(i + 2));
+            R1(c, d, e, a, b, WL0(i + 3));
+            R1(b, c, d, e, a, WL0(i + 4));
+        }
+
+        R1(a, b, c, d, e, WL0(15));
+        R1(e, a, b, c, d, W(16));
+        R1(d, e, a, b, c, W(17));
+        R1(c, d, e, a, b, W(18));
+        R1(b, c, d, e, a, W(19));
+
+        for (i = 20; i < 40; i += 5) {
+            R2(a, b, c, d, e, W(i + 0));
+            R2(e, a, b, c, d, W(i + 1));
+            R2(d, e, a, b, c, W(i + 2));
+            R2(c, d, e, a, b, W(i + 3));
+            R2(b, c, d, e, a, W(i + 4));
+        }
+
+        for (; i < 60; i += 5) {
+            R3(a, b, c, d, e, W(i + 0));
+            R3(e, a, b, c, d, W(i + 1));
+            R3(d, e, a, b, c, W(i + 2));
+            R3(c, d, e, a, b, W(i + 3));
+            R3(b, c, d, e, a, W(i + 4));
+        }
+
+        for (; i < 80; i += 5) {
+            R4(a, b, c, d, e, W(i + 0));
+            R4(e, a, b, c, d, W(i + 1));
+            R4(d, e, a, b, c, W(i + 2));
+            R4(c, d, e, a, b, W(i + 3));
+            R4(b, c, d, e, a, W(i + 4));
+        }
+
+        h_p[0] += a;
+        h_p[1] += b;
+        h_p[2] += c;
+        h_p[3] += d;
+        h_p[4] += e;
+
+        for (i = 0; i < LANES; i++) {
+            blocks_p[i] += BLOCK_SIZE;
+        }
 
-    for (i = 16; i < 80; i++) {
-        w[i] = rotateleft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        number_of_blocks--;
     }
+}
+
+#if defined(SHA1_HARDWARE_SHA_NI)
+
+/**
+ * Process blocks using the x86 SHA extensions. Four rounds are
+ * calculated per instruction, and the message schedule of the next
+ * four rounds is calculated in parallel.
+ */
+__attribute__((target("sha,sse4.1")))
+static void blocks_update_hardware(uint32_t *h_p,
+                                   const uint8_t *block_p,
+                                   size_t number_of_blocks)
+{
+    __m128i abcd;
+    __m128i abcd_saved;
+    __m128i e;
+    __m128i e_saved;
+    __m128i e_next;
+    __m128i msg[4];
+    __m128i mask;
+    int i;
+
+    /* Reverses the byte order of the 128 bits. */
+    mask = _mm_set_epi64x(0x0001020304050607ull, 0x08090a0b0c0d0e0full);
+    abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)h_p), 0x1b);
+    e = _mm_set_epi32(h_p[4], 0, 0, 0);
+
+    while (number_of_blocks > 0) {
+        abcd_saved = abcd;
+        e_saved = e;
+
+        for (i = 0; i < 20; i++) {
+            if (i < 4) {
+                msg[i] = _mm_shuffle_epi8(
+                    _mm_loadu_si128((const __m128i *)&block_p[16 * i]),
+                    mask);
+            }
+
+            if (i == 0) {
+                e_next = _mm_add_epi32(e, msg[0]);
+            } else {
+                e_next = _mm_sha1nexte_epu32(e, msg[i & 3]);
+            }
+
+            e = abcd;
+
+            /* The round function and constant changes every 20
+               rounds. */
+            switch (i / 5) {
+
+            case 0:
+                abcd = _mm_sha1rnds4_epu32(abcd, e_next, 0);
+                break;
+
+            case 1:
+                abcd = _mm_sha1rnds4_epu32(abcd, e_next, 1);
+                break;
+
+            case 2:
+                abcd = _mm_sha1rnds4_epu32(abcd, e_next, 2);
+                break;
+
+            default:
+                abcd = _mm_sha1rnds4_epu32(abcd, e_next, 3);
+                break;
+            }
+
+            /* Message schedule of upcoming rounds. */
+            if ((i >= 3) && (i < 19)) {
+                msg[(i + 1) & 3] = _mm_sha1msg2_epu32(msg[(i + 1) & 3],
+                                                      msg[i & 3]);
+            }
+
+            if ((i >= 2) && (i < 18)) {
+                msg[(i + 2) & 3] = _mm_xor_si128(msg[(i + 2) & 3],
+                                                 msg[i & 3]);
+            }
+
+            if ((i >= 1) && (i < 17)) {
+                msg[(i + 3) & 3] = _mm_sha1msg1_epu32(msg[(i + 3) & 3],
+                                                      msg[i & 3]);
+            }
+        }
 
-    a = self_p->h[0];
-    b = self_p->h[1];
-    c = self_p->h[2];
-    d = self_p->h[3];
-    e = self_p->h[4];
-
-    for (i = 0; i < 20; i++) {
-        f = ((b & c) ^ (~b & d));
-        t = rotateleft(a, 5) + f + e + 0x5a827999 + w[i];
-        e = d;
-        d = c;
-        c = rotateleft(b, 30);
-        b = a;
-        a = t;
+        e = _mm_sha1nexte_epu32(e, e_saved);
+        abcd = _mm_add_epi32(abcd, abcd_saved);
+
+        block_p += BLOCK_SIZE;
+        number_of_blocks--;
     }
 
-    for (; i < 40; i++) {
-        f = (b ^ c ^ d);
-        t = rotateleft(a, 5) + f + e + 0x6ed9eba1 + w[i];
-        e = d;
-        d = c;
-        c = rotateleft(b, 30);
-        b = a;
-        a = t;
+    _mm_storeu_si128((__m128i *)h_p, _mm_shuffle_epi32(abcd, 0x1b));
+    h_p[4] = _mm_extract_epi32(e, 3);
+}
+
+#endif
+
+static void blocks_update(struct sha1_t *self_p,
+                          const uint8_t *block_p,
+                          size_t number_of_blocks)
+{
+#if defined(SHA1_HARDWARE_SHA_NI)
+    if (__builtin_cpu_supports("sha")) {
+        blocks_update_hardware(&self_p->h[0], block_p, number_of_blocks);
+
+        return;
     }
+#endif
+
+    blocks_update_software(&self_p->h[0], block_p, number_of_blocks);
+}
+
+/**
+ * Process given number of blocks of up to LANES buffers in
+ * parallel.
+ */
+static void blocks_update_multi(struct sha1_t *shas_p,
+                                const uint8_t **blocks_pp,
+                                int number_of_buffers,
+                                size_t number_of_blocks)
+{
+    lanes_t h[5];
+    const uint8_t *blocks_p[LANES];
+    int buffer;
+    int i;
+    int j;
+
+#if defined(SHA1_HARDWARE_SHA_NI)
+    /* The SHA instructions are faster than the lanes. */
+    if (__builtin_cpu_supports("sha")) {
+        for (i = 0; i < number_of_buffers; i++) {
+            blocks_update_hardware(&shas_p[i].h[0],
+                                   blocks_pp[i],
+                                   number_of_blocks);
+        }
 
-    for (; i < 60; i++) {
-        f = ((b & c) ^ (b & d) ^ (c & d));
-        t = rotateleft(a, 5) + f + e + 0x8f1bbcdc + w[i];
-        e = d;
-        d = c;
-        c = rotateleft(b, 30);
-        b = a;
-        a = t;
+        return;
     }
+#endif
+
+    /* Unused lanes hash the first buffer once more. */
+    for (i = 0; i < LANES; i++) {
+        buffer = (i < number_of_buffers ? i : 0);
+        blocks_p[i] = blocks_pp[buffer];
 
-    for (; i < 80; i++) {
-        f = (b ^ c ^ d);
-        t = rotateleft(a,5) + f + e + 0xca62c1d6 + w[i];
-        e = d;
-        d = c;
-        c = rotateleft(b, 30);
-        b = a;
-        a = t;
+        for (j = 0; j < 5; j++) {
+            h[j][i] = shas_p[buffer].h[j];
+        }
     }
 
-    self_p->h[0] += a;
-    self_p->h[1] += b;
-    self_p->h[2] += c;
-    self_p->h[3] += d;
-    self_p->h[4] += e;
+    blocks_update_lanes(&h[0], &blocks_p[0], number_of_blocks);
+
+    for (i = 0; i < number_of_buffers; i++) {
+        for (j = 0; j < 5; j++) {
+            shas_p[i].h[j] = h[j][i];
+        }
+    }
 }
 
 int sha1_init(struct sha1_t *self_p)
@@ -129,22 +416,21 @@ int sha1_update(struct sha1_t *self_p,
 
     /* Prologue: Fill the buffer. */
     if (self_p->block.size > 0) {
-        if ((self_p->block.size + size) >= 64) {
-            temp = (64 - self_p->block.size);
+        if ((self_p->block.size + size) >= BLOCK_SIZE) {
+            temp = (BLOCK_SIZE - self_p->block.size);
             memcpy(&self_p->block.buf[self_p->block.size], b_p, temp);
             size -= temp;
             b_p += temp;
-            block_update(self_p, self_p->block.buf);
+            blocks_update(self_p, self_p->block.buf, 1);
             self_p->block.size = 0;
         }
     }
 
-    /* Main loop. */
-    while (size >= 64) {
-        memcpy(&self_p->block.buf[0], b_p, 64);
-        block_update(self_p, self_p->block.buf);
-        size -= 64;
-        b_p += 64;
+    /* Main loop: Full blocks directly from the input buffer. */
+    if (size >= BLOCK_SIZE) {
+        blocks_update(self_p, b_p, size / BLOCK_SIZE);
+        b_p += (size & ~(BLOCK_SIZE - 1));
+        size &= (BLOCK_SIZE - 1);
     }
 
     /* Epilogue: Save left over block in buffer. */
@@ -176,11 +462,11 @@ int sha1_digest(struct sha1_t *self_p,
     } else {
         self_p->block.buf[i++] = 0x80;
 
-        if (i < 64) {
-            memset(&self_p->block.buf[i], 0, 64 - i);
+        if (i < BLOCK_SIZE) {
+            memset(&self_p->block.buf[i], 0, BLOCK_SIZE - i);
         }
 
-        block_update(self_p, self_p->block.buf);
+        blocks_update(self_p, self_p->block.buf, 1);
         memset(self_p->block.buf, 0, 56);
     }
 
@@ -189,7 +475,7 @@ int sha1_digest(struct sha1_t *self_p,
         self_p->block.buf[56 + i] = ((8 * self_p->size) >> (56 - 8 * i));
     }
 
-    block_update(self_p, self_p->block.buf);
+    blocks_update(self_p, self_p->block.buf, 1);
 
     /* Copy the hash to the output buffer. */
     for (i = 0; i < membersof(self_p->h); i++) {
@@ -200,3 +486,54 @@ int sha1_digest(struct sha1_t *self_p,
 
     return (0);
 }
+
+int sha1_digest_multi(const void **bufs_pp,
+                      const size_t *sizes_p,
+                      size_t number_of_buffers,
+                      uint8_t *hashes_p)
+{
+    ASSERTN(bufs_pp != NULL, EINVAL);
+    ASSERTN(sizes_p != NULL, EINVAL);
+    ASSERTN(hashes_p != NULL, EINVAL);
+
+    struct sha1_t shas[LANES];
+    const uint8_t *blocks_p[LANES];
+    size_t number_of_blocks;
+    size_t offset;
+    size_t i;
+    int count;
+    int j;
+
+    for (i = 0; i < number_of_buffers; i += count) {
+        count = MIN(number_of_buffers - i, LANES);
+        number_of_blocks = (sizes_p[i] / BLOCK_SIZE);
+
+        for (j = 0; j < count; j++) {
+            sha1_init(&shas[j]);
+            blocks_p[j] = bufs_pp[i + j];
+            number_of_blocks = MIN(number_of_blocks,
+                                   sizes_p[i + j] / BLOCK_SIZE);
+        }
+
+        /* Full blocks of all buffers in parallel, then the rest of
+           each buffer one at a time. */
+        if (number_of_blocks > 0) {
+            blocks_update_multi(&shas[0],
+                                &blocks_p[0],
+                                count,
+                                number_of_blocks);
+        }
+
+        offset = (number_of_blocks * BLOCK_SIZE);
+
+        for (j = 0; j < count; j++) {
+            shas[j].size = offset;
+            sha1_update(&shas[j],
+                        (uint8_t *)&blocks_p[j][offset],
+                        sizes_p[i + j] - offset);
+            sha1_digest(&shas[j], &hashes_p[20 * (i + j)]);
+        }
+    }
+
+    return (0);
+}
@@ -77,4 +77,23 @@ int sha1_update(struct sha1_t *self_p,
 int sha1_digest(struct sha1_t *self_p,
                 uint8_t *hash_p);
 
+/**
+ * Calculate the digests of given number of independent buffers. Up
+ * to four buffers are hashed in parallel, which is faster than
+ * hashing one at a time on CPUs with SIMD instructions. The full
+ * blocks common to all buffers in a group of four are hashed in
+ * parallel, so buffers of about the same size are best.
+ *
+ * @param[in] bufs_pp Buffers to hash.
+ * @param[in] sizes_p Size of each buffer.
+ * @param[in] number_of_buffers Number of buffers.
+ * @param[out] hashes_p Digest of each buffer, 20 bytes each.
+ *
+ * @return zero(0) or negative error code.
+ */
+int sha1_digest_multi(const void **bufs_pp,
+                      const size_t *sizes_p,
+                      size_t number_of_buffers,
+                      uint8_t *hashes_p);
+
 #endif
@@ -0,0 +1,510 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#if CONFIG_SHA_HARDWARE == 1
+#    if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#        include <immintrin.h>
+#        define SHA256_HARDWARE_SHA_NI
+#    endif
+#endif
+
+#define BLOCK_SIZE                                           64
+
+/* Number of buffers hashed in parallel by sha256_digest_multi(). */
+#define LANES                                                 4
+
+/* One 32 bits word of each lane. Compiled to SIMD instructions on
+   targets having them. */
+typedef uint32_t lanes_t __attribute__((vector_size(4 * LANES)));
+
+static const uint32_t __attribute__((aligned(16))) k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* A macro to work on both words and lanes. */
+#define rotateright(value, positions)                                   \
+    (((value) >> (positions)) | ((value) << (32 - (positions))))
+
+static inline uint32_t load_be32(const uint8_t *buf_p)
+{
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | ((uint32_t)buf_p[3] << 0));
+}
+
+static inline lanes_t load_be32_lanes(const uint8_t **blocks_pp,
+                                      int offset)
+{
+    lanes_t value;
+    int i;
+
+    for (i = 0; i < LANES; i++) {
+        value[i] = load_be32(&blocks_pp[i][offset]);
+    }
+
+    return (value);
+}
+
+static inline void store_be32(uint8_t *buf_p, uint32_t value)
+{
+    buf_p[0] = (value >> 24);
+    buf_p[1] = (value >> 16);
+    buf_p[2] = (value >> 8);
+    buf_p[3] = (value >> 0);
+}
+
+#define S0(x) (rotateright(x, 2) ^ rotateright(x, 13) ^ rotateright(x, 22))
+#define S1(x) (rotateright(x, 6) ^ rotateright(x, 11) ^ rotateright(x, 25))
+#define s0(x) (rotateright(x, 7) ^ rotateright(x, 18) ^ ((x) >> 3))
+#define s1(x) (rotateright(x, 17) ^ rotateright(x, 19) ^ ((x) >> 10))
+
+/* The message schedule is kept in a circular buffer of 16 words. */
+#define W0(i) (w[(i)] = load_be32(&block_p[4 * (i)]))
+#define WL0(i) (w[(i)] = load_be32_lanes(&blocks_p[0], 4 * (i)))
+#define W(i)                                            \
+    (w[(i) & 15] += (s1(w[((i) + 14) & 15])             \
+                     + w[((i) + 9) & 15]                \
+                     + s0(w[((i) + 1) & 15])))
+
+/* One round. The variables are rotated by the caller instead of
+   moving the values between them. */
+#define R(a, b, c, d, e, f, g, h, i, w)                                 \
+    t = (h + S1(e) + (g ^ (e & (f ^ g))) + k[i] + w);                   \
+    d += t;                                                             \
+    h = (t + S0(a) + ((a & b) | (c & (a | b))))
+
+static void blocks_update_software(uint32_t *h_p,
+                                   const uint8_t *block_p,
+                                   size_t number_of_blocks)
+{
+    uint32_t a, b, c, d, e, f, g, h, t, w[16];
+    int i;
+
+    while (number_of_blocks > 0) {
+        a = h_p[0];
+        b = h_p[1];
+        c = h_p[2];
+        d = h_p[3];
+        e = h_p[4];
+        f = h_p[5];
+        g = h_p[6];
+        h = h_p[7];
+
+        for (i = 0; i < 16; i += 8) {
+            R(a, b, c, d, e, f, g, h, i + 0, W0(i + 0));
+            R(h, a, b, c, d, e, f, g, i + 1, W0(i + 1));
+            R(g, h, a, b, c, d, e, f, i + 2, W0(i + 2));
+            R(f, g, h, a, b, c, d, e, i + 3, W0(i + 3));
+            R(e, f, g, h, a, b, c, d, i + 4, W0(i + 4));
+            R(d, e, f, g, h, a, b, c, i + 5, W0(i + 5));
+            R(c, d, e, f, g, h, a, b, i + 6, W0(i + 6));
+            R(b, c, d, e, f, g, h, a, i + 7, W0(i + 7));
+        }
+
+        for (; i < 64; i += 8) {
+            R(a, b, c, d, e, f, g, h, i + 0, W(i + 0));
+            R(h, a, b, c, d, e, f, g, i + 1, W(i + 1));
+            R(g, h, a, b, c, d, e, f, i + 2, W(i + 2));
+            R(f, g, h, a, b, c, d, e, i + 3, W(i + 3));
+            R(e, f, g, h, a, b, c, d, i + 4, W(i + 4));
+            R(d, e, f, g, h, a, b, c, i + 5, W(i + 5));
+            R(c, d, e, f, g, h, a, b, i + 6, W(i + 6));
+            R(b, c, d, e, f, g, h, a, i + 7, W(i + 7));
+        }
+
+        h_p[0] += a;
+        h_p[1] += b;
+        h_p[2] += c;
+        h_p[3] += d;
+        h_p[4] += e;
+        h_p[5] += f;
+        h_p[6] += g;
+        h_p[7] += h;
+
+        block_p += BLOCK_SIZE;
+        number_of_blocks--;
+    }
+}
+
+/**
+ * Process given number of blocks in each lane, with the rounds of all
+ * lanes interleaved.
+ */
+static void blocks_update_lanes(lanes_t *h_p,
+                                const uint8_t **blocks_pp,
+                                size_t number_of_blocks)
+{
+    lanes_t a, b, c, d, e, f, g, h, t, w[16];
+    const uint8_t *blocks_p[LANES];
+    int i;
+
+    memcpy(&blocks_p[0], blocks_pp, sizeof(blocks_p));
+
+    while (number_of_blocks > 0) {
+        a = h_p[0];
+        b = h_p[1];
+        c = h_p[2];
+        d = h_p[3];
+        e = h_p[4];
+        f = h_p[5];
+        g = h_p[6];
+        h = h_p[7];
+
+        for (i = 0; i < 16; i += 8) {
+            R(a, b, c, d, e, f, g, h, i + 0, WL0(i + 0));
+            R(h, a, b, c, d, e, f, g, i + 1, WL0(i + 1));
+            R(g, h, a, b, c, d, e, f, i + 2, WL0(i + 2));
+            R(f, g, h, a, b, c, d, e, i + 3, WL0(i + 3));
+            R(e, f, g, h, a, b, c, d, i + 4, WL0(i + 4));
+            R(d, e, f, g, h, a, b, c, i + 5, WL0(i + 5));
+            R(c, d, e, f, g, h, a, b, i + 6, WL0(i + 6));
+            R(b, c, d, e, f, g, h, a, i + 7, WL0(i + 7));
+        }
+
+        for (; i < 64; i += 8) {
+            R(a, b, c, d, e, f, g, h, i + 0, W(i + 0));
+            R(h, a, b, c, d, e, f, g, i + 1, W(i + 1));
+            R(g, h, a, b, c, d, e, f, i + 2, W(i + 2));
+            R(f, g, h, a, b, c, d, e, i + 3, W(i + 3));
+            R(e, f, g, h, a, b, c, d, i + 4, W(i + 4));
+            R(d, e, f, g, h, a, b, c, i + 5, W(i + 5));
+            R(c, d, e, f, g, h, a, b, i + 6, W(i + 6));
+            R(b, c, d, e, f, g, h, a, i + 7, W(i + 7));
+        }
+
+        h_p[0] += a;
+        h_p[1] += b;
+        h_p[2] += c;
+        h_p[3] += d;
+        h_p[4] += e;
+        h_p[5] += f;
+        h_p[6] += g;
+        h_p[7] += h;
+
+        for (i = 0; i < LANES; i++) {
+            blocks_p[i] += BLOCK_SIZE;
+        }
+
+        number_of_blocks--;
+    }
+}
+
+#if defined(SHA256_HARDWARE_SHA_NI)
+
+/**
+ * Process blocks using the x86 SHA extensions. Two rounds are
+ * calculated per instruction, and the message schedule of upcoming
+ * rounds is calculated in parallel.
+ */
+__attribute__((target("sha,sse4.1")))
+static void blocks_update_hardware(uint32_t *h_p,
+                                   const uint8_t *block_p,
+                                   size_t number_of_blocks)
+{
+    __m128i abef;
+    __m128i cdgh;
+    __m128i abef_saved;
+    __m128i cdgh_saved;
+    __m128i msg[4];
+    __m128i value;
+    __m128i mask;
+    int i;
+
+    /* Reverses the byte order of each 32 bits word. */
+    mask = _mm_set_epi64x(0x0c0d0e0f08090a0bull, 0x0405060700010203ull);
+
+    /* The instructions want the state as ABEF and CDGH. */
+    value = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&h_p[0]),
+                              0xb1);
+    cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&h_p[4]),
+                             0x1b);
+    abef = _mm_alignr_epi8(value, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, value, 0xf0);
+
+    while (number_of_blocks > 0) {
+        abef_saved = abef;
+        cdgh_saved = cdgh;
+
+        for (i = 0; i < 16; i++) {
+            if (i < 4) {
+                msg[i] = _mm_shuffle_epi8(
+                    _mm_loadu_si128((const __m128i *)&block_p[16 * i]),
+                    mask);
+            }
+
+            value = _mm_add_epi32(msg[i & 3],
+                                  _mm_load_si128((const __m128i *)&k[4 * i]));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, value);
+            value = _mm_shuffle_epi32(value, 0x0e);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, value);
+
+            /* Message schedule of the four rounds after the next
+               four. */
+            if ((i >= 3) && (i < 15)) {
+                value = _mm_alignr_epi8(msg[i & 3], msg[(i + 3) & 3], 4);
+                msg[(i + 1) & 3] = _mm_sha256msg2_epu32(
+                    _mm_add_epi32(_mm_sha256msg1_epu32(msg[(i + 1) & 3],
+                                                       msg[(i + 2) & 3]),
+                                  value),
+                    msg[i & 3]);
+            }
+        }
+
+        abef = _mm_add_epi32(abef, abef_saved);
+        cdgh = _mm_add_epi32(cdgh, cdgh_saved);
+
+        block_p += BLOCK_SIZE;
+        number_of_blocks--;
+    }
+
+    value = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128((__m128i *)&h_p[0], _mm_blend_epi16(value, cdgh, 0xf0));
+    _mm_storeu_si128((__m128i *)&h_p[4], _mm_alignr_epi8(cdgh, value, 8));
+}
+
+#endif
+
+static void blocks_update(struct sha256_t *self_p,
+                          const uint8_t *block_p,
+                          size_t number_of_blocks)
+{
+#if defined(SHA256_HARDWARE_SHA_NI)
+    if (__builtin_cpu_supports("sha")) {
+        blocks_update_hardware(&self_p->h[0], block_p, number_of_blocks);
+
+        return;
+    }
+#endif
+
+    blocks_update_software(&self_p->h[0], block_p, number_of_blocks);
+}
+
+/**
+ * Process given number of blocks of up to LANES buffers in
+ * parallel.
+ */
+static void blocks_update_multi(struct sha256_t *shas_p,
+                                const uint8_t **blocks_pp,
+                                int number_of_buffers,
+                                size_t number_of_blocks)
+{
+    lanes_t h[8];
+    const uint8_t *blocks_p[LANES];
+    int buffer;
+    int i;
+    int j;
+
+#if defined(SHA256_HARDWARE_SHA_NI)
+    /* The SHA instructions are faster than the lanes. */
+    if (__builtin_cpu_supports("sha")) {
+        for (i = 0; i < number_of_buffers; i++) {
+            blocks_update_hardware(&shas_p[i].h[0],
+                                   blocks_pp[i],
+                                   number_of_blocks);
+        }
+
+        return;
+    }
+#endif
+
+    /* Unused lanes hash the first buffer once more. */
+    for (i = 0; i < LANES; i++) {
+        buffer = (i < number_of_buffers ? i : 0);
+        blocks_p[i] = blocks_pp[buffer];
+
+        for (j = 0; j < 8; j++) {
+            h[j][i] = shas_p[buffer].h[j];
+        }
+    }
+
+    blocks_update_lanes(&h[0], &blocks_p[0], number_of_blocks);
+
+    for (i = 0; i < number_of_buffers; i++) {
+        for (j = 0; j < 8; j++) {
+            shas_p[i].h[j] = h[j][i];
+        }
+    }
+}
+
+int sha256_init(struct sha256_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    self_p->block.size = 0;
+    self_p->h[0] = 0x6a09e667;
+    self_p->h[1] = 0xbb67ae85;
+    self_p->h[2] = 0x3c6ef372;
+    self_p->h[3] = 0xa54ff53a;
+    self_p->h[4] = 0x510e527f;
+    self_p->h[5] = 0x9b05688c;
+    self_p->h[6] = 0x1f83d9ab;
+    self_p->h[7] = 0x5be0cd19;
+    self_p->size = 0;
+
+    return (0);
+}
+
+int sha256_update(struct sha256_t *self_p,
+                  const void *buf_p,
+                  size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+
+    uint32_t temp;
+    const uint8_t *b_p = buf_p;
+
+    self_p->size += size;
+
+    /* Prologue: Fill the buffer. */
+    if (self_p->block.size > 0) {
+        if ((self_p->block.size + size) >= BLOCK_SIZE) {
+            temp = (BLOCK_SIZE - self_p->block.size);
+            memcpy(&self_p->block.buf[self_p->block.size], b_p, temp);
+            size -= temp;
+            b_p += temp;
+            blocks_update(self_p, self_p->block.buf, 1);
+            self_p->block.size = 0;
+        }
+    }
+
+    /* Main loop: Full blocks directly from the input buffer. */
+    if (size >= BLOCK_SIZE) {
+        blocks_update(self_p, b_p, size / BLOCK_SIZE);
+        b_p += (size & ~(BLOCK_SIZE - 1));
+        size &= (BLOCK_SIZE - 1);
+    }
+
+    /* Epilogue: Save left over block in buffer. */
+    if (size > 0) {
+        memcpy(&self_p->block.buf[self_p->block.size], b_p, size);
+        self_p->block.size += size;
+    }
+
+    return (0);
+}
+
+int sha256_digest(struct sha256_t *self_p,
+                  uint8_t *hash_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(hash_p != NULL, EINVAL);
+
+    int i;
+
+    i = self_p->block.size;
+    self_p->block.buf[i++] = 0x80;
+
+    /* Add the last byte 0x80 and zero-padding. */
+    if (i > 56) {
+        memset(&self_p->block.buf[i], 0, BLOCK_SIZE - i);
+        blocks_update(self_p, self_p->block.buf, 1);
+        i = 0;
+    }
+
+    memset(&self_p->block.buf[i], 0, 56 - i);
+
+    /* Append the message length and do the last block update. */
+    for (i = 0; i < 8; i++) {
+        self_p->block.buf[56 + i] = ((8 * self_p->size) >> (56 - 8 * i));
+    }
+
+    blocks_update(self_p, self_p->block.buf, 1);
+
+    /* Copy the hash to the output buffer. */
+    for (i = 0; i < membersof(self_p->h); i++) {
+        store_be32(&hash_p[4 * i], self_p->h[i]);
+    }
+
+    return (0);
+}
+
+int sha256_digest_multi(const void **bufs_pp,
+                        const size_t *sizes_p,
+                        size_t number_of_buffers,
+                        uint8_t *hashes_p)
+{
+    ASSERTN(bufs_pp != NULL, EINVAL);
+    ASSERTN(sizes_p != NULL, EINVAL);
+    ASSERTN(hashes_p != NULL, EINVAL);
+
+    struct sha256_t shas[LANES];
+    const uint8_t *blocks_p[LANES];
+    size_t number_of_blocks;
+    size_t offset;
+    size_t i;
+    int count;
+    int j;
+
+    for (i = 0; i < number_of_buffers; i += count) {
+        count = MIN(number_of_buffers - i, LANES);
+        number_of_blocks = (sizes_p[i] / BLOCK_SIZE);
+
+        for (j = 0; j < count; j++) {
+            sha256_init(&shas[j]);
+            blocks_p[j] = bufs_pp[i + j];
+            number_of_blocks = MIN(number_of_blocks,
+                                   sizes_p[i + j] / BLOCK_SIZE);
+        }
+
+        /* Full blocks of all buffers in parallel, then the rest of
+           each buffer one at a time. */
+        if (number_of_blocks > 0) {
+            blocks_update_multi(&shas[0],
+                                &blocks_p[0],
+                                count,
+                                number_of_blocks);
+        }
+
+        offset = (number_of_blocks * BLOCK_SIZE);
+
+        for (j = 0; j < count; j++) {
+            shas[j].size = offset;
+            sha256_update(&shas[j],
+                          &blocks_p[j][offset],
+                          sizes_p[i + j] - offset);
+            sha256_digest(&shas[j], &hashes_p[32 * (i + j)]);
+        }
+    }
+
+    return (0);
+}
@@ -88,6 +88,7 @@ int http_websocket_client_init(struct http_websocket_client_t *self_p,
     self_p->server.host_p = host_p;
     self_p->server.port = port;
     self_p->path_p = path_p;
+    self_p->frame.left = 0;
 
     return (0);
 }
@@ -164,7 +165,7 @@ ssize_t http_websocket_client_read(struct http_websocket_client_t *self_p,
     ASSERTN(buf_p != NULL, EINVAL);
     ASSERTN(size > 0, EINVAL);
 
-    uint8_t buf[16];
+    uint8_t buf[16], *b_p = buf_p;
     size_t left = size, n;
 
     while (left > 0) {
@@ -176,11 +177,17 @@ ssize_t http_websocket_client_read(struct http_websocket_client_t *self_p,
                 n = left;
             }
 
-            if (socket_read(&self_p->server.socket, buf_p, n) != n) {
+            if (socket_read(&self_p->server.socket, b_p, n) != n) {
                 return (-EIO);
             }
 
+            inet_http_websocket_mask(b_p,
+                                     n,
+                                     &self_p->frame.masking_key[0],
+                                     self_p->frame.pos);
+            self_p->frame.pos += n;
             self_p->frame.left -= n;
+            b_p += n;
             left -= n;
         }
 
@@ -210,10 +217,18 @@ ssize_t http_websocket_client_read(struct http_websocket_client_t *self_p,
             }
 
             if (buf[1] & INET_HTTP_WEBSOCKET_MASK) {
-                if (socket_read(&self_p->server.socket, buf, 4) != 4) {
+                if (socket_read(&self_p->server.socket,
+                                &self_p->frame.masking_key[0],
+                                4) != 4) {
                     return (-EIO);
                 }
+            } else {
+                memset(&self_p->frame.masking_key[0],
+                       0,
+                       sizeof(self_p->frame.masking_key));
             }
+
+            self_p->frame.pos = 0;
         }
     }
 
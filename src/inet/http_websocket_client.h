@@ -39,6 +39,8 @@ struct http_websocket_client_t {
     } server;
     struct {
         size_t left;
+        size_t pos;
+        uint8_t masking_key[4];
     } frame;
     const char *path_p;
 };
@@ -28,6 +28,60 @@
 
 #include "simba.h"
 
+/**
+ * Read a frame header into the frame state.
+ *
+ * @return Frame opcode or negative error code.
+ */
+static int read_frame_header(struct http_websocket_server_t *self_p)
+{
+    uint8_t buf[10];
+    size_t left;
+
+    if (socket_read(self_p->socket_p, buf, 2) != 2) {
+        return (-EIO);
+    }
+
+    left = (buf[1] & ~INET_HTTP_WEBSOCKET_MASK);
+
+    if (left == 126) {
+        if (socket_read(self_p->socket_p, &buf[2], 2) != 2) {
+            return (-EIO);
+        }
+
+        left = ((uint32_t)(buf[2]) << 8 | buf[3]);
+    } else if (left == 127) {
+        if (socket_read(self_p->socket_p, &buf[2], 8) != 8) {
+            return (-EIO);
+        }
+
+        left = ((uint32_t)(buf[6]) << 24
+                | (uint32_t)(buf[7]) << 16
+                | (uint32_t)(buf[8]) << 8
+                | buf[9]);
+    }
+
+    /* Read the mask. */
+    if (buf[1] & INET_HTTP_WEBSOCKET_MASK) {
+        if (socket_read(self_p->socket_p,
+                        &self_p->frame.masking_key[0],
+                        sizeof(self_p->frame.masking_key))
+            != sizeof(self_p->frame.masking_key)) {
+            return (-EIO);
+        }
+    } else {
+        memset(&self_p->frame.masking_key[0],
+               0,
+               sizeof(self_p->frame.masking_key));
+    }
+
+    self_p->frame.fin = (buf[0] & INET_HTTP_WEBSOCKET_FIN);
+    self_p->frame.left = left;
+    self_p->frame.pos = 0;
+
+    return (buf[0] & INET_HTTP_WEBSOCKET_OPCODE);
+}
+
 int http_websocket_server_init(struct http_websocket_server_t *self_p,
                                struct socket_t *socket_p)
 {
@@ -35,6 +89,9 @@ int http_websocket_server_init(struct http_websocket_server_t *self_p,
     ASSERTN(socket_p != NULL, EINVAL)
 
     self_p->socket_p = socket_p;
+    self_p->frame.fin = 1;
+    self_p->frame.left = 0;
+    self_p->frame.pos = 0;
 
     return (0);
 }
@@ -106,84 +163,137 @@ ssize_t http_websocket_server_read(struct http_websocket_server_t *self_p,
     ASSERTN(buf_p != NULL, EINVAL)
     ASSERTN(size > 0, EINVAL)
 
-    uint8_t buf[16], *b_p = buf_p;
-    size_t payload_left, left = size, n;
-    int fin = 0;
-    uint8_t masking_key[4];
-    int pos;
-    int i;
+    uint8_t *b_p = buf_p;
+    size_t left = size;
+    ssize_t res;
+    int type;
 
-    while (fin == 0) {
-        /* Read the next frame. */
-        if (socket_read(self_p->socket_p, buf, 2) != 2) {
-            return (-EIO);
+    res = http_websocket_server_read_begin(self_p, &type);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    if (type_p != NULL) {
+        *type_p = type;
+    }
+
+    while (left > 0) {
+        res = http_websocket_server_read_chunk(self_p, b_p, left);
+
+        if (res < 0) {
+            return (res);
+        } else if (res == 0) {
+            break;
         }
 
-        fin = (buf[0] & INET_HTTP_WEBSOCKET_FIN);
-        payload_left = (buf[1] & ~INET_HTTP_WEBSOCKET_MASK);
+        b_p += res;
+        left -= res;
+    }
 
-        if (payload_left == 126) {
-            if (socket_read(self_p->socket_p, &buf[2], 2) != 2) {
-                return (-EIO);
-            }
+    /* Discard leftover data. */
+    res = http_websocket_server_read_end(self_p);
 
-            payload_left = ((uint32_t)(buf[2]) << 8 | buf[3]);
-        } else if (payload_left == 127) {
-            if (socket_read(self_p->socket_p, &buf[2], 8) != 8) {
-                return (-EIO);
-            }
+    if (res != 0) {
+        return (res);
+    }
+
+    return (size - left);
+}
 
-            payload_left = ((uint32_t)(buf[6]) << 24
-                    | (uint32_t)(buf[7]) << 16
-                    | (uint32_t)(buf[8]) << 8
-                    | buf[9]);
+int http_websocket_server_read_begin(struct http_websocket_server_t *self_p,
+                                     int *type_p)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(type_p != NULL, EINVAL)
+
+    int res;
+
+    res = read_frame_header(self_p);
+
+    if (res < 0) {
+        return (res);
+    }
+
+    *type_p = res;
+
+    return (0);
+}
+
+ssize_t http_websocket_server_read_chunk(struct http_websocket_server_t *self_p,
+                                         void *buf_p,
+                                         size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+    ASSERTN(buf_p != NULL, EINVAL)
+    ASSERTN(size > 0, EINVAL)
+
+    int res;
+
+    /* Continuation frames until there is payload or the message
+       ends. */
+    while (self_p->frame.left == 0) {
+        if (self_p->frame.fin != 0) {
+            return (0);
         }
 
-        /* Read the mask. */
-        if (buf[1] & INET_HTTP_WEBSOCKET_MASK) {
-            if (socket_read(self_p->socket_p,
-                            &masking_key[0],
-                            sizeof(masking_key)) != sizeof(masking_key)) {
-                return (-EIO);
-            }
-        } else {
-            memset(&masking_key[0], 0, sizeof(masking_key));
+        res = read_frame_header(self_p);
+
+        if (res < 0) {
+            return (res);
         }
+    }
 
-        /* Read the payload. */
-        pos = 0;
+    if (size > self_p->frame.left) {
+        size = self_p->frame.left;
+    }
 
-        while ((payload_left > 0) && (left > 0)) {
-            if (payload_left < left) {
-                n = payload_left;
-            } else {
-                n = left;
-            }
+    if (socket_read(self_p->socket_p, buf_p, size) != size) {
+        return (-EIO);
+    }
 
-            if (socket_read(self_p->socket_p, b_p, n) != n) {
-                return (-1);
-            }
+    inet_http_websocket_mask(buf_p,
+                             size,
+                             &self_p->frame.masking_key[0],
+                             self_p->frame.pos);
+    self_p->frame.pos += size;
+    self_p->frame.left -= size;
+
+    return (size);
+}
+
+int http_websocket_server_read_end(struct http_websocket_server_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL)
+
+    uint8_t buf[64];
+    size_t n;
+    int res;
 
-            for (i = 0; i < n; i++) {
-                *b_p++ ^= masking_key[pos % 4];
-                pos++;
+    while (1) {
+        /* Discard the rest of the frame payload in bulk. */
+        while (self_p->frame.left > 0) {
+            n = MIN(self_p->frame.left, sizeof(buf));
+
+            if (socket_read(self_p->socket_p, buf, n) != n) {
+                return (-EIO);
             }
 
-            left -= n;
-            payload_left -= n;
+            self_p->frame.left -= n;
         }
 
-        /* Discard leftover data. */
-        while (payload_left > 0) {
-            if (socket_read(self_p->socket_p, buf, 1) != 1) {
-                return (-1);
-            }
+        if (self_p->frame.fin != 0) {
+            break;
+        }
+
+        res = read_frame_header(self_p);
 
-            payload_left--;
+        if (res < 0) {
+            return (res);
         }
     }
 
-    return (size - left);
+    return (0);
 }
 
 ssize_t http_websocket_server_write(struct http_websocket_server_t *self_p,
@@ -33,6 +33,12 @@
 
 struct http_websocket_server_t {
     struct socket_t *socket_p;
+    struct {
+        int fin;
+        size_t left;
+        size_t pos;
+        uint8_t masking_key[4];
+    } frame;
 };
 
 /**
@@ -75,6 +81,48 @@ ssize_t http_websocket_server_read(struct http_websocket_server_t *self_p,
                                    void *buf_p,
                                    size_t size);
 
+/**
+ * Start reading a message from given websocket. The message payload
+ * is then read in chunks with
+ * `http_websocket_server_read_chunk()`, so messages larger than any
+ * single buffer can be handled. Finish the message with
+ * `http_websocket_server_read_end()`.
+ *
+ * @param[in] self_p Websocket to read from.
+ * @param[out] type_p Read message type.
+ *
+ * @return zero(0) or negative error code.
+ */
+int http_websocket_server_read_begin(struct http_websocket_server_t *self_p,
+                                     int *type_p);
+
+/**
+ * Read the next payload chunk of the current message. Payload is
+ * returned as it arrives, one frame at a time, and may hence be
+ * shorter than the buffer. Continuation frames are handled
+ * transparently.
+ *
+ * @param[in] self_p Websocket to read from.
+ * @param[in] buf_p Buffer to read into.
+ * @param[in] size Size of the buffer.
+ *
+ * @return Number of bytes read, zero(0) at the end of the message, or
+ *         negative error code.
+ */
+ssize_t http_websocket_server_read_chunk(struct http_websocket_server_t *self_p,
+                                         void *buf_p,
+                                         size_t size);
+
+/**
+ * Finish reading the current message. Any payload not yet read is
+ * discarded.
+ *
+ * @param[in] self_p Websocket to read from.
+ *
+ * @return zero(0) or negative error code.
+ */
+int http_websocket_server_read_end(struct http_websocket_server_t *self_p);
+
 /**
  * Write given message to given websocket.
  *
@@ -28,6 +28,9 @@
 
 #include "simba.h"
 
+/* Words may alias any buffer. */
+typedef unsigned long __attribute__((__may_alias__)) word_t;
+
 static uint32_t inet_checksum_begin(void)
 {
   return (0);
@@ -132,3 +135,63 @@ uint16_t inet_checksum(void *buf_p, size_t size)
 
     return (inet_checksum_end(acc));
 }
+
+void inet_http_websocket_mask(void *buf_p,
+                              size_t size,
+                              const uint8_t *masking_key_p,
+                              size_t offset)
+{
+    uint8_t *b_p;
+    word_t *w_p;
+    union {
+        unsigned long word;
+        uint8_t bytes[sizeof(unsigned long)];
+    } key;
+    int i;
+
+    /* Masking with an all zeros key is a no-op. */
+    if ((masking_key_p[0] | masking_key_p[1]
+         | masking_key_p[2] | masking_key_p[3]) == 0) {
+        return;
+    }
+
+    b_p = buf_p;
+
+    /* Bytes up to the first word boundary. */
+    while ((size > 0) && (((uintptr_t)b_p % sizeof(key.word)) != 0)) {
+        *b_p++ ^= masking_key_p[offset % 4];
+        offset++;
+        size--;
+    }
+
+    /* The masking key rotated to the current offset and repeated to
+       fill a machine word. The word size is a multiple of four, so
+       the rotation is the same for all words. */
+    for (i = 0; i < sizeof(key.bytes); i++) {
+        key.bytes[i] = masking_key_p[(offset + i) % 4];
+    }
+
+    /* Two words per iteration, 16 bytes on 64 bit machines. */
+    w_p = (word_t *)b_p;
+
+    while (size >= 2 * sizeof(key.word)) {
+        w_p[0] ^= key.word;
+        w_p[1] ^= key.word;
+        w_p += 2;
+        size -= 2 * sizeof(key.word);
+    }
+
+    if (size >= sizeof(key.word)) {
+        *w_p++ ^= key.word;
+        size -= sizeof(key.word);
+    }
+
+    /* Trailing bytes. */
+    b_p = (uint8_t *)w_p;
+
+    while (size > 0) {
+        *b_p++ ^= masking_key_p[offset % 4];
+        offset++;
+        size--;
+    }
+}
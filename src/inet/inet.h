@@ -105,4 +105,23 @@ char *inet_ntoa(const struct inet_ip_addr_t *src_p,
  */
 uint16_t inet_checksum(void *buf_p, size_t size);
 
+/**
+ * Mask or unmask given websocket payload with given masking key, as
+ * described in RFC 6455. The payload is processed a machine word at
+ * a time. Masking and unmasking is the same operation.
+ *
+ * @param[in,out] buf_p Payload to mask.
+ * @param[in] size Size of the payload.
+ * @param[in] masking_key_p Four bytes masking key.
+ * @param[in] offset Offset of given payload chunk in the frame, used
+ *                   to continue masking a frame processed in several
+ *                   chunks.
+ *
+ * @return void
+ */
+void inet_http_websocket_mask(void *buf_p,
+                              size_t size,
+                              const uint8_t *masking_key_p,
+                              size_t offset);
+
 #endif
@@ -337,3 +337,494 @@ ssize_t isotp_output(struct isotp_t *self_p,
 
     return (res);
 }
+
+#if CONFIG_ISOTP_CHANNEL == 1
+
+#define FLOW_STATUS_CONTINUE_TO_SEND               0
+#define FLOW_STATUS_WAIT                           1
+#define FLOW_STATUS_OVERFLOW                       2
+
+/* Maximum number of consecutive frames written to the driver at
+   once. */
+#define TX_FRAMES_MAX                              8
+
+static void frame_init(struct isotp_channel_t *self_p,
+                       struct can_frame_t *frame_p,
+                       size_t size)
+{
+    memset(frame_p, 0, sizeof(*frame_p));
+    frame_p->id = (self_p->tx_id & ~CAN_ID_EXTENDED);
+    frame_p->extended_frame = ((self_p->tx_id & CAN_ID_EXTENDED) != 0);
+    frame_p->size = size;
+}
+
+static int write_frames(struct isotp_channel_t *self_p,
+                        struct can_frame_t *frames_p,
+                        int number_of_frames)
+{
+    ssize_t size;
+
+    size = (number_of_frames * sizeof(*frames_p));
+
+    if (can_write(self_p->can_p, frames_p, size) != size) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+/**
+ * Read the next frame, or time out if no frame is received within
+ * the channel timeout.
+ */
+static int read_frame(struct isotp_channel_t *self_p,
+                      struct can_frame_t *frame_p,
+                      int timeout)
+{
+    struct time_t time;
+
+    if (timeout == 1) {
+        time.seconds = (CONFIG_ISOTP_CHANNEL_TIMEOUT_MS / 1000);
+        time.nanoseconds = (1000000L
+                            * (CONFIG_ISOTP_CHANNEL_TIMEOUT_MS % 1000));
+
+        if (chan_poll(&self_p->subscriber.queue, &time) == NULL) {
+            return (-ETIMEDOUT);
+        }
+    }
+
+    if (can_subscriber_read(&self_p->subscriber,
+                            frame_p,
+                            sizeof(*frame_p)) != sizeof(*frame_p)) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+static int write_flow_control(struct isotp_channel_t *self_p,
+                              int flow_status,
+                              int block_size)
+{
+    struct can_frame_t frame;
+
+    frame_init(self_p, &frame, 3);
+    frame.data.u8[0] = ((TYPE_FLOW_CONTROL_FRAME << 4) | flow_status);
+    frame.data.u8[1] = block_size;
+    frame.data.u8[2] = self_p->st_min;
+
+    return (write_frames(self_p, &frame, 1));
+}
+
+/**
+ * Encode given separation time, rounded up. 0xf1-0xf9 are 100-900
+ * us, and 0xfa-0xff are reserved, so anything above 900 us is sent in
+ * whole milliseconds.
+ */
+static uint8_t st_min_encode(long st_min_us)
+{
+    if (st_min_us <= 0) {
+        return (0);
+    } else if (st_min_us <= 900) {
+        return (0xf0 + DIV_CEIL(st_min_us, 100));
+    } else {
+        return (MIN(DIV_CEIL(st_min_us, 1000), 0x7f));
+    }
+}
+
+static long st_min_decode(uint8_t st_min)
+{
+    if (st_min <= 0x7f) {
+        return (1000L * st_min);
+    } else if ((st_min >= 0xf1) && (st_min <= 0xf9)) {
+        return (100L * (st_min - 0xf0));
+    } else {
+        /* Reserved values shall be interpreted as the maximum. */
+        return (127000L);
+    }
+}
+
+/**
+ * Wait for a continue to send flow control frame from the peer.
+ */
+static int wait_for_flow_control(struct isotp_channel_t *self_p,
+                                 int *block_size_p,
+                                 long *st_min_us_p)
+{
+    int res;
+    int waits;
+    struct can_frame_t frame;
+
+    waits = 0;
+
+    while (1) {
+        res = read_frame(self_p, &frame, 1);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        if ((frame.size < 3)
+            || ((frame.data.u8[0] >> 4) != TYPE_FLOW_CONTROL_FRAME)) {
+            continue;
+        }
+
+        switch (frame.data.u8[0] & 0x0f) {
+
+        case FLOW_STATUS_CONTINUE_TO_SEND:
+            *block_size_p = frame.data.u8[1];
+            *st_min_us_p = st_min_decode(frame.data.u8[2]);
+
+            return (0);
+
+        case FLOW_STATUS_WAIT:
+            waits++;
+
+            if (waits > CONFIG_ISOTP_CHANNEL_WAIT_FRAMES_MAX) {
+                return (-EBUSY);
+            }
+
+            break;
+
+        case FLOW_STATUS_OVERFLOW:
+            return (-EMSGSIZE);
+
+        default:
+            return (-EPROTO);
+        }
+    }
+}
+
+/**
+ * Receive the consecutive frames of a segmented message directly
+ * into given buffer, sending a flow control frame before each block.
+ */
+static ssize_t read_consecutive_frames(struct isotp_channel_t *self_p,
+                                       uint8_t *buf_p,
+                                       size_t offset,
+                                       size_t size)
+{
+    int res;
+    int index;
+    int block_left;
+    size_t chunk_size;
+    struct can_frame_t frame;
+
+    index = 1;
+    block_left = 0;
+
+    while (offset < size) {
+        if (block_left == 0) {
+            res = write_flow_control(self_p,
+                                     FLOW_STATUS_CONTINUE_TO_SEND,
+                                     self_p->block_size);
+
+            if (res != 0) {
+                return (res);
+            }
+
+            block_left = self_p->block_size;
+        }
+
+        res = read_frame(self_p, &frame, 1);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        if ((frame.data.u8[0] >> 4) != TYPE_CONSECUTIVE_FRAME) {
+            return (-EPROTO);
+        }
+
+        if ((frame.data.u8[0] & 0x0f) != index) {
+            return (-EPROTO);
+        }
+
+        if (frame.size < 2) {
+            return (-EPROTO);
+        }
+
+        chunk_size = MIN(size - offset, frame.size - 1u);
+        memcpy(&buf_p[offset], &frame.data.u8[1], chunk_size);
+        offset += chunk_size;
+        index = ((index + 1) % 16);
+        block_left--;
+    }
+
+    return (size);
+}
+
+int isotp_channel_init(struct isotp_channel_t *self_p,
+                       struct can_driver_t *can_p,
+                       uint32_t rx_id,
+                       uint32_t tx_id,
+                       struct can_frame_t *rxbuf_p,
+                       size_t size,
+                       far_string_t dropped_path_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(can_p != NULL, EINVAL);
+    ASSERTN(rxbuf_p != NULL, EINVAL);
+    ASSERTN(size >= 2 * sizeof(*rxbuf_p), EINVAL);
+    ASSERTN(dropped_path_p != NULL, EINVAL);
+
+    int res;
+
+    self_p->can_p = can_p;
+    self_p->tx_id = tx_id;
+
+    res = can_subscriber_init(&self_p->subscriber,
+                              rxbuf_p,
+                              size,
+                              dropped_path_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    res = can_filter_init_exact(&self_p->filter, rx_id, &self_p->subscriber);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (isotp_channel_set_flow_control(self_p, 0, 0));
+}
+
+int isotp_channel_start(struct isotp_channel_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (can_filter_add(self_p->can_p, &self_p->filter));
+}
+
+int isotp_channel_stop(struct isotp_channel_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (can_filter_remove(self_p->can_p, &self_p->filter));
+}
+
+int isotp_channel_set_flow_control(struct isotp_channel_t *self_p,
+                                   int block_size,
+                                   long st_min_us)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(block_size >= 0, EINVAL);
+    ASSERTN(st_min_us >= 0, EINVAL);
+
+    int capacity;
+
+    /* Never ask for more frames than fits in the reception buffer, or
+       frames will be dropped when the application is slow. */
+    capacity = ((queue_size(&self_p->subscriber.queue)
+                 + queue_unused_size(&self_p->subscriber.queue))
+                / sizeof(struct can_frame_t));
+    capacity = MIN(capacity, 255);
+
+    if ((block_size == 0) || (block_size > capacity)) {
+        block_size = capacity;
+    }
+
+    self_p->block_size = block_size;
+    self_p->st_min = st_min_encode(st_min_us);
+
+    return (0);
+}
+
+ssize_t isotp_channel_read(struct isotp_channel_t *self_p,
+                           void *buf_p,
+                           size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+
+    int res;
+    size_t message_size;
+    size_t offset;
+    struct can_frame_t frame;
+    uint8_t *u8_p;
+
+    u8_p = buf_p;
+
+    while (1) {
+        res = read_frame(self_p, &frame, 0);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        switch (frame.data.u8[0] >> 4) {
+
+        case TYPE_SINGLE_FRAME:
+            message_size = (frame.data.u8[0] & 0x0f);
+
+            if ((message_size == 0) || (message_size > frame.size - 1u)) {
+                continue;
+            }
+
+            if (message_size > size) {
+                return (-EMSGSIZE);
+            }
+
+            memcpy(u8_p, &frame.data.u8[1], message_size);
+
+            return (message_size);
+
+        case TYPE_FIRST_FRAME:
+            if (frame.size != 8) {
+                continue;
+            }
+
+            message_size = (((frame.data.u8[0] & 0x0f) << 8)
+                            | frame.data.u8[1]);
+
+            if (message_size == 0) {
+                /* 32 bits first frame length. */
+                message_size = (((uint32_t)frame.data.u8[2] << 24)
+                                | ((uint32_t)frame.data.u8[3] << 16)
+                                | ((uint32_t)frame.data.u8[4] << 8)
+                                | frame.data.u8[5]);
+                offset = 2;
+
+                if (message_size <= 4095) {
+                    continue;
+                }
+            } else {
+                offset = 6;
+
+                if (message_size < 8) {
+                    continue;
+                }
+            }
+
+            if (message_size > size) {
+                res = write_flow_control(self_p, FLOW_STATUS_OVERFLOW, 0);
+
+                if (res != 0) {
+                    return (res);
+                }
+
+                return (-EMSGSIZE);
+            }
+
+            memcpy(u8_p, &frame.data.u8[8 - offset], offset);
+
+            return (read_consecutive_frames(self_p,
+                                            u8_p,
+                                            offset,
+                                            message_size));
+
+        default:
+            /* Unexpected frames are ignored while idle. */
+            break;
+        }
+    }
+}
+
+ssize_t isotp_channel_write(struct isotp_channel_t *self_p,
+                            const void *buf_p,
+                            size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size > 0, EINVAL);
+
+    int res;
+    int i;
+    int index;
+    int block_size;
+    int block_left;
+    long st_min_us;
+    size_t offset;
+    size_t chunk_size;
+    const uint8_t *u8_p;
+    struct can_frame_t frames[TX_FRAMES_MAX];
+
+    u8_p = buf_p;
+
+    if (size < 8) {
+        frame_init(self_p, &frames[0], size + 1);
+        frames[0].data.u8[0] = ((TYPE_SINGLE_FRAME << 4) | size);
+        memcpy(&frames[0].data.u8[1], u8_p, size);
+        res = write_frames(self_p, &frames[0], 1);
+
+        return (res == 0 ? (ssize_t)size : res);
+    }
+
+    frame_init(self_p, &frames[0], 8);
+
+    if (size <= 4095) {
+        frames[0].data.u8[0] = ((TYPE_FIRST_FRAME << 4) | (size >> 8));
+        frames[0].data.u8[1] = size;
+        offset = 6;
+    } else {
+        frames[0].data.u8[0] = (TYPE_FIRST_FRAME << 4);
+        frames[0].data.u8[1] = 0;
+        frames[0].data.u8[2] = (size >> 24);
+        frames[0].data.u8[3] = (size >> 16);
+        frames[0].data.u8[4] = (size >> 8);
+        frames[0].data.u8[5] = size;
+        offset = 2;
+    }
+
+    memcpy(&frames[0].data.u8[8 - offset], u8_p, offset);
+    res = write_frames(self_p, &frames[0], 1);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    index = 1;
+    block_left = 0;
+    st_min_us = 0;
+
+    while (offset < size) {
+        if (block_left == 0) {
+            res = wait_for_flow_control(self_p, &block_size, &st_min_us);
+
+            if (res != 0) {
+                return (res);
+            }
+
+            /* A block size of zero(0) means no more flow control
+               frames. */
+            block_left = (block_size == 0 ? -1 : block_size);
+        }
+
+        /* Write as many consecutive frames as possible at once
+           unless a separation time is required. */
+        i = 0;
+
+        do {
+            chunk_size = MIN(size - offset, 7);
+            frame_init(self_p, &frames[i], chunk_size + 1);
+            frames[i].data.u8[0] = ((TYPE_CONSECUTIVE_FRAME << 4) | index);
+            memcpy(&frames[i].data.u8[1], &u8_p[offset], chunk_size);
+            offset += chunk_size;
+            index = ((index + 1) % 16);
+            i++;
+
+            if (block_left > 0) {
+                block_left--;
+            }
+        } while ((st_min_us == 0)
+                 && (i < TX_FRAMES_MAX)
+                 && (offset < size)
+                 && (block_left != 0));
+
+        res = write_frames(self_p, &frames[0], i);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        if ((st_min_us > 0) && (offset < size) && (block_left != 0)) {
+            thrd_sleep_us(st_min_us);
+        }
+    }
+
+    return (size);
+}
+
+#endif
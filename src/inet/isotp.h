@@ -45,6 +45,26 @@ struct isotp_t {
     } message;
 };
 
+#if CONFIG_ISOTP_CHANNEL == 1
+
+/**
+ * An ISO-TP channel transmits and receives segmented messages on a
+ * CAN bus. Frames with the reception id are written to the channel's
+ * own subscriber queue, so any number of channels can share a CAN
+ * driver. A channel is half-duplex, that is, only one message is
+ * read or written at a time.
+ */
+struct isotp_channel_t {
+    struct can_driver_t *can_p;
+    uint32_t tx_id;
+    int block_size;
+    uint8_t st_min;
+    struct can_subscriber_t subscriber;
+    struct can_filter_t filter;
+};
+
+#endif
+
 /**
  * Initialize given ISO-TP object. An object can _either_ be used to
  * transmit or receive an ISO-TP message. Once `isotp_input()` or
@@ -108,4 +128,108 @@ ssize_t isotp_output(struct isotp_t *self_p,
                      uint8_t *buf_p,
                      size_t *size_p);
 
+#if CONFIG_ISOTP_CHANNEL == 1
+
+/**
+ * Initialize given ISO-TP channel. Frames are transmitted with given
+ * transmission id, and frames with given reception id are received.
+ * Ids of extended (29 bits) frames are or:ed with
+ * ``CAN_ID_EXTENDED``.
+ *
+ * @param[in] self_p Channel to initialize.
+ * @param[in] can_p Initialized CAN driver.
+ * @param[in] rx_id Reception frame id.
+ * @param[in] tx_id Transmission frame id.
+ * @param[in] rxbuf_p Frame reception buffer. The flow control block
+ *                    size advertised to the peer is limited to the
+ *                    number of frames that fits in this buffer.
+ * @param[in] size Size of the reception buffer in bytes. Must be a
+ *                 multiple of ``sizeof(struct can_frame_t)``.
+ * @param[in] dropped_path_p File system path of the counter of
+ *                           received frames dropped since the
+ *                           reception buffer was full.
+ *
+ * @return zero(0) or negative error code.
+ */
+int isotp_channel_init(struct isotp_channel_t *self_p,
+                       struct can_driver_t *can_p,
+                       uint32_t rx_id,
+                       uint32_t tx_id,
+                       struct can_frame_t *rxbuf_p,
+                       size_t size,
+                       far_string_t dropped_path_p);
+
+/**
+ * Start receiving frames on given channel.
+ *
+ * @param[in] self_p Initialized channel.
+ *
+ * @return zero(0) or negative error code.
+ */
+int isotp_channel_start(struct isotp_channel_t *self_p);
+
+/**
+ * Stop receiving frames on given channel.
+ *
+ * @param[in] self_p Started channel.
+ *
+ * @return zero(0) or negative error code.
+ */
+int isotp_channel_stop(struct isotp_channel_t *self_p);
+
+/**
+ * Set the block size and separation time (STmin) the peer is asked
+ * to use when transmitting messages to given channel.
+ *
+ * @param[in] self_p Initialized channel.
+ * @param[in] block_size Maximum number of consecutive frames to
+ *                       receive between flow control frames. Zero(0)
+ *                       for as many as fits in the reception buffer,
+ *                       which is the default.
+ * @param[in] st_min_us Minimum time between consecutive frames in
+ *                      microseconds, rounded up to the resolution of
+ *                      the protocol. Zero(0) by default.
+ *
+ * @return zero(0) or negative error code.
+ */
+int isotp_channel_set_flow_control(struct isotp_channel_t *self_p,
+                                   int block_size,
+                                   long st_min_us);
+
+/**
+ * Read one message from given channel. Blocks until the first frame
+ * of a message is received. Consecutive frames are copied directly
+ * into given buffer.
+ *
+ * A message that does not fit in given buffer is rejected by sending
+ * an overflow flow control frame to the peer.
+ *
+ * @param[in] self_p Started channel.
+ * @param[out] buf_p Message buffer.
+ * @param[in] size Size of the message buffer in bytes.
+ *
+ * @return Size of the received message, or negative error code.
+ */
+ssize_t isotp_channel_read(struct isotp_channel_t *self_p,
+                           void *buf_p,
+                           size_t size);
+
+/**
+ * Write given message to given channel. Blocks until the whole
+ * message has been transmitted, honouring the block size and
+ * separation time requested by the peer. Messages longer than 4095
+ * bytes are transmitted with a 32 bits first frame length.
+ *
+ * @param[in] self_p Started channel.
+ * @param[in] buf_p Message to write.
+ * @param[in] size Size of the message in bytes.
+ *
+ * @return Size of the message, or negative error code.
+ */
+ssize_t isotp_channel_write(struct isotp_channel_t *self_p,
+                            const void *buf_p,
+                            size_t size);
+
+#endif
+
 #endif
@@ -39,71 +39,282 @@
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/timing.h"
+#include "mbedtls/ssl_ticket.h"
+
+#if (CONFIG_SSL_SESSION_CACHE_SIZE > 0) && defined(MBEDTLS_SSL_CLI_C)
+#    define SESSION_CACHE                                   1
+#else
+#    define SESSION_CACHE                                   0
+#endif
+
+#if (CONFIG_SSL_SESSION_TICKETS == 1)           \
+    && defined(MBEDTLS_SSL_TICKET_C)            \
+    && defined(MBEDTLS_SSL_SESSION_TICKETS)     \
+    && defined(MBEDTLS_SSL_SRV_C)
+#    define SESSION_TICKETS                                 1
+#else
+#    define SESSION_TICKETS                                 0
+#endif
+
+#define SESSION_CACHE_HOSTNAME_MAX                         64
+
+struct socket_entry_t {
+    mbedtls_ssl_context ssl;
+    int allocated;
+#if CONFIG_SSL_INPUT_BUFFER_SIZE > 0
+    uint8_t input_buf[CONFIG_SSL_INPUT_BUFFER_SIZE];
+#endif
+};
+
+struct context_entry_t {
+    mbedtls_ssl_config conf;
+    int allocated;
+};
+
+#if SESSION_CACHE == 1
+
+struct session_cache_entry_t {
+    char hostname[SESSION_CACHE_HOSTNAME_MAX];
+    int port;
+    mbedtls_ssl_session session;
+    uint32_t timestamp;
+};
+
+#endif
 
 struct module_t {
     int8_t initialized;
     mbedtls_entropy_context entropy;
     mbedtls_ctr_drbg_context ctr_drbg;
-    mbedtls_ssl_context ssl;
-    int ssl_allocated;
-    mbedtls_ssl_config conf;
-    int conf_allocated;
+    struct socket_entry_t sockets[CONFIG_SSL_SOCKETS_MAX];
+    struct context_entry_t contexts[CONFIG_SSL_CONTEXTS_MAX];
     mbedtls_x509_crt cert;
     mbedtls_pk_context key;
     mbedtls_x509_crt ca_certs;
     mbedtls_timing_delay_context timer;
+#if SESSION_TICKETS == 1
+    mbedtls_ssl_ticket_context ticket;
+    int ticket_initialized;
+#endif
+#if SESSION_CACHE == 1
+    struct {
+        struct session_cache_entry_t entries[CONFIG_SSL_SESSION_CACHE_SIZE];
+        uint32_t timestamp;
+    } session_cache;
+#endif
 };
 
 static struct module_t module;
 
-static void *alloc_ssl(void)
+static struct socket_entry_t *alloc_socket_entry(void)
 {
-    if (module.ssl_allocated == 1) {
-        return (NULL);
-    }
+    int i;
+
+    for (i = 0; i < membersof(module.sockets); i++) {
+        if (module.sockets[i].allocated == 0) {
+            module.sockets[i].allocated = 1;
 
-    module.ssl_allocated = 1;
+            return (&module.sockets[i]);
+        }
+    }
 
-    return (&module.ssl);
+    return (NULL);
 }
 
 static void free_ssl(void *ssl_p)
 {
-    module.ssl_allocated = 0;
+    int i;
+
+    for (i = 0; i < membersof(module.sockets); i++) {
+        if (&module.sockets[i].ssl == ssl_p) {
+            module.sockets[i].allocated = 0;
+        }
+    }
 }
 
 static void *alloc_conf(void)
 {
-    if (module.conf_allocated == 1) {
-        return (NULL);
-    }
+    int i;
 
-    module.conf_allocated = 1;
+    for (i = 0; i < membersof(module.contexts); i++) {
+        if (module.contexts[i].allocated == 0) {
+            module.contexts[i].allocated = 1;
+
+            return (&module.contexts[i].conf);
+        }
+    }
 
-    return (&module.conf);
+    return (NULL);
 }
 
 static void free_conf(void *conf_p)
 {
-    module.conf_allocated = 0;
+    int i;
+
+    for (i = 0; i < membersof(module.contexts); i++) {
+        if (&module.contexts[i].conf == conf_p) {
+            module.contexts[i].allocated = 0;
+        }
+    }
 }
 
+#if SESSION_CACHE == 1
+
+/**
+ * Find the cached session of given server, or NULL if missing.
+ */
+static struct session_cache_entry_t *session_cache_find(const char *hostname_p,
+                                                        int port)
+{
+    struct session_cache_entry_t *entry_p;
+    int i;
+
+    for (i = 0; i < membersof(module.session_cache.entries); i++) {
+        entry_p = &module.session_cache.entries[i];
+
+        if ((entry_p->hostname[0] != '\0')
+            && (entry_p->port == port)
+            && (strcmp(entry_p->hostname, hostname_p) == 0)) {
+            return (entry_p);
+        }
+    }
+
+    return (NULL);
+}
+
+/**
+ * Resume the cached session of given server, if any.
+ */
+static void session_cache_load(mbedtls_ssl_context *ssl_p,
+                               const char *hostname_p,
+                               int port)
+{
+    struct session_cache_entry_t *entry_p;
+
+    entry_p = session_cache_find(hostname_p, port);
+
+    if (entry_p == NULL) {
+        return;
+    }
+
+    entry_p->timestamp = ++module.session_cache.timestamp;
+
+    /* A failure only means a full handshake. */
+    (void)mbedtls_ssl_set_session(ssl_p, &entry_p->session);
+}
+
+/**
+ * Store the session of given connected client socket, replacing the
+ * least recently used entry if the server is not already in the
+ * cache.
+ */
+static void session_cache_store(mbedtls_ssl_context *ssl_p,
+                                const char *hostname_p,
+                                int port)
+{
+    struct session_cache_entry_t *entry_p;
+    int i;
+
+    if (strlen(hostname_p) >= SESSION_CACHE_HOSTNAME_MAX) {
+        return;
+    }
+
+    entry_p = session_cache_find(hostname_p, port);
+
+    if (entry_p == NULL) {
+        entry_p = &module.session_cache.entries[0];
+
+        for (i = 1; i < membersof(module.session_cache.entries); i++) {
+            if (module.session_cache.entries[i].timestamp
+                < entry_p->timestamp) {
+                entry_p = &module.session_cache.entries[i];
+            }
+        }
+    }
+
+    mbedtls_ssl_session_free(&entry_p->session);
+    mbedtls_ssl_session_init(&entry_p->session);
+
+    if (mbedtls_ssl_get_session(ssl_p, &entry_p->session) != 0) {
+        entry_p->hostname[0] = '\0';
+        entry_p->timestamp = 0;
+
+        return;
+    }
+
+    strcpy(&entry_p->hostname[0], hostname_p);
+    entry_p->port = port;
+    entry_p->timestamp = ++module.session_cache.timestamp;
+}
+
+#endif
+
 static int ssl_send(void *ctx_p,
                     const unsigned char *buf_p,
                     size_t len)
 {
-    return (socket_write(ctx_p, buf_p, len));
+    struct ssl_socket_t *self_p;
+
+    self_p = ctx_p;
+
+    return (chan_write(self_p->socket_p, buf_p, len));
 }
 
 static int ssl_recv(void *ctx_p,
                     unsigned char *buf_p,
-                    size_t len )
+                    size_t len)
 {
-    return (socket_read(ctx_p, buf_p, len));
+    struct ssl_socket_t *self_p;
+#if CONFIG_SSL_INPUT_BUFFER_SIZE > 0
+    ssize_t size;
+#endif
+
+    self_p = ctx_p;
+
+#if CONFIG_SSL_INPUT_BUFFER_SIZE > 0
+    /* Refill the empty input buffer. All data already in the socket
+       is read with a single call, often a whole record, but never
+       less than requested as the read blocks until all requested
+       data is available. Large reads bypass the buffer. */
+    if (self_p->input.pos == self_p->input.size) {
+        if (len >= CONFIG_SSL_INPUT_BUFFER_SIZE) {
+            return (chan_read(self_p->socket_p, buf_p, len));
+        }
+
+        size = chan_size(self_p->socket_p);
+
+        if (size > CONFIG_SSL_INPUT_BUFFER_SIZE) {
+            size = CONFIG_SSL_INPUT_BUFFER_SIZE;
+        } else if (size < (ssize_t)len) {
+            size = len;
+        }
+
+        size = chan_read(self_p->socket_p, self_p->input.buf_p, size);
+
+        if (size <= 0) {
+            return (size);
+        }
+
+        self_p->input.pos = 0;
+        self_p->input.size = size;
+    }
+
+    size = MIN(len, self_p->input.size - self_p->input.pos);
+    memcpy(buf_p, &self_p->input.buf_p[self_p->input.pos], size);
+    self_p->input.pos += size;
+
+    return (size);
+#else
+    return (chan_read(self_p->socket_p, buf_p, len));
+#endif
 }
 
 int ssl_module_init()
 {
+#if SESSION_CACHE == 1
+    int i;
+#endif
+
     /* Return immediately if the module is already initialized. */
     if (module.initialized == 1) {
         return (0);
@@ -111,6 +322,12 @@ int ssl_module_init()
 
     module.initialized = 1;
 
+#if SESSION_CACHE == 1
+    for (i = 0; i < membersof(module.session_cache.entries); i++) {
+        mbedtls_ssl_session_init(&module.session_cache.entries[i].session);
+    }
+#endif
+
     mbedtls_entropy_init(&module.entropy);
     mbedtls_ctr_drbg_init(&module.ctr_drbg);
 
@@ -148,6 +365,7 @@ int ssl_context_init(struct ssl_context_t *self_p,
 
     self_p->server_side = -1;
     self_p->verify_mode = -1;
+    self_p->session_resumption = 1;
 
     return (0);
 }
@@ -229,21 +447,31 @@ int ssl_context_set_verify_mode(struct ssl_context_t *self_p,
     return (0);
 }
 
-int ssl_socket_open(struct ssl_socket_t *self_p,
-                    struct ssl_context_t *context_p,
-                    void *socket_p,
-                    int flags,
-                    const char *server_hostname_p)
+int ssl_context_set_session_resumption(struct ssl_context_t *self_p,
+                                       int enabled)
 {
-    ASSERTN(module.initialized == 1, EINVAL);
     ASSERTN(self_p != NULL, EINVAL);
-    ASSERTN(context_p != NULL, EINVAL);
-    ASSERTN(context_p->conf_p != NULL, EINVAL);
-    ASSERTN(socket_p != NULL, EINVAL);
 
+    self_p->session_resumption = enabled;
+
+    return (0);
+}
+
+/**
+ * Open given SSL socket. Client side sessions are cached per server
+ * hostname and port, and only if the port is known (not -1).
+ */
+static int open_socket(struct ssl_socket_t *self_p,
+                       struct ssl_context_t *context_p,
+                       void *socket_p,
+                       int flags,
+                       const char *server_hostname_p,
+                       int server_port)
+{
     int res;
     int authmode;
     int server_side;
+    struct socket_entry_t *entry_p;
 
     server_side = (flags & SSL_SOCKET_SERVER_SIDE);
     
@@ -265,6 +493,44 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
             mbedtls_ssl_conf_authmode(context_p->conf_p, context_p->verify_mode);
         }
 
+#if SESSION_TICKETS == 1
+        /* Stateless session resumption for clients supporting
+           tickets. The ticket key is shared by all server side
+           contexts. */
+        if ((server_side == 1) && (context_p->session_resumption == 1)) {
+            if (module.ticket_initialized == 0) {
+                mbedtls_ssl_ticket_init(&module.ticket);
+
+                if (mbedtls_ssl_ticket_setup(&module.ticket,
+                                             mbedtls_ctr_drbg_random,
+                                             &module.ctr_drbg,
+                                             MBEDTLS_CIPHER_AES_256_GCM,
+                                             CONFIG_SSL_SESSION_TICKET_LIFETIME) != 0) {
+                    mbedtls_ssl_ticket_free(&module.ticket);
+
+                    return (-1);
+                }
+
+                module.ticket_initialized = 1;
+            }
+
+            mbedtls_ssl_conf_session_tickets_cb(context_p->conf_p,
+                                                mbedtls_ssl_ticket_write,
+                                                mbedtls_ssl_ticket_parse,
+                                                &module.ticket);
+        }
+#endif
+
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_CLI_C)
+        if (server_side == 0) {
+            mbedtls_ssl_conf_session_tickets(
+                context_p->conf_p,
+                (context_p->session_resumption == 1
+                 ? MBEDTLS_SSL_SESSION_TICKETS_ENABLED
+                 : MBEDTLS_SSL_SESSION_TICKETS_DISABLED));
+        }
+#endif
+
         context_p->server_side = server_side;
     } else if (context_p->server_side != server_side) {
         return (-1);
@@ -273,12 +539,21 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
     self_p->socket_p = socket_p;
 
     /* Allocate the mbedTLS datastructures. */
-    self_p->ssl_p = alloc_ssl();
+    entry_p = alloc_socket_entry();
 
-    if (self_p->ssl_p == NULL) {
+    if (entry_p == NULL) {
         return (-1);
     }
 
+    self_p->ssl_p = &entry_p->ssl;
+#if CONFIG_SSL_INPUT_BUFFER_SIZE > 0
+    self_p->input.buf_p = &entry_p->input_buf[0];
+#else
+    self_p->input.buf_p = NULL;
+#endif
+    self_p->input.pos = 0;
+    self_p->input.size = 0;
+
     chan_init(&self_p->base,
               (chan_read_fn_t)ssl_socket_read,
               (chan_write_fn_t)ssl_socket_write,
@@ -287,14 +562,14 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
     /* Inilialize the SSL session. */
     mbedtls_ssl_init(self_p->ssl_p);
 
-    res = mbedtls_ssl_setup(self_p->ssl_p, &module.conf);
+    res = mbedtls_ssl_setup(self_p->ssl_p, context_p->conf_p);
 
     if (res != 0) {
         goto err1;
     }
 
     mbedtls_ssl_set_bio(self_p->ssl_p,
-                        socket_p,
+                        self_p,
                         ssl_send,
                         ssl_recv,
                         NULL);
@@ -306,10 +581,21 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
                                          server_hostname_p) != 0) {
                 goto err2;
             }
+
+#if SESSION_CACHE == 1
+            if ((context_p->session_resumption == 1)
+                && (server_port != -1)) {
+                session_cache_load(self_p->ssl_p,
+                                   server_hostname_p,
+                                   server_port);
+            }
+#endif
         }
     }
     
-    /* Perform the handshake with the remote peer. */
+    /* Perform the handshake with the remote peer. A full handshake
+       unless a cached session or ticket was accepted by the
+       server. */
     res = mbedtls_ssl_handshake(self_p->ssl_p);
 
     if (res != 0) {
@@ -327,6 +613,17 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
         }
     }
 
+#if SESSION_CACHE == 1
+    /* Save the (possibly new) session for the next connection to
+       this server. */
+    if ((server_side == 0)
+        && (server_hostname_p != NULL)
+        && (server_port != -1)
+        && (context_p->session_resumption == 1)) {
+        session_cache_store(self_p->ssl_p, server_hostname_p, server_port);
+    }
+#endif
+
     return (0);
 
  err2:
@@ -337,6 +634,48 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
     return (res);
 }
 
+int ssl_socket_open(struct ssl_socket_t *self_p,
+                    struct ssl_context_t *context_p,
+                    void *socket_p,
+                    int flags,
+                    const char *server_hostname_p)
+{
+    ASSERTN(module.initialized == 1, EINVAL);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(context_p != NULL, EINVAL);
+    ASSERTN(context_p->conf_p != NULL, EINVAL);
+    ASSERTN(socket_p != NULL, EINVAL);
+
+    return (open_socket(self_p,
+                        context_p,
+                        socket_p,
+                        flags,
+                        server_hostname_p,
+                        -1));
+}
+
+int ssl_socket_open_client(struct ssl_socket_t *self_p,
+                           struct ssl_context_t *context_p,
+                           void *socket_p,
+                           const char *server_hostname_p,
+                           int server_port)
+{
+    ASSERTN(module.initialized == 1, EINVAL);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(context_p != NULL, EINVAL);
+    ASSERTN(context_p->conf_p != NULL, EINVAL);
+    ASSERTN(socket_p != NULL, EINVAL);
+    ASSERTN(server_hostname_p != NULL, EINVAL);
+    ASSERTN((server_port >= 0) && (server_port <= 65535), EINVAL);
+
+    return (open_socket(self_p,
+                        context_p,
+                        socket_p,
+                        0,
+                        server_hostname_p,
+                        server_port));
+}
+
 int ssl_socket_close(struct ssl_socket_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
@@ -377,6 +716,7 @@ ssize_t ssl_socket_size(struct ssl_socket_t *self_p)
     ASSERTN(self_p->ssl_p != NULL, EINVAL);
 
     return (mbedtls_ssl_get_bytes_avail(self_p->ssl_p)
+            + (self_p->input.size - self_p->input.pos)
             + chan_size(self_p->socket_p));
 }
 
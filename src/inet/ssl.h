@@ -50,12 +50,18 @@ struct ssl_context_t {
     void *conf_p;
     int server_side;
     int verify_mode;
+    int session_resumption;
 };
 
 struct ssl_socket_t {
     struct chan_t base;
     void *ssl_p;
     void *socket_p; /* Often a TCP socket. */
+    struct {
+        uint8_t *buf_p;
+        size_t pos;
+        size_t size;
+    } input;
 };
 
 /**
@@ -130,6 +136,27 @@ int ssl_context_load_verify_location(struct ssl_context_t *self_p,
 int ssl_context_set_verify_mode(struct ssl_context_t *self_p,
                                 enum ssl_verify_mode_t mode);
 
+/**
+ * Enable or disable session resumption in given context. Enabled by
+ * default.
+ *
+ * Client side sockets opened with `ssl_socket_open_client()` resume
+ * the cached session of the server, given by its hostname and port,
+ * using a session ticket or a session id. Server side sockets issue session tickets to
+ * clients. A resumed session skips the expensive public key
+ * operations of a full handshake.
+ *
+ * Must be called before the first socket is opened in the context.
+ *
+ * @param[in] self_p SSL context.
+ * @param[in] enabled True(1) to enable session resumption, false(0)
+ *                    to always perform a full handshake.
+ *
+ * @return zero(0) or negative error code.
+ */
+int ssl_context_set_session_resumption(struct ssl_context_t *self_p,
+                                       int enabled);
+
 /**
  * Initialize given SSL socket with given socket and SSL
  * context. Performs the SSL handshake.
@@ -140,8 +167,8 @@ int ssl_context_set_verify_mode(struct ssl_context_t *self_p,
  * @param[in] flags Give as ``SSL_SOCKET_SERVER_SIDE`` for server side
  *                  sockets. Otherwise 0.
  * @param[in] server_hostname_p The server hostname used by client
- *                              side sockets to verify the
- *                              server. Give as NULL to skip the
+ *                              side sockets to verify the server.
+ *                              Give as NULL to skip the
  *                              verification. Must be NULL for server
  *                              side sockets.
  *
@@ -153,6 +180,27 @@ int ssl_socket_open(struct ssl_socket_t *self_p,
                     int flags,
                     const char *server_hostname_p);
 
+/**
+ * Initialize given client side SSL socket with given socket and SSL
+ * context, and perform the SSL handshake. Unlike `ssl_socket_open()`
+ * the session is cached, and resumed by the next client side socket
+ * opened to the same server hostname and port.
+ *
+ * @param[out] self_p SSL socket to initialize.
+ * @param[in] context_p SSL context to execute in.
+ * @param[in] socket_p Socket to wrap in the SSL socket.
+ * @param[in] server_hostname_p The server hostname used to verify the
+ *                              server.
+ * @param[in] server_port The server port.
+ *
+ * @return zero(0) or negative error code.
+ */
+int ssl_socket_open_client(struct ssl_socket_t *self_p,
+                           struct ssl_context_t *context_p,
+                           void *socket_p,
+                           const char *server_hostname_p,
+                           int server_port);
+
 /**
  * Close given SSL socket.
  *
@@ -133,7 +133,8 @@
  *    "Extension data".
  */
 
-#define INET_HTTP_WEBSOCKET_FIN  0x80
-#define INET_HTTP_WEBSOCKET_MASK 0x80
+#define INET_HTTP_WEBSOCKET_FIN    0x80
+#define INET_HTTP_WEBSOCKET_MASK   0x80
+#define INET_HTTP_WEBSOCKET_OPCODE 0x0f
 
 #endif
@@ -0,0 +1,83 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#if !defined(FAMILY_SAMD)
+
+/* Data watchpoint and trace unit of the Cortex-M3 and Cortex-M4. */
+#define DEMCR                 (*(volatile uint32_t *)0xe000edfc)
+#define DEMCR_TRCENA                                      BIT(24)
+#define DWT_CTRL              (*(volatile uint32_t *)0xe0001000)
+#define DWT_CTRL_CYCCNTENA                                 BIT(0)
+#define DWT_CYCCNT            (*(volatile uint32_t *)0xe0001004)
+
+#define BENCH_PORT_HAS_TIME
+
+static void bench_port_init(void)
+{
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+static uint32_t bench_port_time(void)
+{
+    return (DWT_CYCCNT);
+}
+
+static uint32_t bench_port_time_frequency(void)
+{
+    return (F_CPU);
+}
+
+static uint32_t bench_port_time_resolution(void)
+{
+    return (1);
+}
+
+static int bench_port_cycles(uint32_t *cycles_p)
+{
+    *cycles_p = DWT_CYCCNT;
+
+    return (0);
+}
+
+#else
+
+/* The Cortex-M0+ has no cycle counter. The kernel timestamp is used
+   as timer. */
+
+static void bench_port_init(void)
+{
+}
+
+static int bench_port_cycles(uint32_t *cycles_p)
+{
+    return (-ENOSYS);
+}
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#define BENCH_PORT_HAS_TIME
+
+/* The generic timer virtual count. It does not count CPU cycles. */
+
+static void bench_port_init(void)
+{
+}
+
+static uint32_t bench_port_time(void)
+{
+    uint64_t count;
+
+    asm volatile("isb\n\t"
+                 "mrs %0, cntvct_el0" : "=r" (count));
+
+    return ((uint32_t)count);
+}
+
+static uint32_t bench_port_time_frequency(void)
+{
+    uint64_t frequency;
+
+    asm volatile("mrs %0, cntfrq_el0" : "=r" (frequency));
+
+    return ((uint32_t)frequency);
+}
+
+static uint32_t bench_port_time_resolution(void)
+{
+    return (1);
+}
+
+static int bench_port_cycles(uint32_t *cycles_p)
+{
+    return (-ENOSYS);
+}
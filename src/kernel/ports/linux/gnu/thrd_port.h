@@ -30,6 +30,7 @@
 #define __KERNEL_THRD_PORT_H__
 
 #include <pthread.h>
+#include <time.h>
 
 #if CONFIG_PREEMPTIVE_SCHEDULER == 1
 #    error "This port does not support a preemptive scheduler."
@@ -44,6 +45,21 @@ struct thrd_port_t {
     pthread_cond_t cond;
     void *(*main)(void *arg);
     void *arg;
+    struct {
+        /** CPU time clock of the pthread. */
+        clockid_t clock;
+        /** Thread CPU time in nanoseconds when last swapped in. */
+        uint64_t start;
+        struct {
+            /** Monotonic time in nanoseconds when the period started. */
+            uint64_t start;
+            /** Thread CPU time in nanoseconds consumed in the period. */
+            uint64_t time;
+        } period;
+    } cpu;
+    /** Monotonic time in nanoseconds when the thread was woken, or
+        zero if it was not. */
+    uint64_t woken;
 };
 
 #endif
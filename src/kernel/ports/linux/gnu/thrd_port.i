@@ -44,6 +44,35 @@ static char *thrd_port_get_main_thrd_stack_top(void)
     return (NULL);
 }
 
+/**
+ * Returns the current time of given clock in nanoseconds.
+ */
+static uint64_t clock_get_ns(clockid_t clock)
+{
+    struct timespec now;
+
+    clock_gettime(clock, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+/**
+ * Initialize the CPU usage accounting of given thread. The CPU time
+ * clock of the pthread is used so that only time actually spent
+ * executing is accounted, and not time blocked in the swap.
+ */
+static void thrd_port_cpu_init(struct thrd_port_t *port_p)
+{
+    if (pthread_getcpuclockid(port_p->thrd, &port_p->cpu.clock) != 0) {
+        port_p->cpu.clock = CLOCK_MONOTONIC;
+    }
+
+    port_p->cpu.start = clock_get_ns(port_p->cpu.clock);
+    port_p->cpu.period.start = clock_get_ns(CLOCK_MONOTONIC);
+    port_p->cpu.period.time = 0;
+    port_p->woken = 0;
+}
+
 static struct thrd_port_idle_t idle = {
     .mutex = PTHREAD_MUTEX_INITIALIZER,
     .cond = PTHREAD_COND_INITIALIZER
@@ -81,8 +110,10 @@ static void thrd_port_init_main(struct thrd_port_t *port_p)
 {
     port_p->main = NULL;
     port_p->arg = NULL;
+    port_p->thrd = pthread_self();
     pthread_mutex_init(&port_p->mutex, NULL);
     pthread_cond_init (&port_p->cond, NULL);
+    thrd_port_cpu_init(port_p);
 }
 
 static int thrd_port_spawn(struct thrd_t *thrd_p,
@@ -106,6 +137,8 @@ static int thrd_port_spawn(struct thrd_t *thrd_p,
         return (1);
     }
 
+    thrd_port_cpu_init(port_p);
+
     return (0);
 }
 
@@ -141,21 +174,78 @@ static void thrd_port_tick(void)
 
 static void thrd_port_cpu_usage_start(struct thrd_t *thrd_p)
 {
+#if CONFIG_THRD_CPU_USAGE == 1
+    thrd_p->port.cpu.start = clock_get_ns(thrd_p->port.cpu.clock);
+#endif
 }
 
 static void thrd_port_cpu_usage_stop(struct thrd_t *thrd_p)
 {
+#if CONFIG_THRD_CPU_USAGE == 1
+    thrd_p->port.cpu.period.time += (clock_get_ns(thrd_p->port.cpu.clock)
+                                     - thrd_p->port.cpu.start);
+#endif
 }
 
 #if CONFIG_MONITOR_THREAD == 1
 
 static cpu_usage_t thrd_port_cpu_usage_get(struct thrd_t *thrd_p)
 {
-    return (0);
+    uint64_t time;
+    uint64_t elapsed;
+
+    time = thrd_p->port.cpu.period.time;
+
+    /* Include the ongoing time slice of the calling thread. */
+    if (thrd_p == thrd_self()) {
+        time += (clock_get_ns(thrd_p->port.cpu.clock) - thrd_p->port.cpu.start);
+    }
+
+    elapsed = (clock_get_ns(CLOCK_MONOTONIC) - thrd_p->port.cpu.period.start);
+
+    if (elapsed == 0) {
+        return (0);
+    }
+
+    return (((cpu_usage_t)100 * time) / elapsed);
 }
 
 static void thrd_port_cpu_usage_reset(struct thrd_t *thrd_p)
 {
+    thrd_p->port.cpu.period.start = clock_get_ns(CLOCK_MONOTONIC);
+    thrd_p->port.cpu.period.time = 0;
+
+    if (thrd_p == thrd_self()) {
+        thrd_p->port.cpu.start = clock_get_ns(thrd_p->port.cpu.clock);
+    }
+}
+
+#endif
+
+#if CONFIG_THRD_WAKE_LATENCY == 1
+
+static void thrd_port_wake_latency_start(struct thrd_t *thrd_p)
+{
+    thrd_p->port.woken = clock_get_ns(CLOCK_MONOTONIC);
+}
+
+/**
+ * Returns the time in microseconds since given thread was woken, or
+ * -1 if it was not woken.
+ */
+static long thrd_port_wake_latency_stop(struct thrd_t *thrd_p)
+{
+    uint64_t woken;
+
+    woken = thrd_p->port.woken;
+
+    if (woken == 0) {
+        return (-1);
+    }
+
+    thrd_p->port.woken = 0;
+
+    return ((clock_get_ns(CLOCK_MONOTONIC) - woken) / 1000);
 }
 
 #endif
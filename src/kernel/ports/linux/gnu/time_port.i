@@ -50,3 +50,21 @@ static int time_port_micros_resolution(void)
 {
     return (1);
 }
+
+/* The system tick has too low resolution for timestamps, so the
+   monotonic clock is used instead. */
+#define TIME_PORT_HAS_TIMESTAMP
+
+static uint32_t time_port_timestamp_isr(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint32_t)(now.tv_sec * 1000000ull + now.tv_nsec / 1000));
+}
+
+static int time_port_timestamp_resolution(void)
+{
+    return (1);
+}
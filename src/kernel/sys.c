@@ -202,6 +202,7 @@ static void init_drivers(void)
 #endif
 
 #if CONFIG_MODULE_INIT_MCP2515 == 1
+    mcp2515_module_init();
 #endif
 
 #if CONFIG_MODULE_INIT_NRF24L01 == 1
@@ -512,6 +513,12 @@ int sys_start(void)
 #if CONFIG_MODULE_INIT_LOG == 1
     log_module_init();
 #endif
+#if CONFIG_MODULE_INIT_TRACE == 1
+    trace_module_init();
+#endif
+#if CONFIG_MODULE_INIT_CONTENTION == 1
+    contention_module_init();
+#endif
 #if CONFIG_MODULE_INIT_CHAN == 1
     chan_module_init();
 #endif
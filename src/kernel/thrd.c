@@ -28,6 +28,10 @@
 
 #include "simba.h"
 
+#if CONFIG_THRD_WAKE_LATENCY == 1 && !defined(ARCH_LINUX)
+#    error "Thread wake latency is only supported on Linux."
+#endif
+
 /* Thread states. */
 enum thrd_state_t {
     THRD_STATE_CURRENT = 0,
@@ -58,6 +62,10 @@ struct module_t {
 #if CONFIG_THRD_FS_COMMANDS == 1
     struct fs_command_t cmd_list;
     struct fs_command_t cmd_set_log_mask;
+#    if CONFIG_THRD_WAKE_LATENCY == 1
+    struct fs_command_t cmd_wake_latency_print;
+    struct fs_command_t cmd_wake_latency_reset;
+#    endif
 #endif
 #if CONFIG_MONITOR_THREAD == 1
     struct fs_command_t cmd_monitor_set_period_ms;
@@ -170,6 +178,20 @@ void terminate(void)
     sys_stop(1);
 }
 
+/**
+ * Initialize the mutex bookkeeping of given thread.
+ */
+static void thrd_mutex_init(struct thrd_t *thrd_p)
+{
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1 || CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+    thrd_p->mutex.waiting_for_p = NULL;
+#endif
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+    thrd_p->mutex.prio = thrd_p->prio;
+    thrd_p->mutex.owned_p = NULL;
+#endif
+}
+
 /**
  * Timer callback for threads suspended with a timeout.
  */
@@ -187,9 +209,60 @@ static void on_suspend_timer_expired(void *arg_p)
     thrd_p->state = THRD_STATE_READY;
     scheduler_ready_push(thrd_p);
 
+#if CONFIG_THRD_WAKE_LATENCY == 1
+    thrd_port_wake_latency_start(thrd_p);
+#endif
+
     thrd_port_on_suspend_timer_expired(thrd_p);
 }
 
+#if CONFIG_THRD_WAKE_LATENCY == 1
+
+/**
+ * Clear the wake latency histogram of given thread.
+ */
+static void wake_latency_reset(struct thrd_t *thrd_p)
+{
+    memset(&thrd_p->statistics.wake_latency,
+           0,
+           sizeof(thrd_p->statistics.wake_latency));
+}
+
+/**
+ * Add the wake latency of given thread, which is about to run, to
+ * its histogram. Nothing is added if the thread was not woken.
+ */
+static void wake_latency_update(struct thrd_t *thrd_p)
+{
+    long latency;
+    int i;
+
+    latency = thrd_port_wake_latency_stop(thrd_p);
+
+    if (latency < 0) {
+        return;
+    }
+
+    /* The bucket index is the bit length of the latency. */
+    i = 0;
+
+    while ((latency >> i) != 0) {
+        i++;
+    }
+
+    if (i >= THRD_WAKE_LATENCY_HISTOGRAM_LENGTH) {
+        i = (THRD_WAKE_LATENCY_HISTOGRAM_LENGTH - 1);
+    }
+
+    thrd_p->statistics.wake_latency.histogram[i]++;
+
+    if (latency > thrd_p->statistics.wake_latency.max) {
+        thrd_p->statistics.wake_latency.max = latency;
+    }
+}
+
+#endif
+
 /**
  * Push a thread on the list of threads that are ready to be
  * scheduled.
@@ -233,7 +306,12 @@ static void thrd_reschedule(void)
     /* Swap threads. */
     in_p->state = THRD_STATE_CURRENT;
 
+#if CONFIG_THRD_WAKE_LATENCY == 1
+    wake_latency_update(in_p);
+#endif
+
     if (in_p != out_p) {
+        TRACE_ISR(TRACE_EVENT_THRD_SWITCH, 0, in_p);
         module.scheduler.current_p = in_p;
         thrd_port_cpu_usage_stop(out_p);
         thrd_port_cpu_usage_start(in_p);
@@ -381,6 +459,92 @@ static int cmd_set_log_mask_cb(int argc,
     return (0);
 }
 
+#    if CONFIG_THRD_WAKE_LATENCY == 1
+
+static int cmd_wake_latency_print_cb(int argc,
+                                     const char *argv[],
+                                     void *chout_p,
+                                     void *chin_p,
+                                     void *arg_p,
+                                     void *call_arg_p)
+{
+    struct thrd_t *thrd_p;
+    uint32_t wakeups;
+    uint32_t count;
+    int i;
+
+    std_fprintf(chout_p,
+                OSTR("                NAME     WAKEUPS      MAX-US\r\n"));
+
+    thrd_p = module.threads_p;
+
+    while (thrd_p != NULL) {
+        sys_lock();
+        wakeups = 0;
+
+        for (i = 0; i < THRD_WAKE_LATENCY_HISTOGRAM_LENGTH; i++) {
+            wakeups += thrd_p->statistics.wake_latency.histogram[i];
+        }
+
+        sys_unlock();
+
+        std_fprintf(chout_p,
+                    OSTR("%20s %11u %11u\r\n"),
+                    thrd_p->name_p,
+                    (unsigned int)wakeups,
+                    (unsigned int)thrd_p->statistics.wake_latency.max);
+
+        /* Non-empty buckets as [from, to) microseconds. */
+        for (i = 0; i < THRD_WAKE_LATENCY_HISTOGRAM_LENGTH; i++) {
+            count = thrd_p->statistics.wake_latency.histogram[i];
+
+            if (count == 0) {
+                continue;
+            }
+
+            if (i == THRD_WAKE_LATENCY_HISTOGRAM_LENGTH - 1) {
+                std_fprintf(chout_p,
+                            OSTR("                     >= %lu: %u\r\n"),
+                            1ul << (i - 1),
+                            (unsigned int)count);
+            } else {
+                std_fprintf(chout_p,
+                            OSTR("                     [%lu, %lu): %u\r\n"),
+                            (i == 0 ? 0ul : 1ul << (i - 1)),
+                            1ul << i,
+                            (unsigned int)count);
+            }
+        }
+
+        thrd_p = thrd_p->next_p;
+    }
+
+    return (0);
+}
+
+static int cmd_wake_latency_reset_cb(int argc,
+                                     const char *argv[],
+                                     void *chout_p,
+                                     void *chin_p,
+                                     void *arg_p,
+                                     void *call_arg_p)
+{
+    struct thrd_t *thrd_p;
+
+    thrd_p = module.threads_p;
+
+    while (thrd_p != NULL) {
+        sys_lock();
+        wake_latency_reset(thrd_p);
+        sys_unlock();
+        thrd_p = thrd_p->next_p;
+    }
+
+    return (0);
+}
+
+#    endif
+
 #endif
 
 static void *idle_thrd(void *arg_p)
@@ -440,6 +604,7 @@ int thrd_module_init(void)
     thrd_p->timer_p = NULL;
     thrd_p->name_p = "main";
     thrd_p->next_p = NULL;
+    thrd_mutex_init(thrd_p);
     thrd_p->stack_size = (thrd_port_get_main_thrd_stack_top() - (char *)(thrd_p + 1));
 
 #if CONFIG_THRD_TERMINATE == 1
@@ -454,6 +619,10 @@ int thrd_module_init(void)
     thrd_p->statistics.scheduled = 0;
 #endif
 
+#if CONFIG_THRD_WAKE_LATENCY == 1
+    wake_latency_reset(thrd_p);
+#endif
+
 #if CONFIG_THRD_ENV == 1
     thrd_p->env.variables_p = NULL;
     thrd_p->env.number_of_variables = 0;
@@ -495,6 +664,20 @@ int thrd_module_init(void)
                     NULL);
     fs_command_register(&module.cmd_set_log_mask);
 
+#    if CONFIG_THRD_WAKE_LATENCY == 1
+    fs_command_init(&module.cmd_wake_latency_print,
+                    CSTR("/kernel/thrd/wake_latency/print"),
+                    cmd_wake_latency_print_cb,
+                    NULL);
+    fs_command_register(&module.cmd_wake_latency_print);
+
+    fs_command_init(&module.cmd_wake_latency_reset,
+                    CSTR("/kernel/thrd/wake_latency/reset"),
+                    cmd_wake_latency_reset_cb,
+                    NULL);
+    fs_command_register(&module.cmd_wake_latency_reset);
+#    endif
+
 #    if CONFIG_MONITOR_THREAD == 1
     fs_command_init(&module.cmd_monitor_set_period_ms,
                     CSTR("/kernel/thrd/monitor/set_period_ms"),
@@ -536,6 +719,7 @@ struct thrd_t *thrd_spawn(void *(*main)(void *),
     thrd_p->timer_p = NULL;
     thrd_p->name_p = "";
     thrd_p->stack_size = (stack_size - sizeof(*thrd_p));
+    thrd_mutex_init(thrd_p);
 
 #if CONFIG_THRD_TERMINATE == 1
     sem_init(&thrd_p->join_sem, 1, 1);
@@ -549,6 +733,10 @@ struct thrd_t *thrd_spawn(void *(*main)(void *),
     thrd_p->statistics.scheduled = 0;
 #endif
 
+#if CONFIG_THRD_WAKE_LATENCY == 1
+    wake_latency_reset(thrd_p);
+#endif
+
 #if CONFIG_THRD_ENV == 1
     thrd_p->env.variables_p = NULL;
     thrd_p->env.number_of_variables = 0;
@@ -704,6 +892,15 @@ struct thrd_t *thrd_get_by_name(const char *name_p)
     return (NULL);
 }
 
+struct thrd_t *thrd_get_next(struct thrd_t *thrd_p)
+{
+    if (thrd_p == NULL) {
+        return (module.threads_p);
+    }
+
+    return (thrd_p->next_p);
+}
+
 int thrd_set_log_mask(struct thrd_t *thrd_p, int mask)
 {
     ASSERTN(thrd_p != NULL, EINVAL);
@@ -725,8 +922,32 @@ int thrd_set_prio(struct thrd_t *thrd_p, int prio)
 {
     ASSERTN(thrd_p != NULL, EINVAL);
 
+    sys_lock();
+
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+    mutex_set_thrd_prio_isr(thrd_p, prio);
+#else
+    thrd_set_prio_isr(thrd_p, prio);
+#endif
+
+    sys_unlock();
+
+    return (0);
+}
+
+int thrd_set_prio_isr(struct thrd_t *thrd_p, int prio)
+{
+    ASSERTN(thrd_p != NULL, EINVAL);
+
     thrd_p->prio = prio;
 
+    /* Move the thread to its new position in the ready list. */
+    if (thrd_p->state == THRD_STATE_READY) {
+        thrd_prio_list_remove_isr(&module.scheduler.ready,
+                                  &thrd_p->scheduler.elem);
+        scheduler_ready_push(thrd_p);
+    }
+
     return (0);
 }
 
@@ -890,6 +1111,10 @@ int thrd_resume_isr(struct thrd_t *thrd_p, int err)
         }
 
         scheduler_ready_push(thrd_p);
+
+#if CONFIG_THRD_WAKE_LATENCY == 1
+        thrd_port_wake_latency_start(thrd_p);
+#endif
     } else if (thrd_p->state != THRD_STATE_TERMINATED) {
         thrd_p->state = THRD_STATE_RESUMED;
     } else {
@@ -42,6 +42,14 @@
  */
 #define THRD_STACK(name, size) THRD_PORT_STACK(name, size)
 
+/**
+ * Number of buckets in the wake latency histogram of a thread. Bucket
+ * zero counts latencies below one microsecond, bucket N latencies in
+ * the range [2^(N-1), 2^N) microseconds, and the last bucket all
+ * longer latencies.
+ */
+#define THRD_WAKE_LATENCY_HISTOGRAM_LENGTH                 16
+
 /**
  * Push all callee-save registers not part of the context struct. The
  * preemptive scheduler requires this macro before the
@@ -96,6 +104,25 @@ struct thrd_t {
     struct thrd_t *next_p;
 #if CONFIG_THRD_TERMINATE == 1
     struct sem_t join_sem;
+#endif
+#if CONFIG_CONTENTION == 1
+    struct {
+        /** Timestamp when the thread started waiting for a
+            synchronization object. */
+        uint32_t wait_start;
+    } contention;
+#endif
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1 || CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+    struct {
+        /** The mutex this thread is waiting for, if any. */
+        struct mutex_t *waiting_for_p;
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+        /** Priority without any inherited priority. */
+        int8_t prio;
+        /** Mutexes owned by this thread. */
+        struct mutex_t *owned_p;
+#endif
+    } mutex;
 #endif
     struct {
 #if CONFIG_THRD_CPU_USAGE == 1
@@ -109,6 +136,15 @@ struct thrd_t {
 #endif
 #if CONFIG_THRD_SCHEDULED == 1
         uint32_t scheduled;
+#endif
+#if CONFIG_THRD_WAKE_LATENCY == 1
+        /** Time from the thread was woken, by `thrd_resume_isr()`
+            or a suspend timeout, until it was running. */
+        struct {
+            uint32_t histogram[THRD_WAKE_LATENCY_HISTOGRAM_LENGTH];
+            /** Longest latency in microseconds. */
+            uint32_t max;
+        } wake_latency;
 #endif
     } statistics;
 #if CONFIG_THRD_ENV == 1
@@ -267,6 +303,15 @@ const char *thrd_get_name(void);
  */
 struct thrd_t *thrd_get_by_name(const char *name_p);
 
+/**
+ * Get the thread after given thread in the list of all threads.
+ *
+ * @param[in] thrd_p Thread, or NULL to get the first thread.
+ *
+ * @return Next thread or NULL if given thread is the last one.
+ */
+struct thrd_t *thrd_get_next(struct thrd_t *thrd_p);
+
 /**
  * Set the log mask of given thread.
  *
@@ -285,7 +330,12 @@ int thrd_set_log_mask(struct thrd_t *thrd_p, int mask);
 int thrd_get_log_mask(void);
 
 /**
- * Set the priority of given thread.
+ * Set the priority of given thread. A priority inherited from a
+ * thread waiting for a mutex owned by given thread is kept until the
+ * mutex is unlocked, if higher than the new priority. If given thread
+ * is waiting for a mutex, it is moved to its new position among the
+ * waiters, and the owner of the mutex inherits the new priority, or
+ * stops inheriting the old one.
  *
  * @param[in] thrd_p Thread to set the priority for.
  * @param[in] prio Priority.
@@ -294,6 +344,19 @@ int thrd_get_log_mask(void);
  */
 int thrd_set_prio(struct thrd_t *thrd_p, int prio);
 
+/**
+ * Set the scheduling priority of given thread with the system lock
+ * taken. A ready thread is moved to its new position in the ready
+ * list. Unlike `thrd_set_prio()`, the priority restored when the
+ * thread releases an inherited priority is not changed.
+ *
+ * @param[in] thrd_p Thread to set the priority for.
+ * @param[in] prio Priority.
+ *
+ * @return zero(0) or negative error code.
+ */
+int thrd_set_prio_isr(struct thrd_t *thrd_p, int prio);
+
 /**
  * Get the priority of the current thread.
  *
@@ -159,3 +159,38 @@ int time_micros_maximum()
 {
     return (time_port_micros_maximum());
 }
+
+uint32_t time_timestamp()
+{
+    uint32_t timestamp;
+
+    sys_lock();
+    timestamp = time_timestamp_isr();
+    sys_unlock();
+
+    return (timestamp);
+}
+
+uint32_t time_timestamp_isr()
+{
+#if defined(TIME_PORT_HAS_TIMESTAMP)
+    return (time_port_timestamp_isr());
+#else
+    struct time_t now;
+
+    /* The uptime includes the time into the current tick on ports
+       that support it. */
+    sys_uptime_isr(&now);
+
+    return ((uint32_t)(now.seconds * 1000000ul + now.nanoseconds / 1000));
+#endif
+}
+
+int time_timestamp_resolution()
+{
+#if defined(TIME_PORT_HAS_TIMESTAMP)
+    return (time_port_timestamp_resolution());
+#else
+    return (DIV_CEIL(1000000, CONFIG_SYSTEM_TICK_FREQUENCY));
+#endif
+}
@@ -203,4 +203,34 @@ int time_micros_resolution(void);
  */
 int time_micros_maximum(void);
 
+/**
+ * Get a timestamp in microseconds, for measuring durations with
+ * higher resolution than the system tick where the port supports it,
+ * for example when tracing and profiling. The timestamp wraps at
+ * 2^32, so the difference between two timestamps is correct for
+ * durations up to about 71 minutes. Use
+ * `time_timestamp_resolution()` to get its resolution.
+ *
+ * @return Current timestamp in microseconds.
+ */
+uint32_t time_timestamp(void);
+
+/**
+ * Same as `time_timestamp()`, but may only be called from interrupt
+ * context or with the system lock taken.
+ *
+ * @return Current timestamp in microseconds.
+ */
+uint32_t time_timestamp_isr(void);
+
+/**
+ * Get the timestamp resolution in microseconds, rounded up.
+ *
+ * This function may be called from interrupt context and with the
+ * system lock taken.
+ *
+ * @return Resolution in microseconds.
+ */
+int time_timestamp_resolution(void);
+
 #endif
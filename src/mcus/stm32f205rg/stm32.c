@@ -28,10 +28,12 @@
 
 #include "simba.h"
 
-#define ISR_WRAPPER(vector)                             \
-    static void isr_ ## vector ## _wrapper(void)        \
-    {                                                   \
-        isr_ ## vector();                               \
+#define ISR_WRAPPER(vector)                                  \
+    static void isr_ ## vector ## _wrapper(void)             \
+    {                                                        \
+        TRACE_ISR(TRACE_EVENT_ISR_ENTER, 0, isr_ ## vector); \
+        isr_ ## vector();                                    \
+        TRACE_ISR(TRACE_EVENT_ISR_EXIT, 0, isr_ ## vector);  \
     }
 
 /* Defined in the linker script. */
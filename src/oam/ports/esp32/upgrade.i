@@ -291,6 +291,19 @@ static int upgrade_port_application_is_valid(int quick)
     }
 }
 
+#if CONFIG_UPGRADE_DELTA == 1
+
+static int upgrade_port_application_read(size_t offset,
+                                         void *buf_p,
+                                         size_t size)
+{
+    /* The application is erased and written in place by the
+       bootloader, so it cannot be used as delta source. */
+    return (-ENOSYS);
+}
+
+#endif
+
 static int upgrade_port_binary_upload_begin()
 {
     application.partition_p = get_application_partition();
@@ -339,7 +352,9 @@ static int upgrade_port_binary_upload_end()
         return (-1);
     }
 
-    if (upgrade_application_is_valid(0) != 1) {
+    /* The data SHA1 was verified during the upload, so there is no
+       need to read back the whole application. */
+    if (upgrade_application_is_valid(1) != 1) {
         return (-1);
     }
 
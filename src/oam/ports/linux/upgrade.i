@@ -26,8 +26,17 @@
  * This file is part of the Simba project.
  */
 
+/* The installed application is stored in a file. A new application
+   is written to a temporary file that replaces the installed one when
+   the upload ends, so the installed application is available as delta
+   source during the whole upload. */
+#define APPLICATION_FILENAME "application.bin"
+#define APPLICATION_NEW_FILENAME "application.bin.new"
+
 struct module_port_t {
     int stay_in_bootloader;
+    FILE *application_p;
+    FILE *application_new_p;
 };
 
 static struct module_port_t module_port;
@@ -63,6 +72,8 @@ static int upgrade_port_application_enter()
 
 static int upgrade_port_application_erase()
 {
+    (void)remove(APPLICATION_FILENAME);
+
     return (0);
 }
 
@@ -71,18 +82,83 @@ static int upgrade_port_application_is_valid()
     return (0);
 }
 
+#if CONFIG_UPGRADE_DELTA == 1
+
+static int upgrade_port_application_read(size_t offset,
+                                         void *buf_p,
+                                         size_t size)
+{
+    if (module_port.application_p == NULL) {
+        return (-ENOENT);
+    }
+
+    if (fseek(module_port.application_p, offset, SEEK_SET) != 0) {
+        return (-EIO);
+    }
+
+    if (fread(buf_p, 1, size, module_port.application_p) != size) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+#endif
+
+static void close_files(void)
+{
+    if (module_port.application_p != NULL) {
+        fclose(module_port.application_p);
+        module_port.application_p = NULL;
+    }
+
+    if (module_port.application_new_p != NULL) {
+        fclose(module_port.application_new_p);
+        module_port.application_new_p = NULL;
+    }
+}
+
 static int upgrade_port_binary_upload_begin()
 {
+    close_files();
+
+    module_port.application_new_p = fopen(APPLICATION_NEW_FILENAME, "wb");
+
+    if (module_port.application_new_p == NULL) {
+        return (-1);
+    }
+
+    /* The installed application is optional. */
+    module_port.application_p = fopen(APPLICATION_FILENAME, "rb");
+
     return (0);
 }
 
 static int upgrade_port_binary_upload(const void *buf_p,
                                       size_t size)
 {
+    if (module_port.application_new_p == NULL) {
+        return (-1);
+    }
+
+    if (fwrite(buf_p, 1, size, module_port.application_new_p) != size) {
+        return (-EIO);
+    }
+
     return (0);
 }
 
 static int upgrade_port_binary_upload_end()
 {
+    if (module_port.application_new_p == NULL) {
+        return (-1);
+    }
+
+    close_files();
+
+    if (rename(APPLICATION_NEW_FILENAME, APPLICATION_FILENAME) != 0) {
+        return (-1);
+    }
+
     return (0);
 }
@@ -30,6 +30,7 @@
 
 struct module_t {
     int8_t initialized;
+    int number_of_settings;
 #if CONFIG_SETTINGS_FS_COMMAND_LIST == 1
     struct fs_command_t cmd_list;
 #endif
@@ -47,6 +48,7 @@ struct module_t {
 static struct module_t module;
 
 extern const FAR struct setting_t settings[];
+extern const FAR uint16_t settings_by_name[] __attribute__ ((weak));
 const FAR uint8_t settings_default[CONFIG_SETTINGS_AREA_SIZE]
 __attribute__ ((weak)) = { 0xff, };
 
@@ -54,6 +56,33 @@ static const FAR struct setting_t *get_setting_by_name(
     const char *name_p)
 {
     const FAR struct setting_t *setting_p;
+    int low;
+    int middle;
+    int high;
+    int res;
+
+    /* Binary search in the index sorted by name, generated by
+       simbagen.py. */
+    if ((settings_by_name != NULL) && (module.initialized == 1)) {
+        low = 0;
+        high = (module.number_of_settings - 1);
+
+        while (low <= high) {
+            middle = ((low + high) / 2);
+            setting_p = &settings[settings_by_name[middle]];
+            res = std_strcmp(name_p, setting_p->name_p);
+
+            if (res == 0) {
+                return (setting_p);
+            } else if (res < 0) {
+                high = (middle - 1);
+            } else {
+                low = (middle + 1);
+            }
+        }
+
+        return (NULL);
+    }
 
     setting_p = &settings[0];
 
@@ -418,6 +447,11 @@ int settings_module_init(void)
     }
 
     module.initialized = 1;
+    module.number_of_settings = 0;
+
+    while (settings[module.number_of_settings].name_p != NULL) {
+        module.number_of_settings++;
+    }
 
 #if CONFIG_SETTINGS_FS_COMMAND_LIST == 1
     fs_command_init(&module.cmd_list,
@@ -41,11 +41,20 @@
 #define SOAM_TYPE_DATABASE_ID_RESPONSE               (9 << 4)
 #define SOAM_TYPE_DATABASE_REQUEST                  (10 << 4)
 #define SOAM_TYPE_DATABASE_RESPONSE                 (11 << 4)
+#define SOAM_TYPE_COMMAND_BATCH_REQUEST             (12 << 4)
+#define SOAM_TYPE_SNAPSHOT_REQUEST                  (13 << 4)
+#define SOAM_TYPE_SNAPSHOT_RESPONSE                 (14 << 4)
 #define SOAM_TYPE_INVALID_TYPE                      (15 << 4)
 
 #define SOAM_PACKET_FLAGS_CONSECUTIVE                (1 << 1)
 #define SOAM_PACKET_FLAGS_LAST                       (1 << 0)
 
+/* Snapshot response entry kinds. */
+#define SOAM_SNAPSHOT_MISSING                                0
+#define SOAM_SNAPSHOT_COUNTER                                1
+#define SOAM_SNAPSHOT_PARAMETER_INT                          2
+#define SOAM_SNAPSHOT_UNSUPPORTED                            3
+
 #define BUFFER_SIZE                                        64
 
 /* The generated SOAM database id. */
@@ -286,6 +295,176 @@ static int handle_command_request(struct soam_t *self_p,
     return (0);
 }
 
+/**
+ * Count the null terminated strings in given payload. Returns
+ * negative error code if the last string is not null terminated.
+ */
+static int count_strings(const uint8_t *payload_p, size_t size)
+{
+    int count;
+    size_t i;
+
+    if ((size == 0) || (payload_p[size - 1] != '\0')) {
+        return (-EINVAL);
+    }
+
+    count = 0;
+
+    for (i = 0; i < size; i++) {
+        if (payload_p[i] == '\0') {
+            count++;
+        }
+    }
+
+    return (count);
+}
+
+/**
+ * Execute all null terminated commands in given payload and respond
+ * with a command response packet of one result per command. Output
+ * from the commands is written as for single command requests.
+ */
+static int handle_command_batch_request(struct soam_t *self_p,
+                                        uint8_t *payload_p,
+                                        size_t size)
+{
+    int32_t res;
+    int number_of_commands;
+    int i;
+    char *command_p;
+    size_t length;
+    uint8_t buf[4 * CONFIG_SOAM_COMMAND_BATCH_MAX];
+
+    number_of_commands = count_strings(payload_p, size);
+
+    if (number_of_commands < 0) {
+        return (-1);
+    }
+
+    if (number_of_commands > CONFIG_SOAM_COMMAND_BATCH_MAX) {
+        res = -E2BIG;
+        buf[0] = (res >> 24);
+        buf[1] = (res >> 16);
+        buf[2] = (res >> 8);
+        buf[3] = res;
+        number_of_commands = 1;
+    } else {
+        command_p = (char *)payload_p;
+
+        for (i = 0; i < number_of_commands; i++) {
+            /* The command string is modified by fs_call(). */
+            length = strlen(command_p);
+            res = fs_call(command_p,
+                          &self_p->command_chan,
+                          &self_p->command_chan,
+                          NULL);
+            buf[4 * i + 0] = (res >> 24);
+            buf[4 * i + 1] = (res >> 16);
+            buf[4 * i + 2] = (res >> 8);
+            buf[4 * i + 3] = res;
+            command_p += (length + 1);
+        }
+    }
+
+    size = (4 * number_of_commands);
+
+    if (soam_write(self_p,
+                   SOAM_TYPE_COMMAND_RESPONSE,
+                   &buf[0],
+                   size) != (ssize_t)size) {
+        return (-1);
+    }
+
+    return (0);
+}
+
+/**
+ * Write the binary value of given counter or parameter path.
+ */
+static void snapshot_write_entry(struct soam_t *self_p,
+                                 const char *path_p)
+{
+    struct fs_counter_t *counter_p;
+    struct fs_parameter_t *parameter_p;
+    uint64_t value;
+    uint8_t buf[9];
+    size_t size;
+    int i;
+
+    counter_p = fs_counter_get_by_path(path_p);
+
+    if (counter_p != NULL) {
+        sys_lock();
+        value = counter_p->value;
+        sys_unlock();
+
+        buf[0] = SOAM_SNAPSHOT_COUNTER;
+
+        for (i = 0; i < 8; i++) {
+            buf[8 - i] = value;
+            value >>= 8;
+        }
+
+        size = 9;
+    } else {
+        parameter_p = fs_parameter_get_by_path(path_p);
+
+        if (parameter_p == NULL) {
+            buf[0] = SOAM_SNAPSHOT_MISSING;
+            size = 1;
+        } else if (parameter_p->print_cb == fs_parameter_int_print) {
+            value = *(int *)parameter_p->value_p;
+            buf[0] = SOAM_SNAPSHOT_PARAMETER_INT;
+            buf[1] = (value >> 24);
+            buf[2] = (value >> 16);
+            buf[3] = (value >> 8);
+            buf[4] = value;
+            size = 5;
+        } else {
+            buf[0] = SOAM_SNAPSHOT_UNSUPPORTED;
+            size = 1;
+        }
+    }
+
+    (void)soam_write_chunk(self_p, &buf[0], size);
+}
+
+/**
+ * Respond with the binary values of all counters and parameters in
+ * given payload, in request order. No format strings are involved.
+ */
+static int handle_snapshot_request(struct soam_t *self_p,
+                                   uint8_t *payload_p,
+                                   size_t size)
+{
+    int number_of_paths;
+    int i;
+    const char *path_p;
+
+    number_of_paths = count_strings(payload_p, size);
+
+    if (number_of_paths < 0) {
+        return (-1);
+    }
+
+    if (soam_write_begin(self_p, SOAM_TYPE_SNAPSHOT_RESPONSE) != 0) {
+        return (-1);
+    }
+
+    path_p = (const char *)payload_p;
+
+    for (i = 0; i < number_of_paths; i++) {
+        snapshot_write_entry(self_p, path_p);
+        path_p += (strlen(path_p) + 1);
+    }
+
+    if (soam_write_end(self_p) < 0) {
+        return (-1);
+    }
+
+    return (0);
+}
+
 int soam_init(struct soam_t *self_p,
               void *buf_p,
               size_t size,
@@ -343,7 +522,7 @@ int soam_input(struct soam_t *self_p,
 
     payload_crc_size = ((buf_p[3] << 8) | buf_p[4]);
 
-    if (payload_crc_size > (size - 5)) {
+    if ((payload_crc_size < 2) || (payload_crc_size > (size - 5))) {
         return (-1);
     }
 
@@ -378,6 +557,18 @@ int soam_input(struct soam_t *self_p,
         res = handle_command_request(self_p, buf_p);
         break;
 
+    case SOAM_TYPE_COMMAND_BATCH_REQUEST:
+        res = handle_command_batch_request(self_p,
+                                           &buf_p[5],
+                                           payload_crc_size - 2);
+        break;
+
+    case SOAM_TYPE_SNAPSHOT_REQUEST:
+        res = handle_snapshot_request(self_p,
+                                      &buf_p[5],
+                                      payload_crc_size - 2);
+        break;
+
     default:
         soam_write(self_p, SOAM_TYPE_INVALID_TYPE, buf_p, size);
         res = -1;
@@ -28,18 +28,79 @@
 
 #include "simba.h"
 
+/* Header versions. Version 2 headers are followed by a delta
+   instead of the application. */
+#define HEADER_VERSION_APPLICATION                          1
+#define HEADER_VERSION_DELTA                                2
+
+/* Delta decoder states. */
+#define DELTA_STATE_COMMAND                                 0
+#define DELTA_STATE_OFFSET                                  1
+#define DELTA_STATE_INSERT                                  2
+
+/* Delta command types, stored in the least significant bit of the
+   command. */
+#define DELTA_COMMAND_COPY                                  0
+#define DELTA_COMMAND_INSERT                                1
+
 struct upgrade_binary_header_t {
+    uint32_t version;
     uint32_t size;
     uint8_t sha1[20];
+    uint32_t source_size;
+    uint8_t source_sha1[20];
     char description[128];
 };
 
+#if CONFIG_UPGRADE_DELTA == 1
+
+/**
+ * Delta decoder. Only a few variables are needed as the delta is
+ * applied while it is received.
+ */
+struct delta_t {
+    int state;
+    uint32_t value;
+    int shift;
+    uint32_t size;
+    uint32_t source_offset;
+};
+
+#endif
+
+#if CONFIG_UPGRADE_PIPELINE == 1
+
+struct pipeline_buffer_t {
+    size_t size;
+    uint8_t buf[CONFIG_UPGRADE_PIPELINE_BUFFER_SIZE];
+};
+
+#endif
+
 struct module_t {
     int8_t initialized;
     uint8_t buf[256];
     ssize_t header_size;
     size_t offset;
     struct upgrade_binary_header_t header;
+    struct sha1_t sha1;
+    uint32_t application_size;
+    struct upgrade_binary_upload_progress_t progress;
+#if CONFIG_UPGRADE_DELTA == 1
+    struct delta_t delta;
+#endif
+#if CONFIG_UPGRADE_PIPELINE == 1
+    struct {
+        struct pipeline_buffer_t buffers[2];
+        struct pipeline_buffer_t *filling_p;
+        struct queue_t full;
+        struct pipeline_buffer_t *full_buf[3];
+        struct queue_t free;
+        struct pipeline_buffer_t *free_buf[3];
+        int res;
+        THRD_STACK(stack, CONFIG_UPGRADE_PIPELINE_STACK_SIZE);
+    } pipeline;
+#endif
 #if CONFIG_UPGRADE_FS_COMMAND_BOOTLOADER_ENTER == 1
     struct fs_command_t cmd_bootloader_enter;
 #endif
@@ -52,6 +113,9 @@ struct module_t {
 #if CONFIG_UPGRADE_FS_COMMAND_APPLICATION_IS_VALID == 1
     struct fs_command_t cmd_application_is_valid;
 #endif
+#if CONFIG_UPGRADE_FS_COMMAND_BINARY_UPLOAD_PROGRESS == 1
+    struct fs_command_t cmd_binary_upload_progress;
+#endif
 };
 
 static struct module_t module;
@@ -64,13 +128,30 @@ static int binary_header_parse(struct upgrade_binary_header_t *header_p,
 {
     uint32_t version;
     uint32_t crc;
+    size_t description_offset;
 
     version = ((src_p[0] << 24)
                | (src_p[1] << 16)
                | (src_p[2] << 8)
                | src_p[3]);
 
-    if (version != 1) {
+    switch (version) {
+
+    case HEADER_VERSION_APPLICATION:
+        description_offset = 32;
+        break;
+
+#if CONFIG_UPGRADE_DELTA == 1
+    case HEADER_VERSION_DELTA:
+        description_offset = 56;
+        break;
+#endif
+
+    default:
+        return (-1);
+    }
+
+    if (size < description_offset + 8) {
         return (-1);
     }
 
@@ -83,17 +164,29 @@ static int binary_header_parse(struct upgrade_binary_header_t *header_p,
         return (-1);
     }
 
+    header_p->version = version;
     header_p->size = ((src_p[8] << 24)
                       | (src_p[9] << 16)
                       | (src_p[10] << 8)
                       | src_p[11]);
     memcpy(&header_p->sha1[0], &src_p[12], sizeof(header_p->sha1));
 
-    if (strlen((char *)&src_p[32]) >= sizeof(header_p->description)) {
+    if (version == HEADER_VERSION_DELTA) {
+        header_p->source_size = ((src_p[32] << 24)
+                                 | (src_p[33] << 16)
+                                 | (src_p[34] << 8)
+                                 | src_p[35]);
+        memcpy(&header_p->source_sha1[0],
+               &src_p[36],
+               sizeof(header_p->source_sha1));
+    }
+
+    if (strlen((char *)&src_p[description_offset])
+        >= sizeof(header_p->description)) {
         return (-1);
     }
 
-    strcpy(&header_p->description[0], (char *)&src_p[32]);
+    strcpy(&header_p->description[0], (char *)&src_p[description_offset]);
 
     return (0);
 }
@@ -178,6 +271,362 @@ static int cmd_application_is_valid_cb(int argc,
 
 #endif
 
+#if CONFIG_UPGRADE_FS_COMMAND_BINARY_UPLOAD_PROGRESS == 1
+
+/**
+ * Print the progress of the current, or latest, binary upload.
+ */
+static int cmd_binary_upload_progress_cb(int argc,
+                                         const char *argv[],
+                                         void *out_p,
+                                         void *in_p,
+                                         void *arg_p,
+                                         void *call_arg_p)
+{
+    struct upgrade_binary_upload_progress_t progress;
+
+    upgrade_binary_upload_get_progress(&progress);
+
+    std_fprintf(out_p,
+                OSTR("size: %lu\r\n"
+                     "received: %lu\r\n"
+                     "written: %lu\r\n"),
+                (unsigned long)progress.size,
+                (unsigned long)progress.received,
+                (unsigned long)progress.written);
+
+    return (0);
+}
+
+#endif
+
+#if CONFIG_UPGRADE_PIPELINE == 1
+
+/**
+ * Writes filled buffers to the application area, in order, and
+ * returns them to the receiver.
+ */
+static void *pipeline_main(void *arg_p)
+{
+    struct pipeline_buffer_t *buffer_p;
+    int res;
+
+    thrd_set_name("upgrade");
+
+    while (1) {
+        queue_read(&module.pipeline.full, &buffer_p, sizeof(buffer_p));
+
+        /* Skip all writes after the first failure. */
+        if (module.pipeline.res == 0) {
+            res = upgrade_port_binary_upload(&buffer_p->buf[0],
+                                             buffer_p->size);
+
+            if (res == 0) {
+                module.progress.written += buffer_p->size;
+            } else {
+                module.pipeline.res = res;
+            }
+        }
+
+        queue_write(&module.pipeline.free, &buffer_p, sizeof(buffer_p));
+    }
+
+    return (NULL);
+}
+
+/**
+ * Hand the buffer being filled to the writer thread and continue
+ * with the other buffer, once it has been written.
+ */
+static void pipeline_submit(void)
+{
+    queue_write(&module.pipeline.full,
+                &module.pipeline.filling_p,
+                sizeof(module.pipeline.filling_p));
+    queue_read(&module.pipeline.free,
+               &module.pipeline.filling_p,
+               sizeof(module.pipeline.filling_p));
+    module.pipeline.filling_p->size = 0;
+}
+
+/**
+ * Wait for the buffer not being filled to be written.
+ */
+static void pipeline_wait(void)
+{
+    struct pipeline_buffer_t *buffer_p;
+
+    queue_read(&module.pipeline.free, &buffer_p, sizeof(buffer_p));
+    queue_write(&module.pipeline.free, &buffer_p, sizeof(buffer_p));
+}
+
+static int pipeline_write(const uint8_t *buf_p, size_t size)
+{
+    struct pipeline_buffer_t *buffer_p;
+    size_t chunk_size;
+
+    while (size > 0) {
+        if (module.pipeline.res != 0) {
+            break;
+        }
+
+        buffer_p = module.pipeline.filling_p;
+        chunk_size = MIN(size, sizeof(buffer_p->buf) - buffer_p->size);
+        memcpy(&buffer_p->buf[buffer_p->size], buf_p, chunk_size);
+        buffer_p->size += chunk_size;
+        buf_p += chunk_size;
+        size -= chunk_size;
+
+        if (buffer_p->size == sizeof(buffer_p->buf)) {
+            pipeline_submit();
+        }
+    }
+
+    return (module.pipeline.res);
+}
+
+/**
+ * Write any buffered data and wait for all writes to complete.
+ */
+static int pipeline_flush(void)
+{
+    if (module.pipeline.filling_p->size > 0) {
+        pipeline_submit();
+    }
+
+    pipeline_wait();
+
+    return (module.pipeline.res);
+}
+
+#endif
+
+/**
+ * Write and hash given application data. The hash and size are only
+ * updated if the data was written.
+ */
+static int application_write(const uint8_t *buf_p, size_t size)
+{
+    int res;
+
+    if (size > module.header.size - module.application_size) {
+        log_object_print(NULL,
+                         LOG_ERROR,
+                         OSTR("upgrade data too big\r\n"));
+        return (-1);
+    }
+
+#if CONFIG_UPGRADE_PIPELINE == 1
+    res = pipeline_write(buf_p, size);
+#else
+    res = upgrade_port_binary_upload(buf_p, size);
+
+    if (res == 0) {
+        module.progress.written += size;
+    }
+#endif
+
+    if (res == 0) {
+        sha1_update(&module.sha1, (void *)buf_p, size);
+        module.application_size += size;
+    }
+
+    return (res);
+}
+
+#if CONFIG_UPGRADE_DELTA == 1
+
+/**
+ * Verify that the installed application is the one the delta was
+ * created from, before anything is written.
+ */
+static int delta_source_verify(void)
+{
+    int res;
+    uint32_t offset;
+    size_t size;
+    uint8_t sha1[20];
+
+    sha1_init(&module.sha1);
+
+    for (offset = 0; offset < module.header.source_size; offset += size) {
+        size = MIN(sizeof(module.buf), module.header.source_size - offset);
+        res = upgrade_port_application_read(offset, &module.buf[0], size);
+
+        if (res != 0) {
+            log_object_print(NULL,
+                             LOG_ERROR,
+                             OSTR("failed to read the delta source\r\n"));
+            return (res);
+        }
+
+        sha1_update(&module.sha1, &module.buf[0], size);
+    }
+
+    sha1_digest(&module.sha1, &sha1[0]);
+    sha1_init(&module.sha1);
+
+    if (memcmp(&sha1[0],
+               &module.header.source_sha1[0],
+               sizeof(sha1)) != 0) {
+        log_object_print(NULL,
+                         LOG_ERROR,
+                         OSTR("delta source sha1 mismatch\r\n"));
+        return (-1);
+    }
+
+    return (0);
+}
+
+/**
+ * Copy given number of bytes from the installed application to the
+ * new application.
+ */
+static int delta_copy(uint32_t offset, uint32_t size)
+{
+    int res;
+    size_t chunk_size;
+
+    if ((offset > module.header.source_size)
+        || (size > module.header.source_size - offset)) {
+        log_object_print(NULL,
+                         LOG_ERROR,
+                         OSTR("delta copy out of range\r\n"));
+        return (-1);
+    }
+
+    while (size > 0) {
+        chunk_size = MIN(sizeof(module.buf), size);
+        res = upgrade_port_application_read(offset,
+                                            &module.buf[0],
+                                            chunk_size);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        res = application_write(&module.buf[0], chunk_size);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        offset += chunk_size;
+        size -= chunk_size;
+    }
+
+    return (0);
+}
+
+/**
+ * Decode given delta data. A delta is a sequence of copy and insert
+ * commands. A command is a variable length integer with the size in
+ * the upper bits and the type in the least significant bit. A copy
+ * command is followed by a zigzag encoded variable length integer,
+ * the offset in the installed application relative to the end of
+ * the previous copy. An insert command is followed by the data to
+ * insert.
+ */
+static int delta_write(const uint8_t *buf_p, size_t size)
+{
+    int res;
+    struct delta_t *delta_p;
+    size_t chunk_size;
+    uint32_t value;
+
+    delta_p = &module.delta;
+
+    while (size > 0) {
+        if (delta_p->state == DELTA_STATE_INSERT) {
+            chunk_size = MIN(size, delta_p->size);
+            res = application_write(buf_p, chunk_size);
+
+            if (res != 0) {
+                return (res);
+            }
+
+            buf_p += chunk_size;
+            size -= chunk_size;
+            delta_p->size -= chunk_size;
+
+            if (delta_p->size == 0) {
+                delta_p->state = DELTA_STATE_COMMAND;
+            }
+
+            continue;
+        }
+
+        /* Variable length integer. */
+        if (delta_p->shift > 28) {
+            log_object_print(NULL,
+                             LOG_ERROR,
+                             OSTR("bad delta integer\r\n"));
+            return (-1);
+        }
+
+        delta_p->value |= ((uint32_t)(*buf_p & 0x7f) << delta_p->shift);
+        delta_p->shift += 7;
+        buf_p++;
+        size--;
+
+        if ((buf_p[-1] & 0x80) != 0) {
+            continue;
+        }
+
+        value = delta_p->value;
+        delta_p->value = 0;
+        delta_p->shift = 0;
+
+        if (delta_p->state == DELTA_STATE_COMMAND) {
+            delta_p->size = (value >> 1);
+
+            if ((value & 1) == DELTA_COMMAND_COPY) {
+                delta_p->state = DELTA_STATE_OFFSET;
+            } else if (delta_p->size > 0) {
+                delta_p->state = DELTA_STATE_INSERT;
+            }
+        } else {
+            delta_p->source_offset += ((value >> 1) ^ -(value & 1));
+            res = delta_copy(delta_p->source_offset, delta_p->size);
+
+            if (res != 0) {
+                return (res);
+            }
+
+            delta_p->source_offset += delta_p->size;
+            delta_p->state = DELTA_STATE_COMMAND;
+        }
+    }
+
+    return (0);
+}
+
+#endif
+
+/**
+ * Write given data, following the header.
+ */
+static int data_upload(const uint8_t *buf_p, size_t size)
+{
+    int res;
+
+#if CONFIG_UPGRADE_DELTA == 1
+    if (module.header.version == HEADER_VERSION_DELTA) {
+        res = delta_write(buf_p, size);
+    } else {
+        res = application_write(buf_p, size);
+    }
+#else
+    res = application_write(buf_p, size);
+#endif
+
+    if (res == 0) {
+        module.progress.received += size;
+    }
+
+    return (res);
+}
+
 int upgrade_module_init()
 {
     /* Return immediately if the module is already initialized. */
@@ -219,6 +668,35 @@ int upgrade_module_init()
     fs_command_register(&module.cmd_application_is_valid);
 #endif
 
+#if CONFIG_UPGRADE_FS_COMMAND_BINARY_UPLOAD_PROGRESS == 1
+    fs_command_init(&module.cmd_binary_upload_progress,
+                    CSTR("/oam/upgrade/binary/upload/progress"),
+                    cmd_binary_upload_progress_cb,
+                    NULL);
+    fs_command_register(&module.cmd_binary_upload_progress);
+#endif
+
+#if CONFIG_UPGRADE_PIPELINE == 1
+    queue_init(&module.pipeline.full,
+               &module.pipeline.full_buf[0],
+               sizeof(module.pipeline.full_buf));
+    queue_init(&module.pipeline.free,
+               &module.pipeline.free_buf[0],
+               sizeof(module.pipeline.free_buf));
+    module.pipeline.filling_p = &module.pipeline.buffers[0];
+    module.pipeline.filling_p->size = 0;
+    module.pipeline.free_buf[0] = &module.pipeline.buffers[1];
+    queue_write(&module.pipeline.free,
+                &module.pipeline.free_buf[0],
+                sizeof(module.pipeline.free_buf[0]));
+
+    thrd_spawn(pipeline_main,
+               NULL,
+               0,
+               module.pipeline.stack,
+               sizeof(module.pipeline.stack));
+#endif
+
     return (0);
 }
 
@@ -261,6 +739,21 @@ int upgrade_binary_upload_begin()
 {
     module.header_size = -1;
     module.offset = 0;
+    module.application_size = 0;
+    module.progress.size = 0;
+    module.progress.received = 0;
+    module.progress.written = 0;
+    sha1_init(&module.sha1);
+#if CONFIG_UPGRADE_DELTA == 1
+    memset(&module.delta, 0, sizeof(module.delta));
+#endif
+
+#if CONFIG_UPGRADE_PIPELINE == 1
+    /* Drop data buffered by an aborted upload. */
+    module.pipeline.filling_p->size = 0;
+    pipeline_wait();
+    module.pipeline.res = 0;
+#endif
 
     return (upgrade_port_binary_upload_begin());
 }
@@ -317,20 +810,85 @@ int upgrade_binary_upload(const void *buf_p,
                          module.header.description,
                          module.header.size);
 
+#if CONFIG_UPGRADE_DELTA == 1
+        if (module.header.version == HEADER_VERSION_DELTA) {
+            if (delta_source_verify() != 0) {
+                return (-1);
+            }
+        }
+#endif
+
         chunk_size = (module.header_size - (module.offset - chunk_size));
         size -= chunk_size;
         buf_p += chunk_size;
         module.header_size = 0;
+        module.progress.size = module.header.size;
 
         if (size == 0) {
             return (0);
         }
     }
 
-    return (upgrade_port_binary_upload(buf_p, size));
+    return (data_upload(buf_p, size));
 }
 
 int upgrade_binary_upload_end()
 {
+#if CONFIG_UPGRADE_PIPELINE == 1
+    int res;
+#endif
+    uint8_t sha1[20];
+
+#if CONFIG_UPGRADE_PIPELINE == 1
+    res = pipeline_flush();
+
+    if (res != 0) {
+        return (res);
+    }
+#endif
+
+    /* Verify the data with the hash calculated during the upload,
+       so it does not have to be read back from the application
+       area. */
+    if (module.header_size == 0) {
+#if CONFIG_UPGRADE_DELTA == 1
+        if (module.delta.state != DELTA_STATE_COMMAND
+            || (module.delta.shift != 0)) {
+            log_object_print(NULL,
+                             LOG_ERROR,
+                             OSTR("truncated delta\r\n"));
+            return (-1);
+        }
+#endif
+
+        if (module.application_size != module.header.size) {
+            log_object_print(NULL,
+                             LOG_ERROR,
+                             OSTR("upgrade data size %lu does not match "
+                                  "header data size %lu\r\n"),
+                             (unsigned long)module.application_size,
+                             (unsigned long)module.header.size);
+            return (-1);
+        }
+
+        sha1_digest(&module.sha1, &sha1[0]);
+
+        if (memcmp(&sha1[0], &module.header.sha1[0], sizeof(sha1)) != 0) {
+            log_object_print(NULL,
+                             LOG_ERROR,
+                             OSTR("upgrade data sha1 mismatch\r\n"));
+            return (-1);
+        }
+    }
+
     return (upgrade_port_binary_upload_end());
 }
+
+int upgrade_binary_upload_get_progress(struct upgrade_binary_upload_progress_t *progress_p)
+{
+    ASSERTN(progress_p != NULL, EINVAL);
+
+    *progress_p = module.progress;
+
+    return (0);
+}
@@ -31,6 +31,20 @@
 
 #include "simba.h"
 
+/**
+ * Binary upload progress.
+ */
+struct upgrade_binary_upload_progress_t {
+    /** Number of data bytes in the binary, as given in its header, or
+        zero(0) until the header has been received. */
+    uint32_t size;
+    /** Number of received data bytes, not including the header. For
+        a delta binary this is the size of the received delta. */
+    uint32_t received;
+    /** Number of data bytes written to the application area. */
+    uint32_t written;
+};
+
 /**
  * Initialize the upgrade module. This function must be called before
  * calling any other function in this module.
@@ -103,14 +117,21 @@ int upgrade_application_erase(void);
 int upgrade_application_is_valid(int quick);
 
 /**
- * Begin an upload transaction of a .ubin file.
+ * Begin an upload transaction of a .ubin file. The file contains
+ * either an application, or a delta that is applied to the installed
+ * application while it is uploaded. Deltas are created by
+ * ``bin/upgrade.py --delta``.
  *
  * @return zero(0) or negative error code.
  */
 int upgrade_binary_upload_begin(void);
 
 /**
- * Add data to current upload transaction.
+ * Add data to current upload transaction. The data is buffered and
+ * written to the application area in the background if
+ * ``CONFIG_UPGRADE_PIPELINE`` is enabled, so a write error may be
+ * returned by a later call to this function or by
+ * `upgrade_binary_upload_end()`.
  *
  * @param[in] buf_p Buffer to write.
  * @param[in] size Size of the buffer.
@@ -121,10 +142,21 @@ int upgrade_binary_upload(const void *buf_p,
                           size_t size);
 
 /**
- * End current upload transaction.
+ * End current upload transaction. Waits for all data to be written
+ * and verifies the size and SHA1 of the data against the header. The
+ * SHA1 is calculated during the upload.
  *
  * @return zero(0) or negative error code.
  */
 int upgrade_binary_upload_end(void);
 
+/**
+ * Get the progress of the current, or latest, upload transaction.
+ *
+ * @param[out] progress_p Upload progress.
+ *
+ * @return zero(0) or negative error code.
+ */
+int upgrade_binary_upload_get_progress(struct upgrade_binary_upload_progress_t *progress_p);
+
 #endif
@@ -93,6 +93,7 @@ typedef intptr_t longptr_t;
 
 #include "kernel/time.h"
 
+#include "sync/contention.h"
 #include "sync/sem.h"
 
 #include "sync/chan.h"
@@ -121,7 +122,9 @@ typedef intptr_t longptr_t;
 #include "oam/service.h"
 #include "oam/nvm.h"
 
+#include "debug/bench.h"
 #include "debug/log.h"
+#include "debug/trace.h"
 
 #include "text/color.h"
 #include "text/re.h"
@@ -136,6 +139,7 @@ typedef intptr_t longptr_t;
 
 #include "hash/crc.h"
 #include "hash/sha1.h"
+#include "hash/sha256.h"
 
 #include "inet/types.h"
 #include "inet/inet.h"
@@ -188,6 +192,9 @@ typedef intptr_t longptr_t;
 #ifdef PORT_HAS_ANALOG_OUTPUT_PIN
 #    include "drivers/basic/analog_output_pin.h"
 #endif
+#if defined(PORT_HAS_CAN) || defined(PORT_HAS_MCP2515)
+#    include "drivers/network/can_filter.h"
+#endif
 #ifdef PORT_HAS_CAN
 #    include "drivers/network/can.h"
 #endif
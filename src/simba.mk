@@ -34,7 +34,7 @@ ifeq ($(TYPE),suite)
 
   ALLOC_SRC += heap.c
   COLLECTIONS_SRC += circular_buffer.c binary_tree.c list.c
-  DEBUG_SRC += log.c harness.c
+  DEBUG_SRC += log.c harness.c trace.c
   DRIVERS_SRC += storage/flash.c network/uart.c
   ENCODE_SRC +=
   HASH_SRC +=
@@ -45,7 +45,7 @@ ifeq ($(TYPE),suite)
   OAM_SRC += console.c settings.c nvm.c
   FILESYSTEMS_SRC += fs.c
   SPIFFS_SRC +=
-  SYNC_SRC += chan.c queue.c rwlock.c sem.c mutex.c bus.c event.c
+  SYNC_SRC += chan.c contention.c queue.c rwlock.c sem.c mutex.c bus.c event.c
   TEXT_SRC += std.c
   SCIENCE_SRC +=
 
@@ -105,8 +105,10 @@ COLLECTIONS_SRC ?= \
 SRC += $(COLLECTIONS_SRC:%=$(SIMBA_ROOT)/src/collections/%)
 
 # Debug package.
-DEBUG_SRC ?= log.c \
-	     harness.c
+DEBUG_SRC ?= bench.c \
+	     log.c \
+	     harness.c \
+	     trace.c
 
 SRC += $(DEBUG_SRC:%=$(SIMBA_ROOT)/src/debug/%)
 
@@ -131,6 +133,7 @@ DRIVERS_SRC ?= \
 	displays/led_7seg_ht16k33.c \
 	displays/ws2812.c \
 	network/can.c \
+	network/can_filter.c \
 	network/esp_wifi.c \
 	network/esp_wifi/station.c \
 	network/esp_wifi/softap.c \
@@ -182,7 +185,8 @@ SRC += $(ENCODE_SRC:%=$(SIMBA_ROOT)/src/encode/%)
 
 # Hash package.
 HASH_SRC ?= crc.c \
-	    sha1.c
+	    sha1.c \
+	    sha256.c
 
 SRC += $(HASH_SRC:%=$(SIMBA_ROOT)/src/hash/%)
 
@@ -407,6 +411,7 @@ SRC += $(SPIFFS_SRC:%=$(SIMBA_ROOT)/%)
 SYNC_SRC ?= bus.c \
 	    chan.c \
 	    cond.c \
+	    contention.c \
 	    event.c \
 	    mutex.c \
 	    queue.c \
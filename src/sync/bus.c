@@ -28,6 +28,44 @@
 
 #include "simba.h"
 
+/**
+ * Write given message to given listener.
+ *
+ * @return true(1) if the listener received the message, or false(0)
+ *         if it was dropped.
+ */
+static int write_listener(struct bus_listener_t *listener_p,
+                          const void *buf_p,
+                          size_t size)
+{
+    int res;
+
+    if (listener_p->policy == BUS_LISTENER_POLICY_DROP) {
+        /* Never wait for room in the queue. */
+        sys_lock();
+
+        if (queue_unused_size_isr(listener_p->chan_p) >= (ssize_t)size) {
+            res = (queue_write_isr(listener_p->chan_p, buf_p, size)
+                   == (ssize_t)size);
+        } else {
+            res = 0;
+        }
+
+        if (res == 0) {
+            listener_p->number_of_drops++;
+        }
+
+        sys_unlock();
+    } else {
+        ((struct chan_t *)listener_p->chan_p)->write(listener_p->chan_p,
+                                                     buf_p,
+                                                     size);
+        res = 1;
+    }
+
+    return (res);
+}
+
 int bus_module_init()
 {
     return (0);
@@ -53,11 +91,32 @@ int bus_listener_init(struct bus_listener_t *self_p,
     self_p->base.key = id;
     self_p->id = id;
     self_p->chan_p = chan_p;
+    self_p->policy = BUS_LISTENER_POLICY_BLOCK;
+    self_p->number_of_drops = 0;
     self_p->next_p = NULL;
 
     return (0);
 }
 
+int bus_listener_set_policy(struct bus_listener_t *self_p,
+                            int policy)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN((policy == BUS_LISTENER_POLICY_BLOCK)
+            || (policy == BUS_LISTENER_POLICY_DROP), EINVAL);
+
+    /* Messages are dropped based on the unused size of the queue. */
+    if ((policy == BUS_LISTENER_POLICY_DROP)
+        && (((struct chan_t *)self_p->chan_p)->write
+            != (chan_write_fn_t)queue_write)) {
+        return (-EINVAL);
+    }
+
+    self_p->policy = policy;
+
+    return (0);
+}
+
 int bus_attach(struct bus_t *self_p,
                struct bus_listener_t *listener_p)
 {
@@ -147,10 +206,7 @@ int bus_write(struct bus_t *self_p,
     number_of_receivers = 0;
 
     while (curr_p != NULL) {
-        ((struct chan_t *)curr_p->chan_p)->write(curr_p->chan_p,
-                                                 buf_p,
-                                                 size);
-        number_of_receivers++;
+        number_of_receivers += write_listener(curr_p, buf_p, size);
         curr_p = curr_p->next_p;
     }
 
@@ -158,3 +214,54 @@ int bus_write(struct bus_t *self_p,
 
     return (number_of_receivers);
 }
+
+int bus_write_shared(struct bus_t *self_p,
+                     int id,
+                     struct heap_t *heap_p,
+                     void *buf_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(heap_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+
+    int number_of_listeners;
+    int number_of_receivers;
+    struct bus_listener_t *head_p;
+    struct bus_listener_t *curr_p;
+
+    rwlock_reader_take(&self_p->rwlock);
+
+    head_p = (struct bus_listener_t *)binary_tree_search(
+        &self_p->listeners, id);
+
+    /* Share the message with all listeners before writing it to any
+       of them, as the first listener may free it right away. */
+    number_of_listeners = 0;
+    curr_p = head_p;
+
+    while (curr_p != NULL) {
+        number_of_listeners++;
+        curr_p = curr_p->next_p;
+    }
+
+    heap_share(heap_p, buf_p, number_of_listeners);
+    number_of_receivers = 0;
+    curr_p = head_p;
+
+    while (curr_p != NULL) {
+        if (write_listener(curr_p, &buf_p, sizeof(buf_p)) == 1) {
+            number_of_receivers++;
+        } else {
+            heap_free(heap_p, buf_p);
+        }
+
+        curr_p = curr_p->next_p;
+    }
+
+    rwlock_reader_give(&self_p->rwlock);
+
+    /* Give away the writer reference. */
+    heap_free(heap_p, buf_p);
+
+    return (number_of_receivers);
+}
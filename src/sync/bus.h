@@ -31,6 +31,12 @@
 
 #include "simba.h"
 
+/* Listener policies when its channel is full. */
+#define BUS_LISTENER_POLICY_BLOCK                           0
+#define BUS_LISTENER_POLICY_DROP                            1
+
+struct heap_t;
+
 struct bus_t {
     struct rwlock_t rwlock;
     struct binary_tree_t listeners;
@@ -40,6 +46,8 @@ struct bus_listener_t {
     struct binary_tree_node_t base;
     int id;
     void *chan_p;
+    int policy;
+    uint32_t number_of_drops;
     struct bus_listener_t *next_p;
 };
 
@@ -79,6 +87,26 @@ int bus_listener_init(struct bus_listener_t *self_p,
                       int id,
                       void *chan_p);
 
+/**
+ * Set what happens when a message is written to given listener with
+ * its channel full. By default the writer waits for room in the
+ * channel, that is, the slowest listener sets the pace for all
+ * others. A listener with the drop policy instead drops the message
+ * and increments its drop counter ``number_of_drops``. The writer
+ * never waits for it.
+ *
+ * The drop policy requires the listener channel to be a queue.
+ *
+ * @param[in] self_p Initialized listener.
+ * @param[in] policy ``BUS_LISTENER_POLICY_BLOCK`` or
+ *                   ``BUS_LISTENER_POLICY_DROP``.
+ *
+ * @return zero(0) or negative error code, -EINVAL if the drop policy
+ *         is requested for a listener whose channel is not a queue.
+ */
+int bus_listener_set_policy(struct bus_listener_t *self_p,
+                            int policy);
+
 /**
  * Attach given listener to given bus. Messages written to the bus
  * will be written to all listeners initialized with the written
@@ -115,11 +143,37 @@ int bus_detach(struct bus_t *self_p,
  * @param[in] size Number of bytes to write.
  *
  * @return Number of listeners that received the message, or negative
- *         error code.
+ *         error code. Listeners that dropped the message are not
+ *         counted.
  */
 int bus_write(struct bus_t *self_p,
               int id,
               const void *buf_p,
               size_t size);
 
+/**
+ * Write given message to given bus without copying it. The message
+ * must be allocated from given heap, and is shared once for each
+ * listener with given message id. Listeners receive a pointer to the
+ * message, that is, ``sizeof(void *)`` bytes, and must free it with
+ * `heap_free()` when done with it. The message is freed when the last
+ * listener frees it.
+ *
+ * The writer gives away its reference to the message, and must not
+ * access or free it after this call.
+ *
+ * @param[in] self_p Bus to write the message to.
+ * @param[in] id Message identity.
+ * @param[in] heap_p Heap the message was allocated from.
+ * @param[in] buf_p Message to write to the bus.
+ *
+ * @return Number of listeners that received the message, or negative
+ *         error code. Listeners that dropped the message are not
+ *         counted.
+ */
+int bus_write_shared(struct bus_t *self_p,
+                     int id,
+                     struct heap_t *heap_p,
+                     void *buf_p);
+
 #endif
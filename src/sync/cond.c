@@ -36,6 +36,7 @@ int cond_module_init()
 int cond_init(struct cond_t *self_p)
 {
     thrd_prio_list_init(&self_p->waiters);
+    CONTENTION_INIT(self_p);
 
     return (0);
 }
@@ -54,7 +55,9 @@ int cond_wait(struct cond_t *self_p,
     elem.thrd_p = thrd_self();
     thrd_prio_list_push_isr(&self_p->waiters, &elem);
 
+    CONTENTION_WAIT_BEGIN_ISR(self_p, NULL);
     res = thrd_suspend_isr(timeout_p);
+    CONTENTION_WAIT_END_ISR(self_p, res == 0);
 
     if (res == -ETIMEDOUT) {
         thrd_prio_list_remove_isr(&self_p->waiters, &elem);
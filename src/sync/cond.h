@@ -34,6 +34,9 @@
 struct cond_t {
     /** Wait list. */
     struct thrd_prio_list_t waiters;
+#if CONFIG_CONTENTION == 1
+    struct contention_t contention;
+#endif
 };
 
 /**
@@ -0,0 +1,351 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#if CONFIG_CONTENTION == 1
+
+struct module_t {
+    int8_t initialized;
+    /* Registered statistics. */
+    struct contention_t *list_p;
+#if CONFIG_CONTENTION_FS_COMMANDS == 1
+    struct fs_command_t cmd_list;
+    struct fs_command_t cmd_reset;
+#endif
+};
+
+static struct module_t module;
+
+static void clear(struct contention_t *self_p)
+{
+    self_p->acquisitions = 0;
+    self_p->contended = 0;
+    self_p->wait_time = 0;
+    self_p->max_wait_time = 0;
+    self_p->waiters = 0;
+    self_p->max_waiters = 0;
+    self_p->holder_p = NULL;
+}
+
+/**
+ * Returns true(1) if given left statistics are worse than given right
+ * statistics. Ties are broken by address to get a total order.
+ */
+static int is_worse(const struct contention_t *left_p,
+                    const struct contention_t *right_p)
+{
+    if (left_p->wait_time != right_p->wait_time) {
+        return (left_p->wait_time > right_p->wait_time);
+    }
+
+    if (left_p->contended != right_p->contended) {
+        return (left_p->contended > right_p->contended);
+    }
+
+    return (left_p < right_p);
+}
+
+#if CONFIG_CONTENTION_FS_COMMANDS == 1
+
+/**
+ * The shell command callback for "/sync/contention/list".
+ */
+static int cmd_list_cb(int argc,
+                       const char *argv[],
+                       void *out_p,
+                       void *in_p,
+                       void *arg_p,
+                       void *call_arg_p)
+{
+    long count;
+
+    if (argc > 2) {
+        std_fprintf(out_p, FSTR("Usage: list [<count>]\r\n"));
+
+        return (-EINVAL);
+    }
+
+    count = 10;
+
+    if (argc == 2) {
+        if ((std_strtol(argv[1], &count) == NULL) || (count < 0)) {
+            std_fprintf(out_p, FSTR("Usage: list [<count>]\r\n"));
+
+            return (-EINVAL);
+        }
+    }
+
+    return (contention_print(out_p, count));
+}
+
+/**
+ * The shell command callback for "/sync/contention/reset".
+ */
+static int cmd_reset_cb(int argc,
+                        const char *argv[],
+                        void *out_p,
+                        void *in_p,
+                        void *arg_p,
+                        void *call_arg_p)
+{
+    return (contention_reset());
+}
+
+#endif
+
+int contention_module_init()
+{
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+    module.list_p = NULL;
+
+#if CONFIG_CONTENTION_FS_COMMANDS == 1
+    fs_command_init(&module.cmd_list,
+                    CSTR("/sync/contention/list"),
+                    cmd_list_cb,
+                    NULL);
+    fs_command_register(&module.cmd_list);
+
+    fs_command_init(&module.cmd_reset,
+                    CSTR("/sync/contention/reset"),
+                    cmd_reset_cb,
+                    NULL);
+    fs_command_register(&module.cmd_reset);
+#endif
+
+    return (0);
+}
+
+int contention_init(struct contention_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    clear(self_p);
+
+    return (0);
+}
+
+int contention_register(struct contention_t *self_p, const char *name_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(name_p != NULL, EINVAL);
+
+    struct contention_t *registered_p;
+
+    sys_lock();
+
+    registered_p = module.list_p;
+
+    while ((registered_p != NULL) && (registered_p != self_p)) {
+        registered_p = registered_p->next_p;
+    }
+
+    /* Registering an object again only renames it. */
+    if (registered_p == NULL) {
+        self_p->next_p = module.list_p;
+        module.list_p = self_p;
+    }
+
+    self_p->name_p = name_p;
+
+    sys_unlock();
+
+    return (0);
+}
+
+int contention_deregister(struct contention_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    struct contention_t **registered_pp;
+    int res;
+
+    res = -ENOENT;
+
+    sys_lock();
+
+    registered_pp = &module.list_p;
+
+    while (*registered_pp != NULL) {
+        if (*registered_pp == self_p) {
+            *registered_pp = self_p->next_p;
+            self_p->next_p = NULL;
+            res = 0;
+            break;
+        }
+
+        registered_pp = &(*registered_pp)->next_p;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+int contention_reset()
+{
+    struct contention_t *self_p;
+    uint16_t waiters;
+
+    sys_lock();
+
+    self_p = module.list_p;
+
+    while (self_p != NULL) {
+        /* Threads may still be waiting. */
+        waiters = self_p->waiters;
+        clear(self_p);
+        self_p->waiters = waiters;
+        self_p->max_waiters = waiters;
+        self_p = self_p->next_p;
+    }
+
+    sys_unlock();
+
+    return (0);
+}
+
+int contention_print(void *chan_p, int count)
+{
+    ASSERTN(chan_p != NULL, EINVAL);
+
+    struct contention_t stats;
+    struct contention_t *self_p;
+    struct contention_t *worst_p;
+    struct contention_t *previous_p;
+    const char *holder_p;
+
+    std_fprintf(chan_p,
+                OSTR("                NAME ACQUISITIONS  CONTENDED"
+                     "    WAIT-US  MAX-WAIT-US  MAX-WAITERS  HOLDER\r\n"));
+
+    previous_p = NULL;
+
+    /* Find the worst object not yet printed, one at a time, to
+       avoid a temporary array. Objects updated while printing may
+       be listed out of order. */
+    while (count > 0) {
+        worst_p = NULL;
+
+        sys_lock();
+
+        self_p = module.list_p;
+
+        while (self_p != NULL) {
+            if ((previous_p == NULL) || is_worse(previous_p, self_p)) {
+                if ((worst_p == NULL) || is_worse(self_p, worst_p)) {
+                    worst_p = self_p;
+                }
+            }
+
+            self_p = self_p->next_p;
+        }
+
+        if (worst_p != NULL) {
+            stats = *worst_p;
+        }
+
+        sys_unlock();
+
+        if (worst_p == NULL) {
+            break;
+        }
+
+        if (stats.holder_p != NULL) {
+            holder_p = stats.holder_p->name_p;
+        } else {
+            holder_p = "-";
+        }
+
+        std_fprintf(chan_p,
+                    OSTR("%20s %12lu %10lu %10lu %12lu %12u  %s\r\n"),
+                    stats.name_p,
+                    (unsigned long)stats.acquisitions,
+                    (unsigned long)stats.contended,
+                    (unsigned long)stats.wait_time,
+                    (unsigned long)stats.max_wait_time,
+                    (unsigned int)stats.max_waiters,
+                    holder_p);
+
+        previous_p = worst_p;
+        count--;
+    }
+
+    return (0);
+}
+
+void contention_acquired_isr(struct contention_t *self_p)
+{
+    self_p->acquisitions++;
+}
+
+void contention_wait_begin_isr(struct contention_t *self_p,
+                               struct thrd_t *holder_p)
+{
+    self_p->contended++;
+    self_p->waiters++;
+
+    if (self_p->waiters > self_p->max_waiters) {
+        self_p->max_waiters = self_p->waiters;
+    }
+
+    if (holder_p != NULL) {
+        self_p->holder_p = holder_p;
+    }
+
+    thrd_self()->contention.wait_start = time_timestamp_isr();
+}
+
+void contention_wait_end_isr(struct contention_t *self_p,
+                             int acquired)
+{
+    uint32_t wait_time;
+
+    wait_time = (time_timestamp_isr() - thrd_self()->contention.wait_start);
+    self_p->wait_time += wait_time;
+
+    if (wait_time > self_p->max_wait_time) {
+        self_p->max_wait_time = wait_time;
+    }
+
+    if (self_p->waiters > 0) {
+        self_p->waiters--;
+    }
+
+    if (acquired == 1) {
+        self_p->acquisitions++;
+    }
+}
+
+#endif
@@ -0,0 +1,189 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#ifndef __SYNC_CONTENTION_H__
+#define __SYNC_CONTENTION_H__
+
+#include "simba.h"
+
+#if CONFIG_CONTENTION == 1
+/**
+ * Register given synchronization object, for example a mutex, with
+ * given name to list its contention statistics. Expands to nothing
+ * if contention profiling is disabled at compile time.
+ */
+#    define CONTENTION_REGISTER(object_p, name_p)               \
+    contention_register(&(object_p)->contention, name_p)
+
+/**
+ * Deregister given synchronization object, for example before it
+ * goes out of scope. Expands to nothing if contention profiling is
+ * disabled at compile time.
+ */
+#    define CONTENTION_DEREGISTER(object_p)                     \
+    contention_deregister(&(object_p)->contention)
+
+/* Hooks used by the synchronization primitives. */
+#    define CONTENTION_INIT(object_p)                           \
+    contention_init(&(object_p)->contention)
+#    define CONTENTION_ACQUIRED_ISR(object_p)                   \
+    contention_acquired_isr(&(object_p)->contention)
+#    define CONTENTION_WAIT_BEGIN_ISR(object_p, holder_p)       \
+    contention_wait_begin_isr(&(object_p)->contention, holder_p)
+#    define CONTENTION_WAIT_END_ISR(object_p, acquired)         \
+    contention_wait_end_isr(&(object_p)->contention, acquired)
+#else
+#    define CONTENTION_REGISTER(object_p, name_p)
+#    define CONTENTION_DEREGISTER(object_p)
+#    define CONTENTION_INIT(object_p)
+#    define CONTENTION_ACQUIRED_ISR(object_p)
+#    define CONTENTION_WAIT_BEGIN_ISR(object_p, holder_p)
+#    define CONTENTION_WAIT_END_ISR(object_p, acquired)
+#endif
+
+/**
+ * Contention statistics of a synchronization object. Embedded in
+ * mutexes, semaphores, read-write locks, condition variables and
+ * queues if contention profiling is enabled.
+ */
+struct contention_t {
+    /** Name given when registered. */
+    const char *name_p;
+    /** Number of successful acquisitions. */
+    uint32_t acquisitions;
+    /** Number of times a thread had to wait. */
+    uint32_t contended;
+    /** Total wait time in microseconds. */
+    uint64_t wait_time;
+    /** Longest wait time in microseconds. */
+    uint32_t max_wait_time;
+    /** Number of threads currently waiting. */
+    uint16_t waiters;
+    /** Largest number of threads waiting at the same time. */
+    uint16_t max_waiters;
+    /** The thread holding the object the last time a thread had to
+        wait, or NULL if unknown. Only known for mutexes. */
+    struct thrd_t *holder_p;
+    /** Next registered object. */
+    struct contention_t *next_p;
+};
+
+/**
+ * Initialize the contention module. This function must be called
+ * before calling any other function in this module.
+ *
+ * The module will only be initialized once even if this function is
+ * called multiple times.
+ *
+ * @return zero(0) or negative error code.
+ */
+int contention_module_init(void);
+
+/**
+ * Clear given contention statistics. Called by the synchronization
+ * primitives when initialized. The registration is kept.
+ *
+ * @param[in] self_p Statistics to clear.
+ *
+ * @return zero(0) or negative error code.
+ */
+int contention_init(struct contention_t *self_p);
+
+/**
+ * Register given statistics with given name. Only registered
+ * statistics are listed. Use `CONTENTION_REGISTER()` to register a
+ * synchronization object.
+ *
+ * @param[in] self_p Statistics to register.
+ * @param[in] name_p Name of the synchronization object.
+ *
+ * @return zero(0) or negative error code.
+ */
+int contention_register(struct contention_t *self_p, const char *name_p);
+
+/**
+ * Deregister given statistics, so they are no longer listed. Use
+ * `CONTENTION_DEREGISTER()` to deregister a synchronization object.
+ *
+ * @param[in] self_p Statistics to deregister.
+ *
+ * @return zero(0) or negative error code, -ENOENT if the statistics
+ *         are not registered.
+ */
+int contention_deregister(struct contention_t *self_p);
+
+/**
+ * Clear the statistics of all registered objects.
+ *
+ * @return zero(0) or negative error code.
+ */
+int contention_reset(void);
+
+/**
+ * Print the statistics of the registered objects with the longest
+ * total wait time, longest first.
+ *
+ * @param[in] chan_p Output channel.
+ * @param[in] count Maximum number of objects to print.
+ *
+ * @return zero(0) or negative error code.
+ */
+int contention_print(void *chan_p, int count);
+
+/**
+ * An acquisition without waiting. Must be called with the system lock
+ * taken.
+ *
+ * @param[in] self_p Statistics.
+ */
+void contention_acquired_isr(struct contention_t *self_p);
+
+/**
+ * The current thread is about to wait. The time the wait started is
+ * stored in the thread, as a thread waits for at most one object at a
+ * time. Must be called with the system lock taken.
+ *
+ * @param[in] self_p Statistics.
+ * @param[in] holder_p Thread holding the object, or NULL if unknown.
+ */
+void contention_wait_begin_isr(struct contention_t *self_p,
+                               struct thrd_t *holder_p);
+
+/**
+ * The current thread stopped waiting. Must be called with the system
+ * lock taken.
+ *
+ * @param[in] self_p Statistics.
+ * @param[in] acquired True(1) if the object was acquired, false(0) on
+ *                     timeout or error.
+ */
+void contention_wait_end_isr(struct contention_t *self_p,
+                             int acquired);
+
+#endif
@@ -28,6 +28,138 @@
 
 #include "simba.h"
 
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+
+/**
+ * Move given thread to its new position in the wait list of given
+ * mutex after a priority change.
+ */
+static void waiters_reorder_isr(struct mutex_t *self_p,
+                                struct thrd_t *thrd_p)
+{
+    struct thrd_prio_list_elem_t *elem_p;
+
+    elem_p = self_p->waiters.head_p;
+
+    while (elem_p != NULL) {
+        if (elem_p->thrd_p == thrd_p) {
+            thrd_prio_list_remove_isr(&self_p->waiters, elem_p);
+            thrd_prio_list_push_isr(&self_p->waiters, elem_p);
+            break;
+        }
+
+        elem_p = elem_p->next_p;
+    }
+}
+
+/**
+ * Let the owner of given mutex inherit given priority, if higher than
+ * its current priority. The priority is inherited transitively if the
+ * owner is waiting for another mutex.
+ */
+static void inherit_prio_isr(struct mutex_t *self_p, int prio)
+{
+    struct thrd_t *owner_p;
+
+    while (self_p != NULL) {
+        owner_p = self_p->owner_p;
+
+        if ((owner_p == NULL) || (owner_p->prio <= prio)) {
+            break;
+        }
+
+        thrd_set_prio_isr(owner_p, prio);
+        self_p = owner_p->mutex.waiting_for_p;
+
+        if (self_p != NULL) {
+            waiters_reorder_isr(self_p, owner_p);
+        }
+    }
+}
+
+/**
+ * Set the priority of given thread to the highest of its own priority
+ * and the priorities of the threads waiting for mutexes it owns.
+ */
+static void restore_prio_isr(struct thrd_t *thrd_p)
+{
+    struct mutex_t *mutex_p;
+    int prio;
+
+    prio = thrd_p->mutex.prio;
+    mutex_p = thrd_p->mutex.owned_p;
+
+    while (mutex_p != NULL) {
+        if (mutex_p->waiters.head_p != NULL) {
+            prio = MIN(prio, mutex_p->waiters.head_p->thrd_p->prio);
+        }
+
+        mutex_p = mutex_p->next_p;
+    }
+
+    if (prio != thrd_p->prio) {
+        thrd_set_prio_isr(thrd_p, prio);
+    }
+}
+
+static void owned_push_isr(struct mutex_t *self_p, struct thrd_t *thrd_p)
+{
+    /* Mutexes may be locked before the thread module is
+       initialized. */
+    if (thrd_p == NULL) {
+        return;
+    }
+
+    self_p->next_p = thrd_p->mutex.owned_p;
+    thrd_p->mutex.owned_p = self_p;
+}
+
+static void owned_remove_isr(struct mutex_t *self_p, struct thrd_t *thrd_p)
+{
+    struct mutex_t **mutex_pp;
+
+    mutex_pp = &thrd_p->mutex.owned_p;
+
+    while (*mutex_pp != NULL) {
+        if (*mutex_pp == self_p) {
+            *mutex_pp = self_p->next_p;
+            break;
+        }
+
+        mutex_pp = &(*mutex_pp)->next_p;
+    }
+
+    self_p->next_p = NULL;
+}
+
+#endif
+
+#if CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+
+/**
+ * Returns true(1) if given thread waiting for given mutex would never
+ * get it, that is, if the owner chain of the mutex leads back to the
+ * thread.
+ */
+static int is_deadlock_isr(struct mutex_t *self_p, struct thrd_t *thrd_p)
+{
+    while (self_p != NULL) {
+        if (self_p->owner_p == thrd_p) {
+            return (1);
+        }
+
+        if (self_p->owner_p == NULL) {
+            break;
+        }
+
+        self_p = self_p->owner_p->mutex.waiting_for_p;
+    }
+
+    return (0);
+}
+
+#endif
+
 int mutex_module_init(void)
 {
     return (0);
@@ -35,8 +167,27 @@ int mutex_module_init(void)
 
 int mutex_init(struct mutex_t *self_p)
 {
+    ASSERTN(self_p != NULL, EINVAL);
+
     self_p->is_locked = 0;
     thrd_prio_list_init(&self_p->waiters);
+    self_p->owner_p = NULL;
+    self_p->is_recursive = 0;
+    self_p->count = 0;
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+    self_p->next_p = NULL;
+#endif
+    CONTENTION_INIT(self_p);
+
+    return (0);
+}
+
+int mutex_init_recursive(struct mutex_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    mutex_init(self_p);
+    self_p->is_recursive = 1;
 
     return (0);
 }
@@ -66,13 +217,56 @@ int mutex_unlock(struct mutex_t *self_p)
 int mutex_lock_isr(struct mutex_t *self_p)
 {
     struct thrd_prio_list_elem_t elem;
+    struct thrd_t *thrd_p;
+
+    thrd_p = thrd_self();
 
     if (self_p->is_locked == 1) {
-        elem.thrd_p = thrd_self();
+        if (self_p->owner_p == thrd_p) {
+            if (self_p->is_recursive == 1) {
+                if (self_p->count == 255) {
+                    return (-EAGAIN);
+                }
+
+                self_p->count++;
+
+                return (0);
+            }
+
+#if CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+            return (-EDEADLK);
+#endif
+        }
+
+#if CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+        if (is_deadlock_isr(self_p, thrd_p)) {
+            return (-EDEADLK);
+        }
+#endif
+
+        elem.thrd_p = thrd_p;
         thrd_prio_list_push_isr(&self_p->waiters, &elem);
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1 || CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+        thrd_p->mutex.waiting_for_p = self_p;
+#endif
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+        inherit_prio_isr(self_p, thrd_p->prio);
+#endif
+        TRACE_ISR(TRACE_EVENT_MUTEX_LOCK_WAIT, 0, self_p);
+        CONTENTION_WAIT_BEGIN_ISR(self_p, self_p->owner_p);
+
+        /* The unlocking thread makes this thread the owner. */
         thrd_suspend_isr(NULL);
+        CONTENTION_WAIT_END_ISR(self_p, 1);
+        TRACE_ISR(TRACE_EVENT_MUTEX_LOCK_DONE, 0, self_p);
     } else {
         self_p->is_locked = 1;
+        self_p->owner_p = thrd_p;
+        self_p->count = 1;
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+        owned_push_isr(self_p, thrd_p);
+#endif
+        CONTENTION_ACQUIRED_ISR(self_p);
     }
 
     return (0);
@@ -81,14 +275,82 @@ int mutex_lock_isr(struct mutex_t *self_p)
 int mutex_unlock_isr(struct mutex_t *self_p)
 {
     struct thrd_prio_list_elem_t *elem_p;
+    struct thrd_t *thrd_p;
+
+#if CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+    if ((self_p->is_locked == 0)
+        || ((self_p->owner_p != NULL) && (self_p->owner_p != thrd_self()))) {
+        return (-EPERM);
+    }
+#endif
+
+    if (self_p->is_recursive == 1) {
+        if (self_p->count > 1) {
+            self_p->count--;
+
+            return (0);
+        }
+    }
+
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+    if (self_p->owner_p != NULL) {
+        owned_remove_isr(self_p, self_p->owner_p);
+        restore_prio_isr(self_p->owner_p);
+    }
+#endif
 
     elem_p = thrd_prio_list_pop_isr(&self_p->waiters);
 
     if (elem_p != NULL) {
-        thrd_resume_isr(elem_p->thrd_p, 0);
+        /* Hand over the mutex to the most important waiter. */
+        thrd_p = elem_p->thrd_p;
+        self_p->owner_p = thrd_p;
+        self_p->count = 1;
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1 || CONFIG_MUTEX_DEADLOCK_DETECTION == 1
+        thrd_p->mutex.waiting_for_p = NULL;
+#endif
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+        owned_push_isr(self_p, thrd_p);
+        restore_prio_isr(thrd_p);
+#endif
+        thrd_resume_isr(thrd_p, 0);
     } else {
         self_p->is_locked = 0;
+        self_p->owner_p = NULL;
+        self_p->count = 0;
     }
 
     return (0);
 }
+
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+
+void mutex_set_thrd_prio_isr(struct thrd_t *thrd_p, int prio)
+{
+    struct mutex_t *mutex_p;
+    int old_prio;
+
+    thrd_p->mutex.prio = prio;
+
+    /* Propagate the change along the chain of mutex owners, as long
+       as the priority of the next owner changes. */
+    while (thrd_p != NULL) {
+        old_prio = thrd_p->prio;
+        restore_prio_isr(thrd_p);
+
+        if (thrd_p->prio == old_prio) {
+            break;
+        }
+
+        mutex_p = thrd_p->mutex.waiting_for_p;
+
+        if (mutex_p == NULL) {
+            break;
+        }
+
+        waiters_reorder_isr(mutex_p, thrd_p);
+        thrd_p = mutex_p->owner_p;
+    }
+}
+
+#endif
@@ -36,6 +36,19 @@ struct mutex_t {
     int8_t is_locked;
     /** Wait list. */
     struct thrd_prio_list_t waiters;
+    /** Owner thread, or NULL if the mutex is unlocked. */
+    struct thrd_t *owner_p;
+    /** True(1) if the owner may lock the mutex again. */
+    int8_t is_recursive;
+    /** Number of times the owner has locked the mutex. */
+    uint8_t count;
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+    /** Next mutex owned by the same thread. */
+    struct mutex_t *next_p;
+#endif
+#if CONFIG_CONTENTION == 1
+    struct contention_t contention;
+#endif
 };
 
 /**
@@ -59,20 +72,38 @@ int mutex_module_init(void);
 int mutex_init(struct mutex_t *self_p);
 
 /**
- * Lock given mutex.
+ * Initialize given recursive mutex object. A recursive mutex may be
+ * locked multiple times by its owner, and is unlocked when
+ * `mutex_unlock()` has been called the same number of times.
  *
- * @param[in] self_p Mutex to lock.
+ * @param[in] self_p Mutex to initialize.
  *
  * @return zero(0) or negative error code.
  */
+int mutex_init_recursive(struct mutex_t *self_p);
+
+/**
+ * Lock given mutex. The owner of the mutex inherits the priority of
+ * the calling thread while it is waiting, if higher, and so does the
+ * owner of any mutex the owner is waiting for.
+ *
+ * @param[in] self_p Mutex to lock.
+ *
+ * @return zero(0) or negative error code. -EDEADLK is returned if
+ *         deadlock detection is enabled and the lock would never be
+ *         acquired.
+ */
 int mutex_lock(struct mutex_t *self_p);
 
 /**
- * Unlock given mutex.
+ * Unlock given mutex. An inherited priority of the calling thread is
+ * restored.
  *
  * @param[in] self_p Mutex to unlock.
  *
- * @return zero(0) or negative error code.
+ * @return zero(0) or negative error code. -EPERM is returned if
+ *         deadlock detection is enabled and the calling thread does
+ *         not own the mutex.
  */
 int mutex_unlock(struct mutex_t *self_p);
 
@@ -94,4 +125,22 @@ int mutex_lock_isr(struct mutex_t *self_p);
  */
 int mutex_unlock_isr(struct mutex_t *self_p);
 
+#if CONFIG_MUTEX_PRIORITY_INHERITANCE == 1
+
+/**
+ * Set the priority of given thread, not counting inherited
+ * priorities, with the system lock taken. The scheduling priority
+ * is the highest of given priority and the priorities of the threads
+ * waiting for mutexes owned by given thread. If given thread is
+ * waiting for a mutex, it is moved to its new position among the
+ * waiters, and the new priority is propagated to the owner of the
+ * mutex. Called by `thrd_set_prio()`.
+ *
+ * @param[in] thrd_p Thread to set the priority for.
+ * @param[in] prio Priority.
+ */
+void mutex_set_thrd_prio_isr(struct thrd_t *thrd_p, int prio);
+
+#endif
+
 #endif
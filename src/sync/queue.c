@@ -96,6 +96,7 @@ int queue_init(struct queue_t *self_p,
 
     self_p->state = QUEUE_STATE_INITIALIZED;
     self_p->flags = 0;
+    CONTENTION_INIT(self_p);
 
     return (0);
 }
@@ -209,8 +210,14 @@ ssize_t queue_read(struct queue_t *self_p, void *buf_p, size_t size)
             self_p->reader.size = size;
             self_p->reader.left = left;
 
+            TRACE_ISR(TRACE_EVENT_QUEUE_READ_WAIT, 0, self_p);
+            CONTENTION_WAIT_BEGIN_ISR(self_p, NULL);
             size = thrd_suspend_isr(NULL);
+            CONTENTION_WAIT_END_ISR(self_p, size >= 0);
+            TRACE_ISR(TRACE_EVENT_QUEUE_READ_DONE, 0, self_p);
         }
+    } else {
+        CONTENTION_ACQUIRED_ISR(self_p);
     }
 
     sys_unlock();
@@ -255,7 +262,13 @@ ssize_t queue_write(struct queue_t *self_p,
                                         (struct thrd_prio_list_elem_t *)&elem);
             }
 
+            TRACE_ISR(TRACE_EVENT_QUEUE_WRITE_WAIT, 0, self_p);
+            CONTENTION_WAIT_BEGIN_ISR(self_p, NULL);
             res = thrd_suspend_isr(NULL);
+            CONTENTION_WAIT_END_ISR(self_p, res >= 0);
+            TRACE_ISR(TRACE_EVENT_QUEUE_WRITE_DONE, 0, self_p);
+        } else {
+            CONTENTION_ACQUIRED_ISR(self_p);
         }
     }
 
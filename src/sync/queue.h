@@ -88,6 +88,9 @@ struct queue_t {
     struct circular_buffer_t buffer;
     enum queue_state_t state;
     int flags;
+#if CONFIG_CONTENTION == 1
+    struct contention_t contention;
+#endif
 };
 
 /**
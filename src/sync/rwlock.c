@@ -47,6 +47,7 @@ int rwlock_init(struct rwlock_t *self_p)
     self_p->number_of_writers = 0;
     self_p->readers_p = NULL;
     self_p->writers_p = NULL;
+    CONTENTION_INIT(self_p);
 
     return (0);
 }
@@ -69,7 +70,11 @@ int rwlock_reader_take(struct rwlock_t *self_p)
         elem.prev_p = NULL;
         self_p->readers_p = &elem;
 
+        CONTENTION_WAIT_BEGIN_ISR(self_p, NULL);
         thrd_suspend_isr(NULL);
+        CONTENTION_WAIT_END_ISR(self_p, 1);
+    } else {
+        CONTENTION_ACQUIRED_ISR(self_p);
     }
 
     sys_unlock();
@@ -130,7 +135,11 @@ int rwlock_writer_take(struct rwlock_t *self_p)
         elem.prev_p = NULL;
         self_p->writers_p = &elem;
 
+        CONTENTION_WAIT_BEGIN_ISR(self_p, NULL);
         thrd_suspend_isr(NULL);
+        CONTENTION_WAIT_END_ISR(self_p, 1);
+    } else {
+        CONTENTION_ACQUIRED_ISR(self_p);
     }
 
     sys_unlock();
@@ -36,6 +36,9 @@ struct rwlock_t {
     int number_of_writers;
     volatile struct rwlock_elem_t *readers_p;
     volatile struct rwlock_elem_t *writers_p;
+#if CONFIG_CONTENTION == 1
+    struct contention_t contention;
+#endif
 };
 
 /**
@@ -45,6 +45,7 @@ int sem_init(struct sem_t *self_p,
     self_p->count_max = count_max;
 
     thrd_prio_list_init(&self_p->waiters);
+    CONTENTION_INIT(self_p);
 
     return (0);
 }
@@ -62,13 +63,18 @@ int sem_take(struct sem_t *self_p,
     if (self_p->count == self_p->count_max) {
         elem.thrd_p = thrd_self();
         thrd_prio_list_push_isr(&self_p->waiters, &elem);
+        TRACE_ISR(TRACE_EVENT_SEM_TAKE_WAIT, 0, self_p);
+        CONTENTION_WAIT_BEGIN_ISR(self_p, NULL);
         err = thrd_suspend_isr(timeout_p);
+        CONTENTION_WAIT_END_ISR(self_p, err == 0);
+        TRACE_ISR(TRACE_EVENT_SEM_TAKE_DONE, -err, self_p);
 
         if (err == -ETIMEDOUT) {
             thrd_prio_list_remove_isr(&self_p->waiters, &elem);
         }
     } else {
         self_p->count++;
+        CONTENTION_ACQUIRED_ISR(self_p);
     }
 
     sys_unlock();
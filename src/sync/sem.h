@@ -53,6 +53,9 @@ struct sem_t {
     int count_max;
     /** Wait list. */
     struct thrd_prio_list_t waiters;
+#if CONFIG_CONTENTION == 1
+    struct contention_t contention;
+#endif
 };
 
 /**
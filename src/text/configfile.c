@@ -28,11 +28,77 @@
 
 #include "simba.h"
 
+#define LINE_TYPE_OTHER                                     0
+#define LINE_TYPE_SECTION                                   1
+#define LINE_TYPE_PROPERTY                                  2
+
+struct line_t {
+    int type;
+    char *begin_p;
+    char *name_p;
+    size_t name_length;
+};
+
 /**
- * Ignore one line.
+ * Parse the line starting at given position. Any carriage returns at
+ * the beginning of the line are ignored.
+ *
+ * @return Beginning of the next line, or NULL if the line is not
+ *         terminated by a newline.
  */
-static char *ignore_line(char *buf_p)
+static char *parse_line(char *buf_p, struct line_t *line_p)
 {
+    /* A line may start with "\r". */
+    while (*buf_p == '\r') {
+        buf_p++;
+    }
+
+    line_p->type = LINE_TYPE_OTHER;
+    line_p->begin_p = buf_p;
+    line_p->name_p = buf_p;
+
+    if (*buf_p == '[') {
+        /* Section header. The name is all characters until ']'. */
+        buf_p++;
+        line_p->name_p = buf_p;
+
+        while ((*buf_p != ']')
+               && (*buf_p != '\r')
+               && (*buf_p != '\n')
+               && (*buf_p != '\0')) {
+            buf_p++;
+        }
+
+        line_p->type = LINE_TYPE_SECTION;
+    } else if ((*buf_p != '#') && (*buf_p != ';')) {
+        /* Property, empty line or garbage. */
+        while ((*buf_p != ' ')
+               && (*buf_p != '\t')
+               && (*buf_p != ':')
+               && (*buf_p != '=')
+               && (*buf_p != '\r')
+               && (*buf_p != '\n')
+               && (*buf_p != '\0')) {
+            buf_p++;
+        }
+
+        line_p->name_length = (buf_p - line_p->name_p);
+
+        while ((*buf_p == ' ') || (*buf_p == '\t')) {
+            buf_p++;
+        }
+
+        if ((line_p->name_length > 0)
+            && ((*buf_p == ':') || (*buf_p == '='))) {
+            line_p->type = LINE_TYPE_PROPERTY;
+        }
+    }
+
+    if (line_p->type == LINE_TYPE_SECTION) {
+        line_p->name_length = (buf_p - line_p->name_p);
+    }
+
+    /* Find the end of the line. */
     while (*buf_p != '\n') {
         if (*buf_p == '\0') {
             return (NULL);
@@ -41,66 +107,419 @@ static char *ignore_line(char *buf_p)
         buf_p++;
     }
 
-    return (buf_p);
+    return (buf_p + 1);
 }
 
 /**
- * Parse and ignore a line comment.
+ * @return true(1) if given line has given name, otherwise false(0).
  */
-static char *ignore_comment(char *buf_p)
+static int is_name(struct line_t *line_p,
+                   const char *name_p,
+                   size_t name_length)
 {
-    return (ignore_line(buf_p));
+    return ((line_p->name_length == name_length)
+            && (memcmp(line_p->name_p, name_p, name_length) == 0));
+}
+
+/**
+ * FNV-1a hash of given section and property names.
+ */
+static uint32_t hash_names(const char *section_p,
+                           size_t section_length,
+                           const char *property_p,
+                           size_t property_length)
+{
+    uint32_t hash;
+    size_t i;
+
+    hash = 2166136261UL;
+
+    for (i = 0; i < section_length; i++) {
+        hash ^= (uint8_t)section_p[i];
+        hash *= 16777619UL;
+    }
+
+    /* Separate the section from the property. */
+    hash *= 16777619UL;
+
+    for (i = 0; i < property_length; i++) {
+        hash ^= (uint8_t)property_p[i];
+        hash *= 16777619UL;
+    }
+
+    return (hash);
 }
 
 /**
- * Ignore wrong property.
+ * Add given property to the index. An index entry with zero property
+ * offset is unused, as a property is always preceded by a section
+ * header.
  */
-static char *ignore_wrong_property(char *buf_p)
+static int index_add(struct configfile_t *self_p,
+                     uint32_t hash,
+                     size_t section,
+                     size_t property)
 {
-    return (ignore_line(buf_p));
+    struct configfile_index_entry_t *entry_p;
+    size_t i;
+
+    /* Keep at least one unused entry to terminate lookups. */
+    if (self_p->index.count + 1 >= self_p->index.length) {
+        return (-ENOMEM);
+    }
+
+    i = (hash % self_p->index.length);
+
+    while (self_p->index.entries_p[i].property != 0) {
+        i = ((i + 1) % self_p->index.length);
+    }
+
+    entry_p = &self_p->index.entries_p[i];
+    entry_p->hash = hash;
+    entry_p->section = section;
+    entry_p->property = property;
+    self_p->index.count++;
+
+    return (0);
 }
 
 /**
- * Parse given section header.
+ * Find given property using the index. Linear probing keeps
+ * duplicated properties in file order, so the first one is found.
+ *
+ * @return Beginning of the property line, or NULL if missing.
  */
-static char *parse_section_header(char *buf_p,
-                                  const char *section_p,
-                                  int section_length,
-                                  int *in_correct_section_p)
+static char *index_find(struct configfile_t *self_p,
+                        const char *section_p,
+                        const char *property_p)
 {
-    char *name_p;
-    int name_length;
-    int section_end_found;
+    struct configfile_index_entry_t *entry_p;
+    struct line_t line;
+    size_t section_length;
+    size_t property_length;
+    uint32_t hash;
+    size_t i;
 
-    buf_p++;
-    name_p = buf_p;
-    name_length = 0;
-    section_end_found = 0;
+    section_length = strlen(section_p);
+    property_length = strlen(property_p);
+    hash = hash_names(section_p, section_length, property_p, property_length);
+    i = (hash % self_p->index.length);
 
-    while (*buf_p != '\n') {
-        if (*buf_p == '\0') {
-            return (NULL);
+    while (self_p->index.entries_p[i].property != 0) {
+        entry_p = &self_p->index.entries_p[i];
+
+        if (entry_p->hash == hash) {
+            parse_line(&self_p->buf_p[entry_p->section], &line);
+
+            if (is_name(&line, section_p, section_length)) {
+                parse_line(&self_p->buf_p[entry_p->property], &line);
+
+                if (is_name(&line, property_p, property_length)) {
+                    return (line.begin_p);
+                }
+            }
         }
 
-        /* Ignore any carriage return and ']'. */
-        if (*buf_p == ']') {
-            section_end_found = 1;
+        i = ((i + 1) % self_p->index.length);
+    }
+
+    return (NULL);
+}
+
+/**
+ * Find given property by scanning the whole buffer.
+ *
+ * @return Beginning of the property line, or NULL if missing.
+ */
+static char *scan_find(struct configfile_t *self_p,
+                       const char *section_p,
+                       const char *property_p)
+{
+    struct line_t line;
+    size_t section_length;
+    size_t property_length;
+    int in_correct_section;
+    char *buf_p;
+
+    section_length = strlen(section_p);
+    property_length = strlen(property_p);
+    in_correct_section = 0;
+    buf_p = self_p->buf_p;
+
+    while (*buf_p != '\0') {
+        buf_p = parse_line(buf_p, &line);
+
+        if (buf_p == NULL) {
+            break;
         }
 
-        if (*buf_p != '\r') {
-            if (section_end_found == 0) {
-                name_length++;
+        if (line.type == LINE_TYPE_SECTION) {
+            in_correct_section = is_name(&line, section_p, section_length);
+        } else if ((line.type == LINE_TYPE_PROPERTY)
+                   && (in_correct_section == 1)
+                   && is_name(&line, property_p, property_length)) {
+            return (line.begin_p);
+        }
+    }
+
+    return (NULL);
+}
+
+static char *find_property(struct configfile_t *self_p,
+                           const char *section_p,
+                           const char *property_p)
+{
+    if (self_p->index.entries_p != NULL) {
+        return (index_find(self_p, section_p, property_p));
+    } else {
+        return (scan_find(self_p, section_p, property_p));
+    }
+}
+
+/**
+ * Replace given number of characters at given offset in the buffer
+ * with given number of new characters, moving the rest of the
+ * contents. Index entries after the replaced characters are moved as
+ * well.
+ *
+ * @return zero(0) or negative error code.
+ */
+static int replace(struct configfile_t *self_p,
+                   size_t offset,
+                   size_t old_size,
+                   size_t new_size)
+{
+    struct configfile_index_entry_t *entry_p;
+    size_t length;
+    size_t i;
+
+    length = strlen(self_p->buf_p);
+
+    if (length - old_size + new_size >= self_p->size) {
+        return (-ENOMEM);
+    }
+
+    /* Move the rest of the contents, including the null
+       termination. */
+    memmove(&self_p->buf_p[offset + new_size],
+            &self_p->buf_p[offset + old_size],
+            length - offset - old_size + 1);
+
+    for (i = 0; i < self_p->index.length; i++) {
+        entry_p = &self_p->index.entries_p[i];
+
+        if (entry_p->property == 0) {
+            continue;
+        }
+
+        if (entry_p->section >= offset + old_size) {
+            entry_p->section += (new_size - old_size);
+        }
+
+        if (entry_p->property >= offset + old_size) {
+            entry_p->property += (new_size - old_size);
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * Replace the value of the property line beginning at given
+ * position.
+ */
+static int set_value(struct configfile_t *self_p,
+                     char *line_p,
+                     size_t property_length,
+                     const char *value_p)
+{
+    char *begin_p;
+    char *end_p;
+    size_t value_length;
+    int res;
+
+    /* Skip the property name, the ':' and surrounding whitespaces. */
+    begin_p = (line_p + property_length);
+
+    while ((*begin_p == ' ') || (*begin_p == '\t')) {
+        begin_p++;
+    }
+
+    begin_p++;
+
+    while ((*begin_p == ' ') || (*begin_p == '\t')) {
+        begin_p++;
+    }
+
+    /* The value ends at the line termination. */
+    end_p = begin_p;
+
+    while ((*end_p != '\r') && (*end_p != '\n')) {
+        end_p++;
+    }
+
+    value_length = strlen(value_p);
+    res = replace(self_p,
+                  begin_p - self_p->buf_p,
+                  end_p - begin_p,
+                  value_length);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    memcpy(begin_p, value_p, value_length);
+
+    return (0);
+}
+
+/**
+ * Add a new property to given section, or a new section last in the
+ * buffer if missing.
+ */
+static int add_property(struct configfile_t *self_p,
+                        const char *section_p,
+                        const char *property_p,
+                        const char *value_p)
+{
+    struct line_t line;
+    char *buf_p;
+    char *next_p;
+    char *insert_p;
+    char *section_header_p;
+    char *unterminated_p;
+    size_t section_length;
+    size_t property_length;
+    size_t value_length;
+    size_t size;
+    size_t offset;
+    size_t section;
+    int newline;
+    int res;
+
+    section_length = strlen(section_p);
+    property_length = strlen(property_p);
+    value_length = strlen(value_p);
+    section_header_p = NULL;
+    unterminated_p = NULL;
+    insert_p = NULL;
+    buf_p = self_p->buf_p;
+
+    /* Insert the property last in the section, that is, before the
+       next section header. */
+    while (*buf_p != '\0') {
+        next_p = parse_line(buf_p, &line);
+
+        if (line.type == LINE_TYPE_SECTION) {
+            if (section_header_p != NULL) {
+                insert_p = buf_p;
+                break;
+            }
+
+            if (is_name(&line, section_p, section_length)) {
+                section_header_p = line.begin_p;
             }
         }
 
-        buf_p++;
+        if (next_p == NULL) {
+            /* The property may be on the unterminated last line. */
+            if ((section_header_p != NULL)
+                && (line.type == LINE_TYPE_PROPERTY)
+                && is_name(&line, property_p, property_length)) {
+                unterminated_p = line.begin_p;
+            }
+
+            break;
+        }
+
+        buf_p = next_p;
+    }
+
+    if (insert_p == NULL) {
+        insert_p = &self_p->buf_p[strlen(self_p->buf_p)];
+    }
+
+    /* Terminate an unterminated last line. */
+    newline = ((insert_p > self_p->buf_p) && (insert_p[-1] != '\n'));
+
+    if ((self_p->index.entries_p != NULL)
+        && (self_p->index.count + 1 >= self_p->index.length)) {
+        return (-ENOMEM);
+    }
+
+    if (unterminated_p != NULL) {
+        offset = (insert_p - self_p->buf_p);
+        res = replace(self_p, offset, 0, 2);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        memcpy(&self_p->buf_p[offset], "\r\n", 2);
+
+        if (self_p->index.entries_p != NULL) {
+            index_add(self_p,
+                      hash_names(section_p,
+                                 section_length,
+                                 property_p,
+                                 property_length),
+                      section_header_p - self_p->buf_p,
+                      unterminated_p - self_p->buf_p);
+        }
+
+        return (set_value(self_p, unterminated_p, property_length, value_p));
+    }
+
+    size = (2 * newline + property_length + value_length + 4);
+
+    if (section_header_p == NULL) {
+        size += (section_length + 4);
     }
 
-    /* Is it the section we are looking for? */
-    *in_correct_section_p = ((section_length == name_length)
-                             && (strncmp(section_p, name_p, name_length) == 0));
+    offset = (insert_p - self_p->buf_p);
+    res = replace(self_p, offset, 0, size);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    buf_p = insert_p;
+
+    if (newline == 1) {
+        memcpy(buf_p, "\r\n", 2);
+        buf_p += 2;
+    }
 
-    return (buf_p);
+    if (section_header_p == NULL) {
+        section = (buf_p - self_p->buf_p);
+        *buf_p++ = '[';
+        memcpy(buf_p, section_p, section_length);
+        buf_p += section_length;
+        memcpy(buf_p, "]\r\n", 3);
+        buf_p += 3;
+    } else {
+        section = (section_header_p - self_p->buf_p);
+    }
+
+    if (self_p->index.entries_p != NULL) {
+        index_add(self_p,
+                  hash_names(section_p,
+                             section_length,
+                             property_p,
+                             property_length),
+                  section,
+                  buf_p - self_p->buf_p);
+    }
+
+    memcpy(buf_p, property_p, property_length);
+    buf_p += property_length;
+    memcpy(buf_p, ": ", 2);
+    buf_p += 2;
+    memcpy(buf_p, value_p, value_length);
+    buf_p += value_length;
+    memcpy(buf_p, "\r\n", 2);
+
+    return (0);
 }
 
 static char *parse_property(char *buf_p,
@@ -162,6 +581,16 @@ static char *parse_property(char *buf_p,
     return (std_strip(value_p, NULL));
 }
 
+
+/**
+ * @return true(1) if given name contains none of given characters,
+ *         otherwise false(0).
+ */
+static int is_valid_name(const char *name_p, const char *chars_p)
+{
+    return ((*name_p != '\0') && (strpbrk(name_p, chars_p) == NULL));
+}
+
 int configfile_init(struct configfile_t *self_p,
                     char *buf_p,
                     size_t size)
@@ -172,6 +601,62 @@ int configfile_init(struct configfile_t *self_p,
 
     self_p->buf_p = buf_p;
     self_p->size = size;
+    self_p->index.entries_p = NULL;
+    self_p->index.length = 0;
+    self_p->index.count = 0;
+
+    return (0);
+}
+
+int configfile_index(struct configfile_t *self_p,
+                     struct configfile_index_entry_t *entries_p,
+                     size_t length)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(entries_p != NULL, EINVAL);
+    ASSERTN(length > 0, EINVAL);
+
+    struct line_t line;
+    struct line_t section;
+    char *buf_p;
+    int res;
+
+    memset(entries_p, 0, sizeof(*entries_p) * length);
+    self_p->index.entries_p = entries_p;
+    self_p->index.length = length;
+    self_p->index.count = 0;
+    section.type = LINE_TYPE_OTHER;
+    buf_p = self_p->buf_p;
+
+    /* Add all properties in sections in one pass. */
+    while (*buf_p != '\0') {
+        buf_p = parse_line(buf_p, &line);
+
+        if (buf_p == NULL) {
+            break;
+        }
+
+        if (line.type == LINE_TYPE_SECTION) {
+            section = line;
+        } else if ((line.type == LINE_TYPE_PROPERTY)
+                   && (section.type == LINE_TYPE_SECTION)) {
+            res = index_add(self_p,
+                            hash_names(section.name_p,
+                                       section.name_length,
+                                       line.name_p,
+                                       line.name_length),
+                            section.begin_p - self_p->buf_p,
+                            line.begin_p - self_p->buf_p);
+
+            if (res != 0) {
+                self_p->index.entries_p = NULL;
+                self_p->index.length = 0;
+                self_p->index.count = 0;
+
+                return (res);
+            }
+        }
+    }
 
     return (0);
 }
@@ -181,7 +666,26 @@ int configfile_set(struct configfile_t *self_p,
                    const char *property_p,
                    const char *value_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(section_p != NULL, EINVAL);
+    ASSERTN(property_p != NULL, EINVAL);
+    ASSERTN(value_p != NULL, EINVAL);
+
+    char *line_p;
+
+    if (!is_valid_name(section_p, "]\r\n")
+        || !is_valid_name(property_p, " \t:=\r\n#;[")
+        || (strpbrk(value_p, "\r\n") != NULL)) {
+        return (-EINVAL);
+    }
+
+    line_p = find_property(self_p, section_p, property_p);
+
+    if (line_p != NULL) {
+        return (set_value(self_p, line_p, strlen(property_p), value_p));
+    } else {
+        return (add_property(self_p, section_p, property_p, value_p));
+    }
 }
 
 char *configfile_get(struct configfile_t *self_p,
@@ -196,48 +700,15 @@ char *configfile_get(struct configfile_t *self_p,
     ASSERTNRN(value_p != NULL, EINVAL);
     ASSERTNRN(length > 0, EINVAL);
 
-    int in_correct_section;
-    int section_length;
-    int property_length;
-    char *buf_p;
+    char *line_p;
 
-    in_correct_section = 0;
-    buf_p = self_p->buf_p;
-    section_length = strlen(section_p);
-    property_length = strlen(property_p);
-
-    while (*buf_p != '\0') {
-        if (*buf_p == '\r') {
-            /* A line my start with "\r". */
-        } else if ((*buf_p == '#') || (*buf_p == ';')) {
-            buf_p = ignore_comment(buf_p);
-        } else if (*buf_p == '[') {
-            buf_p = parse_section_header(buf_p,
-                                         section_p,
-                                         section_length,
-                                         &in_correct_section);
-        } else if (in_correct_section == 0) {
-            buf_p = ignore_line(buf_p);
-        } else {
-            /* Property or empty line.*/
-            if (strncmp(property_p, buf_p, property_length) == 0) {
-                return (parse_property(buf_p,
-                                       value_p,
-                                       length,
-                                       property_length));
-            } else {
-                buf_p = ignore_wrong_property(buf_p);
-            }
-        }
+    line_p = find_property(self_p, section_p, property_p);
 
-        if (buf_p == NULL) {
-            return (buf_p);
-        }
-
-        buf_p++;
+    if (line_p == NULL) {
+        return (NULL);
     }
 
-    return (NULL);
+    return (parse_property(line_p, value_p, length, strlen(property_p)));
 }
 
 int configfile_get_long(struct configfile_t *self_p,
@@ -31,9 +31,25 @@
 
 #include "simba.h"
 
+/**
+ * A property in the configuration file index. The index is a hash
+ * table of properties, addressed by a hash of the section and
+ * property names.
+ */
+struct configfile_index_entry_t {
+    uint32_t hash;
+    size_t section;
+    size_t property;
+};
+
 struct configfile_t {
     char *buf_p;
     size_t size;
+    struct {
+        struct configfile_index_entry_t *entries_p;
+        size_t length;
+        size_t count;
+    } index;
 };
 
 /**
@@ -42,7 +58,8 @@ struct configfile_t {
  * @param[in,out] self_p Object to initialize.
  * @param[in] buf_p Configuration file contents as a NULL terminated
  *                  string.
- * @param[in] size Size of the configuration file contents.
+ * @param[in] size Size of the buffer. `configfile_set()` may grow the
+ *                 contents up to one less than this size.
  *
  * @return zero(0) or negative error code.
  */
@@ -51,14 +68,43 @@ int configfile_init(struct configfile_t *self_p,
                     size_t size);
 
 /**
- * Set the value of given property in given section.
+ * Index all properties in given configuration file in one pass over
+ * its contents. Without an index every lookup scans the whole file,
+ * while with one it is a hash table lookup. The index is kept up to
+ * date by `configfile_set()`.
+ *
+ * Only properties in sections on newline terminated lines are
+ * indexed, as they are the only ones that can be found.
+ *
+ * @param[in] self_p Initialized parser.
+ * @param[in] entries_p Index entries. It must be bigger than the
+ *                      number of properties in the file, preferably
+ *                      by 25% or more, and also fit properties later
+ *                      added with `configfile_set()`.
+ * @param[in] length Number of index entries.
+ *
+ * @return zero(0), -ENOMEM if there are too many properties, or
+ *         other negative error code.
+ */
+int configfile_index(struct configfile_t *self_p,
+                     struct configfile_index_entry_t *entries_p,
+                     size_t length);
+
+/**
+ * Set the value of given property in given section. The value of an
+ * existing property is replaced in place, moving the rest of the
+ * file if the length of the value changes. A missing property is
+ * added last in its section, and a missing section is added last in
+ * the file.
  *
  * @param[in] self_p Initialized parser.
  * @param[in] section_p Section to set the property from.
  * @param[in] property_p Property to set the value for.
  * @param[in] value_p NULL terminated value to set.
  *
- * @return zero(0) or negative error code.
+ * @return zero(0), -ENOMEM if the buffer or index is full, -EINVAL
+ *         if a name or the value contains characters not allowed, or
+ *         other negative error code.
  */
 int configfile_set(struct configfile_t *self_p,
                    const char *section_p,
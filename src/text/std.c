@@ -31,8 +31,13 @@
 #include <limits.h>
 #include <math.h>
 
-/* +7 for floating point decimal point and fraction. */
-#define VALUE_BUF_MAX (3 * sizeof(long) + 7)
+#if (CONFIG_STD_WORD_SCAN == 1) && defined(__SSE2__)
+#    include <emmintrin.h>
+#endif
+
+/* +12 for floating point sign, decimal point and fraction, or
+   exponent. */
+#define VALUE_BUF_MAX (3 * sizeof(long) + 12)
 
 struct buffered_output_t {
     void *chan_p;
@@ -47,62 +52,312 @@ struct snprintf_output_t {
     size_t size_max;
 };
 
+/* Two decimal digits per entry. */
+static FAR const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static FAR const char hex_digits[] = "0123456789abcdef";
+
+#if CONFIG_FLOAT == 1
+
+static FAR const unsigned long powers_of_ten[] = {
+    1UL,
+    10UL,
+    100UL,
+    1000UL,
+    10000UL,
+    100000UL,
+    1000000UL,
+    10000000UL,
+    100000000UL,
+    1000000000UL
+};
+
+#endif
+
+/**
+ * @return true(1) if the character is one of given characters,
+ *         otherwise false(0).
+ */
+static int char_in_chars(uint8_t c, const char *chars_p, size_t length)
+{
+    while (length > 0) {
+        if (c == (uint8_t)*chars_p++) {
+            return (1);
+        }
+
+        length--;
+    }
+
+    return (0);
+}
+
+/**
+ * Scan given buffer for the first byte that is accepted, or not
+ * accepted, given by `match`. Returns the offset of that byte, or
+ * `size` if not found.
+ */
+static size_t scan_bytes(const uint8_t *buf_p,
+                         size_t size,
+                         const char *chars_p,
+                         size_t length,
+                         int match)
+{
+    size_t pos;
+
+    for (pos = 0; pos < size; pos++) {
+        if (char_in_chars(buf_p[pos], chars_p, length) == match) {
+            break;
+        }
+    }
+
+    return (pos);
+}
+
+#if CONFIG_STD_WORD_SCAN == 1
+
+/* Words may alias any buffer. */
+typedef unsigned long __attribute__((__may_alias__)) word_t;
+
+#define WORD_ONES ((unsigned long)-1 / 0xff)
+#define WORD_LOWS (WORD_ONES * 0x7f)
+#define WORD_HIGHS (WORD_ONES * 0x80)
+
 /**
- * @return true(1) if the character is part of the string, otherwise
- *         false(0).
+ * Returns a word with the most significant bit set in each byte of
+ * given word that equals any of given characters.
  */
-static int char_in_string(char c, const char *str_p)
+static inline unsigned long word_match(unsigned long word,
+                                       const char *chars_p,
+                                       size_t length)
 {
-    while (*str_p != '\0') {
-        if (c == *str_p) {
+    unsigned long matches;
+    unsigned long value;
+    size_t i;
+
+    matches = 0;
+
+    for (i = 0; i < length; i++) {
+        /* Bytes equal to the character are zero after the xor. */
+        value = (word ^ (WORD_ONES * (uint8_t)chars_p[i]));
+        matches |= ~(((value & WORD_LOWS) + WORD_LOWS) | value | WORD_LOWS);
+    }
+
+    return (matches);
+}
+
+/**
+ * Returns the offset of the first byte in memory order with its most
+ * significant bit set in given non-zero mask.
+ */
+static inline size_t word_first_byte(unsigned long mask)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return (__builtin_clzl(mask) / CHAR_BIT);
+#else
+    return (__builtin_ctzl(mask) / CHAR_BIT);
+#endif
+}
+
+#endif
+
+#if CONFIG_STD_WORD_SCAN == 1 && defined(__SSE2__)
+
+/**
+ * Scan 16 bytes per iteration, starting at given position. The
+ * position is updated to the first matching byte, or the first byte
+ * not scanned.
+ *
+ * @return true(1) if a matching byte was found, otherwise false(0).
+ */
+static int scan_sse2(const uint8_t *buf_p,
+                     size_t size,
+                     const char *chars_p,
+                     size_t length,
+                     int match,
+                     size_t *pos_p)
+{
+    __m128i data;
+    __m128i matches;
+    unsigned int mask;
+    size_t i;
+
+    while (*pos_p + 16 <= size) {
+        data = _mm_loadu_si128((const __m128i *)&buf_p[*pos_p]);
+        matches = _mm_setzero_si128();
+
+        for (i = 0; i < length; i++) {
+            matches = _mm_or_si128(matches,
+                                   _mm_cmpeq_epi8(data,
+                                                  _mm_set1_epi8(chars_p[i])));
+        }
+
+        mask = _mm_movemask_epi8(matches);
+
+        if (match == 0) {
+            mask ^= 0xffff;
+        }
+
+        if (mask != 0) {
+            *pos_p += __builtin_ctz(mask);
+
+            return (1);
+        }
+
+        *pos_p += 16;
+    }
+
+    return (0);
+}
+
+#endif
+
+#if CONFIG_STD_WORD_SCAN == 1
+
+/**
+ * Scan one aligned machine word per iteration, starting at given
+ * position. The position is updated to the first matching byte, or
+ * the first byte not scanned.
+ *
+ * @return true(1) if a matching byte was found, otherwise false(0).
+ */
+static int scan_words(const uint8_t *buf_p,
+                      size_t size,
+                      const char *chars_p,
+                      size_t length,
+                      int match,
+                      size_t *pos_p)
+{
+    const word_t *word_p;
+    unsigned long mask;
+    size_t head;
+    size_t pos;
+
+    pos = *pos_p;
+
+    /* Bytes until the first word boundary. */
+    head = (-(uintptr_t)&buf_p[pos] & (sizeof(*word_p) - 1));
+
+    if (head > size - pos) {
+        head = (size - pos);
+    }
+
+    *pos_p += scan_bytes(&buf_p[pos], head, chars_p, length, match);
+
+    if (*pos_p < pos + head) {
+        return (1);
+    }
+
+    word_p = (const word_t *)&buf_p[*pos_p];
+
+    while (*pos_p + sizeof(*word_p) <= size) {
+        mask = word_match(*word_p, chars_p, length);
+
+        if (match == 0) {
+            mask ^= WORD_HIGHS;
+        }
+
+        if (mask != 0) {
+            *pos_p += word_first_byte(mask);
+
             return (1);
         }
 
-        str_p++;
+        *pos_p += sizeof(*word_p);
+        word_p++;
     }
 
     return (0);
 }
 
+#endif
+
+static size_t scan(const void *buf_p,
+                   size_t size,
+                   const char *chars_p,
+                   size_t length,
+                   int match)
+{
+    const uint8_t *u8_p;
+    size_t pos;
+
+    u8_p = buf_p;
+    pos = 0;
+
+#if CONFIG_STD_WORD_SCAN == 1
+#    if defined(__SSE2__)
+    if (scan_sse2(u8_p, size, chars_p, length, match, &pos) == 1) {
+        return (pos);
+    }
+#    endif
+
+    if (scan_words(u8_p, size, chars_p, length, match, &pos) == 1) {
+        return (pos);
+    }
+#endif
+
+    return (pos + scan_bytes(&u8_p[pos], size - pos, chars_p, length, match));
+}
+
 /**
- * Put characters to buffer.
+ * Write characters to buffer.
  */
-static void sprintf_putc(char c, void *arg_p)
+static void sprintf_write(const char *buf_p, size_t size, void *arg_p)
 {
     char **dst_pp = arg_p;
 
-    *(*dst_pp)++ = c;
+    memcpy(*dst_pp, buf_p, size);
+    *dst_pp += size;
 }
 
 /**
- * Put characters to buffer.
+ * Write characters to buffer, but not more than fits in it.
  */
-static void snprintf_putc(char c, void *arg_p)
+static void snprintf_write(const char *buf_p, size_t size, void *arg_p)
 {
     struct snprintf_output_t *output_p;
 
     output_p = arg_p;
 
     if (output_p->size < output_p->size_max) {
-        output_p->dst_p[output_p->size] = c;
+        memcpy(&output_p->dst_p[output_p->size],
+               buf_p,
+               MIN(size, output_p->size_max - output_p->size));
     }
 
-    output_p->size++;
+    output_p->size += size;
 }
 
 /**
- * Put characters to standard output.
+ * Write characters to standard output.
  */
-static void fprintf_putc(char c, void *arg_p)
+static void fprintf_write(const char *buf_p, size_t size, void *arg_p)
 {
     struct buffered_output_t *output_p = arg_p;
+    size_t n;
 
-    output_p->buffer[output_p->pos++] = c;
-    output_p->size++;
+    output_p->size += size;
 
-    if (output_p->pos == membersof(output_p->buffer)) {
-        chan_write(output_p->chan_p, output_p->buffer, output_p->pos);
-        output_p->pos = 0;
+    while (size > 0) {
+        n = MIN(size, membersof(output_p->buffer) - output_p->pos);
+        memcpy(&output_p->buffer[output_p->pos], buf_p, n);
+        output_p->pos += n;
+        buf_p += n;
+        size -= n;
+
+        if (output_p->pos == membersof(output_p->buffer)) {
+            chan_write(output_p->chan_p, output_p->buffer, output_p->pos);
+            output_p->pos = 0;
+        }
     }
 }
 
@@ -118,19 +373,27 @@ static void output_flush(struct buffered_output_t *output_p)
 }
 
 /**
- * Put characters to standard output from interrupt context or with
+ * Write characters to standard output from interrupt context or with
  * the system lock taken.
  */
-static void fprintf_putc_isr(char c, void *arg_p)
+static void fprintf_write_isr(const char *buf_p, size_t size, void *arg_p)
 {
     struct buffered_output_t *output_p = arg_p;
+    size_t n;
 
-    output_p->buffer[output_p->pos++] = c;
-    output_p->size++;
+    output_p->size += size;
 
-    if (output_p->pos == membersof(output_p->buffer)) {
-        chan_write_isr(output_p->chan_p, output_p->buffer, output_p->pos);
-        output_p->pos = 0;
+    while (size > 0) {
+        n = MIN(size, membersof(output_p->buffer) - output_p->pos);
+        memcpy(&output_p->buffer[output_p->pos], buf_p, n);
+        output_p->pos += n;
+        buf_p += n;
+        size -= n;
+
+        if (output_p->pos == membersof(output_p->buffer)) {
+            chan_write_isr(output_p->chan_p, output_p->buffer, output_p->pos);
+            output_p->pos = 0;
+        }
     }
 }
 
@@ -145,43 +408,142 @@ static void output_flush_isr(struct buffered_output_t *output_p)
     }
 }
 
-static void formats(void (*std_putc)(char c, void *arg_p),
+/**
+ * Write given number of given character.
+ */
+static void write_fill(void (*std_write)(const char *buf_p,
+                                         size_t size,
+                                         void *arg_p),
+                       void *arg_p,
+                       char c,
+                       int count)
+{
+    char buf[8];
+    int size;
+
+    if (count <= 0) {
+        return;
+    }
+
+    memset(&buf[0], c, sizeof(buf));
+
+    while (count > 0) {
+        size = MIN(count, (int)sizeof(buf));
+        std_write(&buf[0], size, arg_p);
+        count -= size;
+    }
+}
+
+/**
+ * Write given span of a far string, for example a literal segment of
+ * the format string.
+ */
+static void write_far(void (*std_write)(const char *buf_p,
+                                        size_t size,
+                                        void *arg_p),
+                      void *arg_p,
+                      far_string_t str_p,
+                      size_t size)
+{
+#if defined(FAR_SPECIAL_ADDRESS)
+    char buf[16];
+    size_t n;
+    size_t i;
+
+    while (size > 0) {
+        n = MIN(size, sizeof(buf));
+
+        for (i = 0; i < n; i++) {
+            buf[i] = *str_p++;
+        }
+
+        std_write(&buf[0], n, arg_p);
+        size -= n;
+    }
+#else
+    std_write(str_p, size, arg_p);
+#endif
+}
+
+static void formats(void (*std_write)(const char *buf_p,
+                                      size_t size,
+                                      void *arg_p),
                     void *arg_p,
-                    char *str_p,
+                    const char *str_p,
+                    size_t size,
                     char flags,
                     int width,
                     char negative_sign)
 {
-    char *s_p = str_p;
-
-    while (*s_p++ != '\0') {
-        width--;
-    }
+    width -= size;
 
     /* Right justification. */
     if (flags != '-') {
         if ((negative_sign == 1) && (flags == '0')) {
-            std_putc(*str_p++, arg_p);
+            std_write(str_p, 1, arg_p);
+            str_p++;
+            size--;
         }
 
-        while (width > 0) {
-            std_putc(flags, arg_p);
-            width--;
-        }
+        write_fill(std_write, arg_p, flags, width);
     }
 
     /* Number */
-    while (*str_p != '\0') {
-        std_putc(*str_p++, arg_p);
-    }
+    std_write(str_p, size, arg_p);
 
     /* Left justification. */
-    while (width > 0) {
-        std_putc(' ', arg_p);
-        width--;
+    if (flags == '-') {
+        write_fill(std_write, arg_p, ' ', width);
     }
 }
 
+/**
+ * Write given value in decimal, right to left ending at given
+ * position. Two digits are converted per division.
+ *
+ * @return Position of the first digit.
+ */
+static char *format_decimal(char *str_p, unsigned long value)
+{
+    unsigned long quotient;
+    int pair;
+
+    while (value >= 100) {
+        quotient = (value / 100);
+        pair = (2 * (value - 100 * quotient));
+        value = quotient;
+        *--str_p = digit_pairs[pair + 1];
+        *--str_p = digit_pairs[pair];
+    }
+
+    if (value >= 10) {
+        *--str_p = digit_pairs[2 * value + 1];
+        *--str_p = digit_pairs[2 * value];
+    } else {
+        *--str_p = ('0' + value);
+    }
+
+    return (str_p);
+}
+
+/**
+ * Write given value as exactly given number of decimal digits, with
+ * leading zeros.
+ */
+static char *format_digits(char *str_p, unsigned long value, int digits)
+{
+    char *begin_p;
+
+    begin_p = (str_p - digits);
+    str_p = format_decimal(str_p, value);
+
+    while (str_p > begin_p) {
+        *--str_p = '0';
+    }
+
+    return (str_p);
+}
+
 static char *formati(char c,
                      char *str_p,
                      char radix,
@@ -190,7 +552,6 @@ static char *formati(char c,
                      char *negative_sign_p)
 {
     unsigned long value;
-    char digit;
 
     /* Get argument. */
     if (length == 0) {
@@ -211,14 +572,14 @@ static char *formati(char c,
     }
 
     /* Format number into buffer. */
-    do {
-        digit = (char)(value % radix);
-        value /= radix;
-        if (digit > 9) {
-            digit += 39;
-        }
-        *--str_p = ('0' + digit);
-    } while (value > 0);
+    if (radix == 16) {
+        do {
+            *--str_p = hex_digits[value & 0xf];
+            value >>= 4;
+        } while (value > 0);
+    } else {
+        str_p = format_decimal(str_p, value);
+    }
 
     if (*negative_sign_p == 1) {
         *--str_p = '-';
@@ -229,21 +590,12 @@ static char *formati(char c,
 
 #if CONFIG_FLOAT == 1
 
-static char *formatf(char c,
-                     char *str_p,
-                     va_list *ap_p,
-                     char length,
-                     char *negative_sign_p)
+/**
+ * Returns the absolute value of given value, and sets the negative
+ * sign flag if it is negative.
+ */
+static double float_abs(double value, char *negative_sign_p)
 {
-    double value;
-    unsigned long whole_number;
-    unsigned long fraction_number;
-    int i;
-
-    /* Get argument. */
-    value = va_arg(*ap_p, double);
-
-    /* Convert a negative value a to positive. */
 #if defined(ARCH_ESP)
     /* This will not work in all cases when the number is close to
      * zero. */
@@ -258,24 +610,270 @@ static char *formatf(char c,
     }
 #endif
 
+    return (value);
+}
+
+/**
+ * Write "nan" or "inf" if given value is not finite.
+ *
+ * @return Position of the first character, or NULL if the value is
+ *         finite.
+ */
+static char *format_not_finite(char *str_p,
+                               double value,
+                               char negative_sign)
+{
+    const char *word_p;
+
+    if (isnan(value)) {
+        word_p = "nan";
+    } else if (isinf(value)) {
+        word_p = "inf";
+    } else {
+        return (NULL);
+    }
+
+    str_p -= 3;
+    memcpy(str_p, word_p, 3);
+
+    if (negative_sign == 1) {
+        *--str_p = '-';
+    }
+
+    return (str_p);
+}
+
+/**
+ * Round given non-negative value to the nearest integer, ties to
+ * even.
+ */
+static unsigned long round_even(double value)
+{
+    unsigned long integer;
+    double remainder;
+
+    integer = (unsigned long)value;
+    remainder = (value - integer);
+
+    if ((remainder > 0.5) || ((remainder == 0.5) && (integer & 1))) {
+        integer++;
+    }
+
+    return (integer);
+}
+
+static char *formatf(char *str_p,
+                     va_list *ap_p,
+                     int precision,
+                     char *negative_sign_p)
+{
+    double value;
+    char *not_finite_p;
+    unsigned long whole_number;
+    unsigned long fraction_number;
+
+    /* Get argument. */
+    value = float_abs(va_arg(*ap_p, double), negative_sign_p);
+    not_finite_p = format_not_finite(str_p, value, *negative_sign_p);
+
+    if (not_finite_p != NULL) {
+        return (not_finite_p);
+    }
+
+    if (precision < 0) {
+        precision = 6;
+    }
+
     /* Values bigger than 'unsigned long max' are not supported. */
     whole_number = (unsigned long)value;
-    /* Always print 6 decimal places. */
-    fraction_number = (unsigned long)((value - whole_number) * 1000000.0);
+    fraction_number = round_even((value - whole_number) * powers_of_ten[precision]);
 
-    /* Write fraction number to output buffer. */
-    for (i = 0; i < 6; i++) {
-        *--str_p = '0' + (fraction_number % 10);
-        fraction_number /= 10;
+    /* The fraction was rounded up to the next whole number. */
+    if (fraction_number == powers_of_ten[precision]) {
+        whole_number++;
+        fraction_number = 0;
     }
 
-    /* Write the decimal dot. */
-    *--str_p = '.';
+    if (precision > 0) {
+        str_p = format_digits(str_p, fraction_number, precision);
+        *--str_p = '.';
+    }
+
+    str_p = format_decimal(str_p, whole_number);
 
-    /* Write whole number to output buffer. */
-    while (whole_number != 0) {
-        *--str_p = '0' + (whole_number % 10);
-        whole_number /= 10;
+    /* Add negative sign if the number is negative. */
+    if (*negative_sign_p == 1) {
+        *--str_p = '-';
+    }
+
+    return (str_p);
+}
+
+/**
+ * Returns given value multiplied by ten to the power of given
+ * exponent. Powers up to 10^22 are exact in double precision.
+ */
+static double scale10(double value, int exponent)
+{
+    double power;
+    int i;
+
+    power = 1.0;
+
+    for (i = 0; i < abs(exponent); i++) {
+        power *= 10.0;
+
+        /* Apply the power before it overflows a single precision
+           float. */
+        if (power > 1e30) {
+            value = ((exponent < 0) ? value / power : value * power);
+            power = 1.0;
+        }
+    }
+
+    return ((exponent < 0) ? value / power : value * power);
+}
+
+/**
+ * Round given positive value to given number of significant decimal
+ * digits.
+ *
+ * @return The digits as an integer. The decimal exponent of the first
+ *         digit is written to given exponent pointer.
+ */
+static unsigned long round_digits(double value, int digits, int *exponent_p)
+{
+    unsigned long mantissa;
+    double power;
+    int exponent;
+
+    /* Estimate the exponent. It is corrected below if off by one. */
+    exponent = 0;
+    power = 1.0;
+
+    if (value >= 1.0) {
+        while (value >= 10.0 * power) {
+            power *= 10.0;
+            exponent++;
+        }
+    } else {
+        while ((value < power) && (exponent > -400)) {
+            power /= 10.0;
+            exponent--;
+        }
+    }
+
+    while (1) {
+        mantissa = round_even(scale10(value, digits - 1 - exponent));
+
+        if (mantissa >= powers_of_ten[digits]) {
+            /* Rounded up to one more digit, for example 9.96 to 10.0. */
+            mantissa /= 10;
+            exponent++;
+            break;
+        } else if ((mantissa < powers_of_ten[digits - 1])
+                   && (exponent > -400)) {
+            exponent--;
+        } else {
+            break;
+        }
+    }
+
+    *exponent_p = exponent;
+
+    return (mantissa);
+}
+
+static char *formatg(char *str_p,
+                     va_list *ap_p,
+                     int precision,
+                     char *negative_sign_p)
+{
+    double value;
+    char *not_finite_p;
+    unsigned long mantissa;
+    int exponent;
+    int digits;
+    int point;
+    int i;
+
+    /* Get argument. */
+    value = float_abs(va_arg(*ap_p, double), negative_sign_p);
+    not_finite_p = format_not_finite(str_p, value, *negative_sign_p);
+
+    if (not_finite_p != NULL) {
+        return (not_finite_p);
+    }
+
+    if (value == 0.0) {
+        mantissa = 0;
+        exponent = 0;
+        digits = 1;
+    } else if (precision < 0) {
+        /* Find the shortest digits that read back as the same single
+           precision float. Nine digits always do. */
+        for (digits = 1; digits < 9; digits++) {
+            mantissa = round_digits(value, digits, &exponent);
+
+            if ((float)scale10(mantissa, exponent - digits + 1)
+                == (float)value) {
+                break;
+            }
+        }
+
+        mantissa = round_digits(value, digits, &exponent);
+    } else {
+        digits = MAX(precision, 1);
+        mantissa = round_digits(value, digits, &exponent);
+    }
+
+    /* Remove trailing zeros. */
+    while ((digits > 1) && (mantissa % 10 == 0)) {
+        mantissa /= 10;
+        digits--;
+    }
+
+    if (precision < 0) {
+        precision = 9;
+    }
+
+    /* Write the exponent, or zeros after the digits, and find the
+       position of the decimal point. */
+    if ((exponent < -4) || (exponent >= MAX(precision, 1))) {
+        str_p = format_digits(str_p,
+                              abs(exponent),
+                              (abs(exponent) >= 100) ? 3 : 2);
+        *--str_p = ((exponent < 0) ? '-' : '+');
+        *--str_p = 'e';
+        point = 1;
+    } else if (exponent >= 0) {
+        for (i = digits; i <= exponent; i++) {
+            *--str_p = '0';
+        }
+
+        point = (exponent + 1);
+    } else {
+        point = 0;
+    }
+
+    /* Write the digits. */
+    for (i = digits; i > 0; i--) {
+        if ((i == point) && (point < digits)) {
+            *--str_p = '.';
+        }
+
+        *--str_p = ('0' + mantissa % 10);
+        mantissa /= 10;
+    }
+
+    /* Fractions less than one. */
+    if (point == 0) {
+        for (i = 1; i < -exponent; i++) {
+            *--str_p = '0';
+        }
+
+        *--str_p = '.';
+        *--str_p = '0';
     }
 
     /* Add negative sign if the number is negative. */
@@ -288,23 +886,38 @@ static char *formatf(char c,
 
 #endif
 
-static void vcprintf(void (*std_putc)(char c, void *arg_p),
+static void vcprintf(void (*std_write)(const char *buf_p,
+                                       size_t size,
+                                       void *arg_p),
                      void *arg_p,
                      far_string_t fmt_p,
                      va_list *ap_p)
 {
     char c, flags, length, negative_sign, buf[VALUE_BUF_MAX], *s_p;
+    far_string_t span_p;
     int width;
+    int precision;
+    size_t size;
 
-    buf[sizeof(buf) - 1] = '\0';
+    while (1) {
+        /* Copy literal text up to next specifier in one write. */
+        span_p = fmt_p;
 
-    while ((c = *fmt_p++) != '\0') {
-        if (c != '%') {
-            std_putc(c, arg_p);
-            continue;
+        while (((c = *fmt_p) != '\0') && (c != '%')) {
+            fmt_p++;
         }
 
-        /* Prototype: %[flags][width][length]specifier  */
+        if (fmt_p > span_p) {
+            write_far(std_write, arg_p, span_p, fmt_p - span_p);
+        }
+
+        if (c == '\0') {
+            break;
+        }
+
+        fmt_p++;
+
+        /* Prototype: %[flags][width][.precision][length]specifier  */
 
         /* Parse the flags. */
         flags = ' ';
@@ -324,6 +937,29 @@ static void vcprintf(void (*std_putc)(char c, void *arg_p),
             c = *fmt_p++;
         }
 
+        /* Parse the precision. */
+        precision = -1;
+
+        if (c == '.') {
+            precision = 0;
+            c = *fmt_p++;
+
+            if (c == '*') {
+                precision = va_arg(*ap_p, int);
+                c = *fmt_p++;
+
+                if (precision < 0) {
+                    precision = -1;
+                }
+            }
+
+            while ((c >= '0') && (c <= '9')) {
+                precision *= 10;
+                precision += (c - '0');
+                c = *fmt_p++;
+            }
+        }
+
         /* Parse the length. */
         length = 0;
 
@@ -352,21 +988,19 @@ static void vcprintf(void (*std_putc)(char c, void *arg_p),
                     far_string_p = FSTR("(null)");
                 }
 
-                s_p = &buf[sizeof(buf) - 1];
-                width -= std_strlen(far_string_p);
+                size = std_strlen(far_string_p);
+                width -= size;
 
                 /* Right justification. */
                 if (flags != '-') {
-                    formats(std_putc, arg_p, s_p, flags, width, negative_sign);
+                    write_fill(std_write, arg_p, flags, width);
                 }
 
-                while (*far_string_p != '\0') {
-                    std_putc(*far_string_p++, arg_p);
-                }
+                write_far(std_write, arg_p, far_string_p, size);
 
                 /* Left justification. */
                 if (flags == '-') {
-                    formats(std_putc, arg_p, s_p, flags, width, negative_sign);
+                    write_fill(std_write, arg_p, ' ', width);
                 }
             }
 
@@ -380,35 +1014,62 @@ static void vcprintf(void (*std_putc)(char c, void *arg_p),
                 s_p = "(null)";
             }
 
-            break;
+            if (precision < 0) {
+                size = strlen(s_p);
+            } else {
+                for (size = 0; size < (size_t)precision; size++) {
+                    if (s_p[size] == '\0') {
+                        break;
+                    }
+                }
+            }
+
+            formats(std_write, arg_p, s_p, size, flags, width, negative_sign);
+            continue;
 
         case 'c':
-            buf[sizeof(buf) - 2] = (char)va_arg(*ap_p, int);
-            s_p = &buf[sizeof(buf) - 2];
+            buf[sizeof(buf) - 1] = (char)va_arg(*ap_p, int);
+            s_p = &buf[sizeof(buf) - 1];
             break;
 
         case 'i':
         case 'd':
         case 'u':
-            s_p = formati(c, &buf[sizeof(buf) - 1], 10, ap_p, length, &negative_sign);
+            s_p = formati(c, &buf[sizeof(buf)], 10, ap_p, length, &negative_sign);
             break;
 
         case 'x':
-            s_p = formati(c, &buf[sizeof(buf) - 1], 16, ap_p, length, &negative_sign);
+            s_p = formati(c, &buf[sizeof(buf)], 16, ap_p, length, &negative_sign);
             break;
 
 #if CONFIG_FLOAT == 1
         case 'f':
-            s_p = formatf(c, &buf[sizeof(buf) - 1], ap_p, length, &negative_sign);
+            s_p = formatf(&buf[sizeof(buf)],
+                          ap_p,
+                          MIN(precision, 9),
+                          &negative_sign);
+            break;
+
+        case 'g':
+            s_p = formatg(&buf[sizeof(buf)],
+                          ap_p,
+                          MIN(precision, 9),
+                          &negative_sign);
             break;
 #endif
 
         default:
-            std_putc(c, arg_p);
+            std_write(&c, 1, arg_p);
             continue;
         }
 
-        formats(std_putc, arg_p, s_p, flags, width, negative_sign);
+        formats(std_write,
+                arg_p,
+                s_p,
+                &buf[sizeof(buf)] - s_p,
+                flags,
+                width,
+                negative_sign);
     }
 }
 
@@ -417,7 +1078,7 @@ static void cvcprintf(struct buffered_output_t *output_p,
                       va_list *ap_p)
 {
     chan_control(output_p->chan_p, CHAN_CONTROL_PRINTF_BEGIN);
-    vcprintf(fprintf_putc, output_p, fmt_p, ap_p);
+    vcprintf(fprintf_write, output_p, fmt_p, ap_p);
     output_flush(output_p);
     chan_control(output_p->chan_p, CHAN_CONTROL_PRINTF_END);
 }
@@ -480,8 +1141,8 @@ ssize_t std_vsprintf(char *dst_p, far_string_t fmt_p, va_list *ap_p)
 
     char *d_p = dst_p;
 
-    vcprintf(sprintf_putc, &d_p, fmt_p, ap_p);
-    sprintf_putc('\0', &d_p);
+    vcprintf(sprintf_write, &d_p, fmt_p, ap_p);
+    sprintf_write("", 1, &d_p);
 
     return (d_p - dst_p - 1);
 }
@@ -504,8 +1165,8 @@ ssize_t std_vsnprintf(char *dst_p,
     output.size = 0;
     output.size_max = size;
 
-    vcprintf(snprintf_putc, &output, fmt_p, ap_p);
-    snprintf_putc('\0', &output);
+    vcprintf(snprintf_write, &output, fmt_p, ap_p);
+    snprintf_write("", 1, &output);
 
     /* Force the string to be NULL terminated. */
     dst_p[size - 1] = '\0';
@@ -597,7 +1258,7 @@ ssize_t std_printf_isr(far_string_t fmt_p, ...)
     output.chan_p = sys_get_stdout();
 
     va_start(ap, fmt_p);
-    vcprintf(fprintf_putc_isr, &output, fmt_p, &ap);
+    vcprintf(fprintf_write_isr, &output, fmt_p, &ap);
     output_flush_isr(&output);
     va_end(ap);
 
@@ -614,7 +1275,7 @@ ssize_t std_fprintf_isr(void *chan_p, far_string_t fmt_p, ...)
     output.chan_p = chan_p;
 
     va_start(ap, fmt_p);
-    vcprintf(fprintf_putc_isr, &output, fmt_p, &ap);
+    vcprintf(fprintf_write_isr, &output, fmt_p, &ap);
     output_flush_isr(&output);
     va_end(ap);
 
@@ -1018,24 +1679,25 @@ char *std_strip(char *str_p, const char *strip_p)
 
     char *begin_p;
     size_t length;
+    size_t strip_length;
 
     /* Strip whitespace characters by default. */
     if (strip_p == NULL) {
         strip_p = "\t\n\x0b\x0c\r ";
     }
 
-    /* String leading characters. */
-    while ((*str_p != '\0') && char_in_string(*str_p, strip_p)) {
-        str_p++;
-    }
+    strip_length = strlen(strip_p);
 
-    begin_p = str_p;
+    /* String leading characters. */
+    length = strlen(str_p);
+    begin_p = (str_p + std_memspn(str_p, length, strip_p, strip_length));
+    length -= (begin_p - str_p);
 
     /* Strip training characters. */
-    length = strlen(str_p);
-    str_p += (length - 1);
+    str_p = (begin_p + length - 1);
 
-    while ((str_p >= begin_p) && char_in_string(*str_p, strip_p)) {
+    while ((str_p >= begin_p)
+           && char_in_chars(*str_p, strip_p, strip_length)) {
         *str_p = '\0';
         str_p--;
     }
@@ -1043,6 +1705,28 @@ char *std_strip(char *str_p, const char *strip_p)
     return (begin_p);
 }
 
+size_t std_memspn(const void *buf_p,
+                  size_t size,
+                  const char *chars_p,
+                  size_t length)
+{
+    ASSERTNR((buf_p != NULL) || (size == 0), EINVAL, 0);
+    ASSERTNR((chars_p != NULL) || (length == 0), EINVAL, 0);
+
+    return (scan(buf_p, size, chars_p, length, 0));
+}
+
+size_t std_memcspn(const void *buf_p,
+                   size_t size,
+                   const char *chars_p,
+                   size_t length)
+{
+    ASSERTNR((buf_p != NULL) || (size == 0), EINVAL, 0);
+    ASSERTNR((chars_p != NULL) || (length == 0), EINVAL, 0);
+
+    return (scan(buf_p, size, chars_p, length, 1));
+}
+
 ssize_t std_hexdump(void *chan_p, const void *buf_p, size_t size)
 {
     const char *b_p;
@@ -49,17 +49,27 @@ int std_module_init(void);
  *
  * A format specifier has this format:
  *
- * %[flags][width][length]specifier
+ * %[flags][width][.precision][length]specifier
  *
  * where
  *
  * * flags: ``0`` or ``-``
  * * width: ``0``..``127``
+ * * precision: ``0``..``9`` for ``f`` and ``g``, maximum number of
+ *   characters for ``s``, or ``*`` to take it from an ``int``
+ *   argument
  * * length: ``l`` for long or nothing
- * * specifier: ``c``, ``s``, ``S``, ``d``, ``i``, ``u``, ``x`` or ``f``
+ * * specifier: ``c``, ``s``, ``S``, ``d``, ``i``, ``u``, ``x``,
+ *   ``f`` or ``g``
  *
  * The ``S`` specifier expects a far string (``far_string_t``)
- * argument. Other specifiers have their usual definition.
+ * argument. The ``f`` specifier prints six decimals by default,
+ * correctly rounded. The ``g`` specifier without a precision prints
+ * the shortest number that reads back as the same single precision
+ * float, and with a precision it prints that many significant
+ * digits. An exponent is used if it is less than -4, or not less than
+ * the precision (nine by default). Other specifiers have their usual
+ * definition.
  *
  * @param[out] dst_p Destination buffer. The formatted string is
  *                   written to this buffer.
@@ -344,6 +354,44 @@ int std_strlen(far_string_t fstr_p);
  */
 char *std_strip(char *str_p, const char *strip_p);
 
+/**
+ * Get the length of the initial segment of given buffer that only
+ * consists of given characters. Each character costs a few
+ * instructions per scanned machine word, so keep the set small.
+ *
+ * @param[in] buf_p Buffer to scan.
+ * @param[in] size Buffer size in bytes.
+ * @param[in] chars_p Characters to accept. May include the null
+ *                    termination character.
+ * @param[in] length Number of characters in `chars_p`.
+ *
+ * @return Length of the initial segment, or `size` if all bytes are
+ *         accepted.
+ */
+size_t std_memspn(const void *buf_p,
+                  size_t size,
+                  const char *chars_p,
+                  size_t length);
+
+/**
+ * Get the length of the initial segment of given buffer that does
+ * not contain any of given characters, that is, the offset of the
+ * first byte equal to any of them.
+ *
+ * @param[in] buf_p Buffer to scan.
+ * @param[in] size Buffer size in bytes.
+ * @param[in] chars_p Characters to reject. May include the null
+ *                    termination character.
+ * @param[in] length Number of characters in `chars_p`.
+ *
+ * @return Length of the initial segment, or `size` if no byte is
+ *         rejected.
+ */
+size_t std_memcspn(const void *buf_p,
+                   size_t size,
+                   const char *chars_p,
+                   size_t length);
+
 /**
  * Write a hex dump of given data to given channel.
  *
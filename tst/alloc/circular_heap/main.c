@@ -29,6 +29,15 @@
 #include "simba.h"
 
 static char buffer[256];
+static char heap_buffer[4096];
+
+#if CONFIG_CIRCULAR_HEAP_SPSC == 1
+static struct circular_heap_t spsc_heap;
+static struct queue_t spsc_queue;
+static char spsc_queue_buffer[8 * sizeof(void *)];
+static struct sem_t spsc_done_sem;
+static THRD_STACK(consumer_stack, 1024);
+#endif
 
 static int test_alloc_free(void)
 {
@@ -82,10 +91,237 @@ static int test_alloc_free(void)
     return (0);
 }
 
+static int test_out_of_order_free(void)
+{
+    struct circular_heap_t circular_heap;
+    void *bufs[16];
+    int number_of_buffers;
+    int i;
+
+    BTASSERT(circular_heap_init(&circular_heap,
+                                buffer,
+                                sizeof(buffer)) == 0);
+
+    /* Allocate all memory. */
+    number_of_buffers = 0;
+
+    while (1) {
+        bufs[number_of_buffers] = circular_heap_alloc(&circular_heap, 32);
+
+        if (bufs[number_of_buffers] == NULL) {
+            break;
+        }
+
+        number_of_buffers++;
+    }
+
+    BTASSERT(number_of_buffers > 3);
+
+    /* Freeing buffers after the oldest does not make any memory
+       available. */
+    BTASSERT(circular_heap_free(&circular_heap, bufs[2]) == 0);
+    BTASSERT(circular_heap_free(&circular_heap, bufs[1]) == 0);
+    BTASSERT(circular_heap_alloc(&circular_heap, 32) == NULL);
+
+    /* Double free. */
+    BTASSERT(circular_heap_free(&circular_heap, bufs[1]) == -EINVAL);
+
+    /* Freeing the oldest buffer releases all three, which makes room
+       for two buffers, just as freeing them in order. */
+    BTASSERT(circular_heap_free(&circular_heap, bufs[0]) == 0);
+
+    for (i = 0; i < 2; i++) {
+        bufs[i] = circular_heap_alloc(&circular_heap, 32);
+        BTASSERT(bufs[i] != NULL);
+    }
+
+    BTASSERT(circular_heap_alloc(&circular_heap, 32) == NULL);
+
+    /* Free all memory, newest first. */
+    for (i = 1; i >= 0; i--) {
+        BTASSERT(circular_heap_free(&circular_heap, bufs[i]) == 0);
+    }
+
+    for (i = number_of_buffers - 1; i >= 3; i--) {
+        BTASSERT(circular_heap_free(&circular_heap, bufs[i]) == 0);
+    }
+
+    /* All memory is available. */
+    BTASSERT(circular_heap_alloc(&circular_heap, 100) != NULL);
+
+    return (0);
+}
+
+static int test_out_of_order_free_random(void)
+{
+    struct circular_heap_t circular_heap;
+    uint8_t *bufs[8];
+    uint8_t values[8];
+    size_t sizes[8];
+    uint32_t seed;
+    int allocated;
+    int i;
+    int j;
+    size_t k;
+
+    BTASSERT(circular_heap_init(&circular_heap,
+                                buffer,
+                                sizeof(buffer)) == 0);
+
+    memset(&bufs[0], 0, sizeof(bufs));
+    seed = 1;
+    allocated = 0;
+
+    /* Allocate and free buffers of random sizes in random order,
+       checking that no buffers overlap. */
+    for (i = 0; i < 2000; i++) {
+        seed = (1103515245 * seed + 12345);
+        j = ((seed >> 16) % membersof(bufs));
+
+        if (bufs[j] == NULL) {
+            sizes[j] = (1 + ((seed >> 8) % 48));
+            bufs[j] = circular_heap_alloc(&circular_heap, sizes[j]);
+
+            if (bufs[j] != NULL) {
+                values[j] = i;
+                memset(bufs[j], values[j], sizes[j]);
+                allocated++;
+            }
+        } else {
+            for (k = 0; k < sizes[j]; k++) {
+                BTASSERT(bufs[j][k] == values[j]);
+            }
+
+            BTASSERT(circular_heap_free(&circular_heap, bufs[j]) == 0);
+            bufs[j] = NULL;
+        }
+    }
+
+    BTASSERT(allocated > 500);
+
+    for (j = 0; j < membersof(bufs); j++) {
+        if (bufs[j] != NULL) {
+            BTASSERT(circular_heap_free(&circular_heap, bufs[j]) == 0);
+        }
+    }
+
+    BTASSERT(circular_heap_alloc(&circular_heap, 100) != NULL);
+
+    return (0);
+}
+
+#if CONFIG_CIRCULAR_HEAP_SPSC == 1
+
+static void *consumer_main(void *arg_p)
+{
+    uint8_t *buf_p;
+
+    thrd_set_name("consumer");
+
+    while (1) {
+        queue_read(&spsc_queue, &buf_p, sizeof(buf_p));
+
+        /* NULL is written by the producer when it is done. */
+        if (buf_p == NULL) {
+            sem_give(&spsc_done_sem, 1);
+        } else {
+            circular_heap_free(&spsc_heap, buf_p);
+        }
+    }
+
+    return (NULL);
+}
+
+static int test_spsc(void)
+{
+    uint8_t *buf_p;
+    int i;
+
+    BTASSERT(circular_heap_init(&spsc_heap, buffer, sizeof(buffer)) == 0);
+    BTASSERT(queue_init(&spsc_queue,
+                        &spsc_queue_buffer[0],
+                        sizeof(spsc_queue_buffer)) == 0);
+    BTASSERT(sem_init(&spsc_done_sem, 1, 1) == 0);
+    BTASSERT(thrd_spawn(consumer_main,
+                        NULL,
+                        -10,
+                        consumer_stack,
+                        sizeof(consumer_stack)) != NULL);
+
+    /* Let the consumer free the buffers allocated by this thread. */
+    for (i = 0; i < 100; i++) {
+        buf_p = circular_heap_alloc(&spsc_heap, 24);
+
+        /* Let the consumer free buffers if out of memory. */
+        if (buf_p == NULL) {
+            thrd_yield();
+            i--;
+            continue;
+        }
+
+        BTASSERT(queue_write(&spsc_queue,
+                             &buf_p,
+                             sizeof(buf_p)) == sizeof(buf_p));
+    }
+
+    /* Wait for the consumer to free all buffers. */
+    buf_p = NULL;
+    BTASSERT(queue_write(&spsc_queue,
+                         &buf_p,
+                         sizeof(buf_p)) == sizeof(buf_p));
+    BTASSERT(sem_take(&spsc_done_sem, NULL) == 0);
+
+    BTASSERT(spsc_heap.free_p == spsc_heap.alloc_p);
+
+    return (0);
+}
+
+#endif
+
+/**
+ * A streaming workload; allocate packets of varying sizes and free
+ * them a few packets later, in allocation order and in a shuffled
+ * order. The timing is measured by the bench suite.
+ */
+static int test_stream(void)
+{
+    struct circular_heap_t circular_heap;
+    void *bufs[8];
+    int stride;
+    int slot;
+    int i;
+
+    for (stride = 1; stride <= 5; stride += 4) {
+        BTASSERT(circular_heap_init(&circular_heap,
+                                    heap_buffer,
+                                    sizeof(heap_buffer)) == 0);
+        memset(&bufs[0], 0, sizeof(bufs));
+
+        for (i = 0; i < 10000; i++) {
+            slot = ((i * stride) % 8);
+
+            if (bufs[slot] != NULL) {
+                BTASSERT(circular_heap_free(&circular_heap, bufs[slot]) == 0);
+            }
+
+            bufs[slot] = circular_heap_alloc(&circular_heap, 16 + (i % 7) * 24);
+            BTASSERT(bufs[slot] != NULL);
+        }
+    }
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
         { test_alloc_free, "test_alloc_free" },
+        { test_out_of_order_free, "test_out_of_order_free" },
+        { test_out_of_order_free_random, "test_out_of_order_free_random" },
+#if CONFIG_CIRCULAR_HEAP_SPSC == 1
+        { test_spsc, "test_spsc" },
+#endif
+        { test_stream, "test_stream" },
         { NULL, NULL }
     };
 
@@ -0,0 +1,895 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#if defined(ARCH_ESP32) || defined(ARCH_PPC)
+#    define PEER_STACK_SIZE                                           512
+#elif defined(ARCH_ARM64) || defined(ARCH_MIPS)
+#    define PEER_STACK_SIZE                                          1024
+#else
+#    define PEER_STACK_SIZE                                           224
+#endif
+
+/* Number of entries and settings in the generated JSON document. */
+#define JSON_DOCUMENT_LENGTH                                            8
+
+/* Number of properties in the generated configuration file. */
+#define CONFIGFILE_PROPERTIES                                         100
+
+#define NUMBER_OF_BENCHMARKS                                           32
+
+/* Ping-pong primitives. The peer threads have higher priority than
+   the main thread, so every operation in a ping-pong benchmark is
+   two context switches. */
+static struct thrd_t *main_thrd_p;
+static struct thrd_t *suspend_thrd_p;
+static struct sem_t sem_ping;
+static struct sem_t sem_pong;
+static struct mutex_t mutex;
+static struct cond_t cond_ping;
+static struct cond_t cond_pong;
+static int turn;
+static struct event_t event_ping;
+static struct event_t event_pong;
+static struct queue_t queue_ping;
+static struct queue_t queue_pong;
+static char queue_ping_buf[4];
+static char queue_pong_buf[4];
+
+static THRD_STACK(suspend_stack, PEER_STACK_SIZE);
+static THRD_STACK(sem_stack, PEER_STACK_SIZE);
+static THRD_STACK(mutex_stack, PEER_STACK_SIZE);
+static THRD_STACK(event_stack, PEER_STACK_SIZE);
+static THRD_STACK(queue_stack, PEER_STACK_SIZE);
+
+static struct heap_t heap;
+static char heap_buf[512];
+static struct circular_heap_t circular_heap;
+static char circular_heap_buf[4096];
+static void *circular_heap_bufs[8];
+static uint32_t circular_heap_counter;
+static struct hash_map_t hash_map;
+static struct hash_map_bucket_t hash_map_buckets[16];
+static struct hash_map_entry_t hash_map_entries[32];
+static struct circular_buffer_t circular_buffer;
+static char circular_buffer_buf[64];
+static uint8_t data[256];
+static struct json_tok_t json_tokens[32];
+static char text[256];
+static char json_large_document[1024];
+static int json_large_document_size;
+static struct json_tok_t json_large_tokens[12 + 20 * JSON_DOCUMENT_LENGTH];
+static struct json_index_entry_t json_index_entries[4 * JSON_DOCUMENT_LENGTH];
+static struct json_t json_linear;
+static struct json_t json_indexed;
+static char json_setting_keys[JSON_DOCUMENT_LENGTH][12];
+static char configfile_buf[2048];
+static struct configfile_index_entry_t configfile_entries[128];
+static struct configfile_t configfile_scan;
+static struct configfile_t configfile_indexed;
+static char configfile_sections[CONFIGFILE_PROPERTIES / 10][12];
+static char configfile_properties[CONFIGFILE_PROPERTIES][12];
+
+static const char json_document[] =
+    "{"
+    "\"name\": \"sensor\", "
+    "\"enabled\": true, "
+    "\"period\": 1000, "
+    "\"channels\": [1, 2, 3, 4], "
+    "\"limits\": {\"min\": -40, \"max\": 125}"
+    "}";
+
+/* Prevents the compiler from removing computations. */
+static volatile uint32_t sink;
+
+static struct bench_result_t results[NUMBER_OF_BENCHMARKS];
+static int number_of_results = 0;
+
+static void *suspend_main(void *arg_p)
+{
+    thrd_set_name("bench_suspend");
+
+    while (1) {
+        thrd_suspend(NULL);
+        thrd_resume(main_thrd_p, 0);
+    }
+
+    return (NULL);
+}
+
+static void *sem_main(void *arg_p)
+{
+    thrd_set_name("bench_sem");
+
+    while (1) {
+        sem_take(&sem_ping, NULL);
+        sem_give(&sem_pong, 1);
+    }
+
+    return (NULL);
+}
+
+static void *mutex_main(void *arg_p)
+{
+    thrd_set_name("bench_mutex");
+
+    mutex_lock(&mutex);
+
+    while (1) {
+        while (turn != 1) {
+            cond_wait(&cond_ping, &mutex, NULL);
+        }
+
+        turn = 0;
+        cond_signal(&cond_pong);
+    }
+
+    return (NULL);
+}
+
+static void *event_main(void *arg_p)
+{
+    uint32_t mask;
+
+    thrd_set_name("bench_event");
+
+    while (1) {
+        mask = 0x1;
+        event_read(&event_ping, &mask, sizeof(mask));
+        event_write(&event_pong, &mask, sizeof(mask));
+    }
+
+    return (NULL);
+}
+
+static void *queue_main(void *arg_p)
+{
+    char value;
+
+    thrd_set_name("bench_queue");
+
+    while (1) {
+        queue_read(&queue_ping, &value, sizeof(value));
+        queue_write(&queue_pong, &value, sizeof(value));
+    }
+
+    return (NULL);
+}
+
+static int hash(longptr_t key)
+{
+    return (key);
+}
+
+static void bench_context_switch(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        thrd_resume(suspend_thrd_p, 0);
+        thrd_suspend(NULL);
+    }
+}
+
+static void bench_sem(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        sem_give(&sem_ping, 1);
+        sem_take(&sem_pong, NULL);
+    }
+}
+
+static void bench_mutex(void *arg_p, uint32_t iterations)
+{
+    mutex_lock(&mutex);
+
+    while (iterations-- > 0) {
+        turn = 1;
+        cond_signal(&cond_ping);
+
+        while (turn != 0) {
+            cond_wait(&cond_pong, &mutex, NULL);
+        }
+    }
+
+    mutex_unlock(&mutex);
+}
+
+static void bench_mutex_lock_unlock(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        mutex_lock(&mutex);
+        mutex_unlock(&mutex);
+    }
+}
+
+static void bench_event(void *arg_p, uint32_t iterations)
+{
+    uint32_t mask;
+
+    while (iterations-- > 0) {
+        mask = 0x1;
+        event_write(&event_ping, &mask, sizeof(mask));
+        event_read(&event_pong, &mask, sizeof(mask));
+    }
+}
+
+static void bench_queue(void *arg_p, uint32_t iterations)
+{
+    char value;
+
+    value = 'a';
+
+    while (iterations-- > 0) {
+        queue_write(&queue_ping, &value, sizeof(value));
+        queue_read(&queue_pong, &value, sizeof(value));
+    }
+}
+
+static void bench_heap(void *arg_p, uint32_t iterations)
+{
+    void *buf_p;
+
+    while (iterations-- > 0) {
+        buf_p = heap_alloc(&heap, 32);
+        heap_free(&heap, buf_p);
+    }
+}
+
+/**
+ * A streaming workload; allocate packets of varying sizes and free
+ * them a few packets later. The argument is the slot stride, 1 to
+ * free in allocation order and 5 to free in a shuffled order.
+ */
+static void bench_circular_heap_stream(void *arg_p, uint32_t iterations)
+{
+    uint32_t stride;
+    int slot;
+
+    stride = (uint32_t)(uintptr_t)arg_p;
+
+    while (iterations-- > 0) {
+        slot = ((circular_heap_counter * stride) % 8);
+
+        if (circular_heap_bufs[slot] != NULL) {
+            circular_heap_free(&circular_heap, circular_heap_bufs[slot]);
+        }
+
+        circular_heap_bufs[slot] =
+            circular_heap_alloc(&circular_heap,
+                                16 + (circular_heap_counter % 7) * 24);
+        circular_heap_counter++;
+    }
+}
+
+static void bench_hash_map_get(void *arg_p, uint32_t iterations)
+{
+    longptr_t value;
+
+    while (iterations-- > 0) {
+        hash_map_get(&hash_map, iterations % 32, &value);
+    }
+}
+
+static void bench_hash_map_add_remove(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        hash_map_add(&hash_map, 100, iterations);
+        hash_map_remove(&hash_map, 100);
+    }
+}
+
+static void bench_circular_buffer(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        circular_buffer_write(&circular_buffer, &data[0], 16);
+        circular_buffer_read(&circular_buffer, &data[16], 16);
+    }
+}
+
+static void bench_crc_32(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        sink = crc_32(0, &data[0], sizeof(data));
+    }
+}
+
+static void bench_crc_ccitt(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        sink = crc_ccitt(0xffff, &data[0], sizeof(data));
+    }
+}
+
+static void bench_crc_xmodem(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        sink = crc_xmodem(0x0000, &data[0], sizeof(data));
+    }
+}
+
+static void bench_sha1(void *arg_p, uint32_t iterations)
+{
+    struct sha1_t sha1;
+    uint8_t digest[20];
+
+    while (iterations-- > 0) {
+        sha1_init(&sha1);
+        sha1_update(&sha1, &data[0], sizeof(data));
+        sha1_digest(&sha1, &digest[0]);
+        sink = digest[0];
+    }
+}
+
+static void bench_sha256(void *arg_p, uint32_t iterations)
+{
+    struct sha256_t sha256;
+    uint8_t digest[32];
+
+    while (iterations-- > 0) {
+        sha256_init(&sha256);
+        sha256_update(&sha256, &data[0], sizeof(data));
+        sha256_digest(&sha256, &digest[0]);
+        sink = digest[0];
+    }
+}
+
+/**
+ * Four buffers per iteration, to compare with four iterations of the
+ * single buffer benchmarks.
+ */
+static void bench_sha1_multi(void *arg_p, uint32_t iterations)
+{
+    static const size_t sizes[4] = {
+        sizeof(data), sizeof(data), sizeof(data), sizeof(data)
+    };
+    const void *bufs[4] = { &data[0], &data[0], &data[0], &data[0] };
+    uint8_t digests[4][20];
+
+    while (iterations-- > 0) {
+        sha1_digest_multi(&bufs[0], &sizes[0], 4, &digests[0][0]);
+        sink = digests[3][0];
+    }
+}
+
+static void bench_sha256_multi(void *arg_p, uint32_t iterations)
+{
+    static const size_t sizes[4] = {
+        sizeof(data), sizeof(data), sizeof(data), sizeof(data)
+    };
+    const void *bufs[4] = { &data[0], &data[0], &data[0], &data[0] };
+    uint8_t digests[4][32];
+
+    while (iterations-- > 0) {
+        sha256_digest_multi(&bufs[0], &sizes[0], 4, &digests[0][0]);
+        sink = digests[3][0];
+    }
+}
+
+static void bench_json_parse(void *arg_p, uint32_t iterations)
+{
+    struct json_t json;
+
+    while (iterations-- > 0) {
+        json_init(&json, &json_tokens[0], membersof(json_tokens));
+        sink = json_parse(&json, &json_document[0], strlen(json_document));
+    }
+}
+
+/**
+ * Get all settings and entries from the generated document.
+ */
+static void bench_json_get(void *arg_p, uint32_t iterations)
+{
+    struct json_t *json_p;
+    struct json_tok_t *settings_p;
+    struct json_tok_t *entries_p;
+    struct json_tok_t *setting_p;
+    struct json_tok_t *entry_p;
+    int i;
+
+    json_p = arg_p;
+
+    while (iterations-- > 0) {
+        settings_p = json_object_get(json_p, "settings", json_root(json_p));
+        entries_p = json_object_get(json_p, "entries", json_root(json_p));
+
+        for (i = 0; i < JSON_DOCUMENT_LENGTH; i++) {
+            setting_p = json_object_get(json_p,
+                                        &json_setting_keys[i][0],
+                                        settings_p);
+            sink = (uintptr_t)json_object_get(json_p, "value", setting_p);
+            entry_p = json_array_get(json_p, i, entries_p);
+            sink = (uintptr_t)json_object_get(json_p, "limits", entry_p);
+        }
+    }
+}
+
+/**
+ * Get one of the properties in a file with 100 properties in 10
+ * sections, by scanning or using the index.
+ */
+static void bench_configfile_get(void *arg_p, uint32_t iterations)
+{
+    struct configfile_t *configfile_p;
+    long value;
+    int i;
+
+    configfile_p = arg_p;
+    i = 0;
+
+    while (iterations-- > 0) {
+        configfile_get_long(configfile_p,
+                            &configfile_sections[i / 10][0],
+                            &configfile_properties[i][0],
+                            &value);
+        sink += value;
+        i++;
+
+        if (i == CONFIGFILE_PROPERTIES) {
+            i = 0;
+        }
+    }
+}
+
+static void bench_harness_mock_write_read(void *arg_p, uint32_t iterations)
+{
+    int value;
+
+    value = 0;
+
+    while (iterations-- > 0) {
+        harness_mock_write("bench(0)", &value, sizeof(value));
+        harness_mock_read("bench(0)", &value, sizeof(value));
+        value++;
+    }
+}
+
+static void bench_harness_mock_write_read_many(void *arg_p,
+                                               uint32_t iterations)
+{
+    int values[10];
+
+    memset(&values[0], 0, sizeof(values));
+
+    while (iterations-- > 0) {
+        harness_mock_write_many("bench(0)",
+                                &values[0],
+                                sizeof(values[0]),
+                                membersof(values));
+        harness_mock_read_many("bench(0)",
+                               &values[0],
+                               sizeof(values[0]),
+                               membersof(values));
+    }
+}
+
+static void bench_std_memcspn(void *arg_p, uint32_t iterations)
+{
+    while (iterations-- > 0) {
+        sink = std_memcspn(&text[0], sizeof(text), "\"\\", 2);
+    }
+}
+
+static void bench_std_snprintf_literal(void *arg_p, uint32_t iterations)
+{
+    char buf[128];
+
+    while (iterations-- > 0) {
+        sink = std_snprintf(&buf[0],
+                            sizeof(buf),
+                            FSTR("HTTP/1.1 200 OK\r\n"
+                                 "Content-Type: application/json\r\n"
+                                 "Content-Length: %d\r\n\r\n"),
+                            (int)iterations);
+    }
+}
+
+#if CONFIG_FLOAT == 1
+
+static void bench_std_snprintf_float(void *arg_p, uint32_t iterations)
+{
+    char buf[128];
+
+    while (iterations-- > 0) {
+        sink = std_snprintf(&buf[0],
+                            sizeof(buf),
+                            FSTR("{\"temperature\": %f, \"pressure\": %f}"),
+                            21.375,
+                            101325.5);
+    }
+}
+
+#endif
+
+#if defined(ARCH_LINUX)
+
+static void bench_libc_snprintf_literal(void *arg_p, uint32_t iterations)
+{
+    char buf[128];
+
+    while (iterations-- > 0) {
+        sink = snprintf(&buf[0],
+                        sizeof(buf),
+                        "HTTP/1.1 200 OK\r\n"
+                        "Content-Type: application/json\r\n"
+                        "Content-Length: %d\r\n\r\n",
+                        (int)iterations);
+    }
+}
+
+static void bench_libc_snprintf_float(void *arg_p, uint32_t iterations)
+{
+    char buf[128];
+
+    while (iterations-- > 0) {
+        sink = snprintf(&buf[0],
+                        sizeof(buf),
+                        "{\"temperature\": %f, \"pressure\": %f}",
+                        21.375,
+                        101325.5);
+    }
+}
+
+#endif
+
+static void bench_std_sprintf(void *arg_p, uint32_t iterations)
+{
+    char buf[64];
+
+    while (iterations-- > 0) {
+        sink = std_sprintf(&buf[0],
+                           FSTR("%d %s %lu 0x%x"),
+                           -1234,
+                           "foo",
+                           123456789ul,
+                           0xbeef);
+    }
+}
+
+static int run_arg(const char *name_p, bench_fn_t fn, void *arg_p)
+{
+    struct bench_result_t *result_p;
+
+    BTASSERT(number_of_results < membersof(results));
+
+    result_p = &results[number_of_results];
+    BTASSERT(bench_run(result_p, name_p, fn, arg_p) == 0);
+    BTASSERT(bench_print(sys_get_stdout(), result_p) == 0);
+    number_of_results++;
+
+    BTASSERT(result_p->iterations > 0);
+    BTASSERT(result_p->samples == CONFIG_BENCH_SAMPLES);
+    BTASSERT(result_p->time.min <= result_p->time.p50);
+    BTASSERT(result_p->time.p50 <= result_p->time.p90);
+    BTASSERT(result_p->time.p90 <= result_p->time.p99);
+    BTASSERT(result_p->time.p99 <= result_p->time.max);
+    BTASSERT(result_p->time.min <= result_p->time.mean);
+    BTASSERT(result_p->time.mean <= result_p->time.max);
+
+    return (0);
+}
+
+static int run(const char *name_p, bench_fn_t fn)
+{
+    return (run_arg(name_p, fn, NULL));
+}
+
+/**
+ * Create a document with given number of entries and settings.
+ */
+static int create_document(char *buf_p, size_t size, int length)
+{
+    int i;
+    int pos;
+
+    pos = std_snprintf(buf_p, size, FSTR("{\"version\":1,\"entries\":["));
+
+    for (i = 0; i < length; i++) {
+        pos += std_snprintf(&buf_p[pos],
+                            size - pos,
+                            FSTR("%s{\"id\":%d,\"enabled\":true,"
+                                 "\"limits\":[0,100,%d]}"),
+                            (i == 0 ? "" : ","),
+                            i,
+                            i);
+    }
+
+    pos += std_snprintf(&buf_p[pos], size - pos, FSTR("],\"settings\":{"));
+
+    for (i = 0; i < length; i++) {
+        pos += std_snprintf(&buf_p[pos],
+                            size - pos,
+                            FSTR("%s\"setting_%d\":{\"value\":%d,"
+                                 "\"unit\":\"ms\",\"persistent\":false}"),
+                            (i == 0 ? "" : ","),
+                            i,
+                            i);
+    }
+
+    pos += std_snprintf(&buf_p[pos], size - pos, FSTR("}}"));
+
+    return (pos);
+}
+
+static int test_init(void)
+{
+    size_t size;
+    int i;
+    size_t sizes[HEAP_FIXED_SIZES_MAX] = {
+        16, 32, 64, 128, 128, 128, 128, 128
+    };
+
+    BTASSERT(bench_module_init() == 0);
+    BTASSERT(bench_module_init() == 0);
+
+    main_thrd_p = thrd_self();
+
+    BTASSERT(sem_init(&sem_ping, 0, 1) == 0);
+    BTASSERT(sem_init(&sem_pong, 0, 1) == 0);
+    BTASSERT(mutex_init(&mutex) == 0);
+    BTASSERT(cond_init(&cond_ping) == 0);
+    BTASSERT(cond_init(&cond_pong) == 0);
+    BTASSERT(event_init(&event_ping) == 0);
+    BTASSERT(event_init(&event_pong) == 0);
+    BTASSERT(queue_init(&queue_ping,
+                        &queue_ping_buf[0],
+                        sizeof(queue_ping_buf)) == 0);
+    BTASSERT(queue_init(&queue_pong,
+                        &queue_pong_buf[0],
+                        sizeof(queue_pong_buf)) == 0);
+
+    suspend_thrd_p = thrd_spawn(suspend_main,
+                                NULL,
+                                -10,
+                                suspend_stack,
+                                sizeof(suspend_stack));
+    BTASSERT(suspend_thrd_p != NULL);
+    BTASSERT(thrd_spawn(sem_main,
+                        NULL,
+                        -10,
+                        sem_stack,
+                        sizeof(sem_stack)) != NULL);
+    BTASSERT(thrd_spawn(mutex_main,
+                        NULL,
+                        -10,
+                        mutex_stack,
+                        sizeof(mutex_stack)) != NULL);
+    BTASSERT(thrd_spawn(event_main,
+                        NULL,
+                        -10,
+                        event_stack,
+                        sizeof(event_stack)) != NULL);
+    BTASSERT(thrd_spawn(queue_main,
+                        NULL,
+                        -10,
+                        queue_stack,
+                        sizeof(queue_stack)) != NULL);
+
+    /* Let the peer threads start and wait for the first ping. A
+       thread that has not started yet cannot be resumed. */
+    thrd_sleep_ms(10);
+
+    BTASSERT(heap_init(&heap, &heap_buf[0], sizeof(heap_buf), sizes) == 0);
+    BTASSERT(circular_heap_init(&circular_heap,
+                                &circular_heap_buf[0],
+                                sizeof(circular_heap_buf)) == 0);
+    BTASSERT(hash_map_init(&hash_map,
+                           &hash_map_buckets[0],
+                           membersof(hash_map_buckets),
+                           &hash_map_entries[0],
+                           membersof(hash_map_entries),
+                           hash) == 0);
+
+    for (i = 0; i < 16; i++) {
+        BTASSERT(hash_map_add(&hash_map, i, i) == 0);
+    }
+
+    BTASSERT(circular_buffer_init(&circular_buffer,
+                                  &circular_buffer_buf[0],
+                                  sizeof(circular_buffer_buf)) == 0);
+
+    for (i = 0; i < membersof(data); i++) {
+        data[i] = i;
+    }
+
+    memset(&text[0], 'a', sizeof(text));
+    text[sizeof(text) - 1] = '"';
+
+    for (i = 0; i < JSON_DOCUMENT_LENGTH; i++) {
+        std_sprintf(&json_setting_keys[i][0], FSTR("setting_%d"), i);
+    }
+
+    json_large_document_size = create_document(&json_large_document[0],
+                                               sizeof(json_large_document),
+                                               JSON_DOCUMENT_LENGTH);
+    BTASSERT(json_large_document_size < sizeof(json_large_document) - 1);
+    BTASSERT(json_init(&json_linear,
+                       &json_large_tokens[0],
+                       membersof(json_large_tokens)) == 0);
+    BTASSERT(json_parse(&json_linear,
+                        &json_large_document[0],
+                        json_large_document_size) > 0);
+    json_indexed = json_linear;
+    BTASSERT(json_set_index(&json_indexed,
+                            &json_index_entries[0],
+                            membersof(json_index_entries)) == 0);
+
+    size = 0;
+
+    for (i = 0; i < CONFIGFILE_PROPERTIES; i++) {
+        if ((i % 10) == 0) {
+            std_sprintf(&configfile_sections[i / 10][0],
+                        FSTR("section%d"),
+                        i / 10);
+            size += std_sprintf(&configfile_buf[size],
+                                FSTR("[section%d]\r\n"),
+                                i / 10);
+        }
+
+        std_sprintf(&configfile_properties[i][0], FSTR("property%d"), i);
+        size += std_sprintf(&configfile_buf[size],
+                            FSTR("property%d = %d\r\n"),
+                            i,
+                            i);
+    }
+
+    BTASSERT(size < sizeof(configfile_buf));
+    BTASSERT(configfile_init(&configfile_scan,
+                             &configfile_buf[0],
+                             sizeof(configfile_buf)) == 0);
+    BTASSERT(configfile_init(&configfile_indexed,
+                             &configfile_buf[0],
+                             sizeof(configfile_buf)) == 0);
+    BTASSERT(configfile_index(&configfile_indexed,
+                              &configfile_entries[0],
+                              membersof(configfile_entries)) == 0);
+
+    return (0);
+}
+
+static int test_kernel(void)
+{
+    BTASSERT(run("context_switch", bench_context_switch) == 0);
+    BTASSERT(run("sem_ping_pong", bench_sem) == 0);
+    BTASSERT(run("mutex_ping_pong", bench_mutex) == 0);
+    BTASSERT(run("mutex_lock_unlock", bench_mutex_lock_unlock) == 0);
+    BTASSERT(run("event_ping_pong", bench_event) == 0);
+    BTASSERT(run("queue_ping_pong", bench_queue) == 0);
+
+    return (0);
+}
+
+static int test_library(void)
+{
+    BTASSERT(run("heap_alloc_free", bench_heap) == 0);
+    BTASSERT(run_arg("circular_heap_stream",
+                     bench_circular_heap_stream,
+                     (void *)1) == 0);
+    BTASSERT(run_arg("circular_heap_stream_shuffled",
+                     bench_circular_heap_stream,
+                     (void *)5) == 0);
+    BTASSERT(run("hash_map_get", bench_hash_map_get) == 0);
+    BTASSERT(run("hash_map_add_remove", bench_hash_map_add_remove) == 0);
+    BTASSERT(run("circular_buffer_write_read", bench_circular_buffer) == 0);
+    BTASSERT(run("crc_32_256", bench_crc_32) == 0);
+    BTASSERT(run("crc_ccitt_256", bench_crc_ccitt) == 0);
+    BTASSERT(run("crc_xmodem_256", bench_crc_xmodem) == 0);
+    BTASSERT(run("sha1_256", bench_sha1) == 0);
+    BTASSERT(run("sha256_256", bench_sha256) == 0);
+    BTASSERT(run("sha1_multi_4x256", bench_sha1_multi) == 0);
+    BTASSERT(run("sha256_multi_4x256", bench_sha256_multi) == 0);
+    BTASSERT(run("json_parse", bench_json_parse) == 0);
+    BTASSERT(run_arg("json_get_linear", bench_json_get, &json_linear) == 0);
+    BTASSERT(run_arg("json_get_indexed", bench_json_get, &json_indexed) == 0);
+    BTASSERT(run_arg("configfile_get_scan",
+                     bench_configfile_get,
+                     &configfile_scan) == 0);
+    BTASSERT(run_arg("configfile_get_indexed",
+                     bench_configfile_get,
+                     &configfile_indexed) == 0);
+    BTASSERT(run("std_memcspn_256", bench_std_memcspn) == 0);
+    BTASSERT(run("std_sprintf", bench_std_sprintf) == 0);
+    BTASSERT(run("std_snprintf_literal", bench_std_snprintf_literal) == 0);
+#if CONFIG_FLOAT == 1
+    BTASSERT(run("std_snprintf_float", bench_std_snprintf_float) == 0);
+#endif
+#if defined(ARCH_LINUX)
+    BTASSERT(run("libc_snprintf_literal", bench_libc_snprintf_literal) == 0);
+    BTASSERT(run("libc_snprintf_float", bench_libc_snprintf_float) == 0);
+#endif
+
+    return (0);
+}
+
+/**
+ * Mock entries only live for the duration of a testcase. Other ids
+ * have entries as well, as in a typical test.
+ */
+static int test_harness(void)
+{
+    static const char *ids[] = {
+        "bench(1)", "bench(2)", "bench(3)", "bench(4)", "bench(5)",
+        "bench(6)", "bench(7)", "bench(8)", "bench(9)"
+    };
+    int values[10];
+    int i;
+
+    memset(&values[0], 0, sizeof(values));
+
+    for (i = 0; i < membersof(ids); i++) {
+        BTASSERTI(harness_mock_write_many(ids[i],
+                                          &values[0],
+                                          sizeof(values[0]),
+                                          membersof(values)),
+                  ==,
+                  sizeof(values));
+    }
+
+    BTASSERT(run("harness_mock_write_read",
+                 bench_harness_mock_write_read) == 0);
+    BTASSERT(run("harness_mock_write_read_many_10",
+                 bench_harness_mock_write_read_many) == 0);
+
+    for (i = 0; i < membersof(ids); i++) {
+        BTASSERTI(harness_mock_read_many(ids[i],
+                                         &values[0],
+                                         sizeof(values[0]),
+                                         membersof(values)),
+                  ==,
+                  sizeof(values));
+    }
+
+    return (0);
+}
+
+static int test_json(void)
+{
+    BTASSERT(bench_print_json(sys_get_stdout(),
+                              &results[0],
+                              number_of_results) == 0);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_kernel, "test_kernel" },
+        { test_library, "test_library" },
+        { test_harness, "test_harness" },
+        { test_json, "test_json" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -274,6 +274,159 @@ static int test_mock_cwrite(void)
     return (0);
 }
 
+static int test_mock_many(void)
+{
+    int values[5];
+    int i;
+    char buf[6];
+
+    for (i = 0; i < 5; i++) {
+        values[i] = i;
+    }
+
+    BTASSERTI(harness_mock_write_many("many(values)",
+                                      &values[0],
+                                      sizeof(values[0]),
+                                      5), ==, sizeof(values));
+
+    /* Entries written one by one are read after the bulk entries. */
+    i = 5;
+    BTASSERTI(harness_mock_write("many(values)",
+                                 &i,
+                                 sizeof(i)), ==, sizeof(i));
+
+    /* Read the first entry alone, and the rest in bulk. */
+    BTASSERTI(harness_mock_read("many(values)",
+                                &i,
+                                sizeof(i)), ==, sizeof(i));
+    BTASSERTI(i, ==, 0);
+
+    memset(&values[0], 0, sizeof(values));
+    BTASSERTI(harness_mock_read_many("many(values)",
+                                     &values[0],
+                                     sizeof(values[0]),
+                                     5), ==, sizeof(values));
+
+    for (i = 0; i < 5; i++) {
+        BTASSERTI(values[i], ==, i + 1);
+    }
+
+    /* Bytes, and entries without data. */
+    BTASSERTI(harness_mock_write_many("many(buf)", "hello", 1, 5), ==, 5);
+    BTASSERTI(harness_mock_write_many("many()", NULL, 0, 3), ==, 0);
+    BTASSERTI(harness_mock_write_many("many()", NULL, 0, 0), ==, 0);
+
+    BTASSERTI(harness_mock_read_many("many()", NULL, 0, 3), ==, 0);
+    memset(&buf[0], 0, sizeof(buf));
+    BTASSERTI(harness_mock_read_many("many(buf)", &buf[0], 1, 5), ==, 5);
+    BTASSERTM(&buf[0], "hello", 6);
+
+    /* Nothing left to read. */
+    BTASSERTI(harness_mock_try_read("many(buf)", &buf[0], 1), ==, -ENOENT);
+    BTASSERTI(harness_mock_read_many("many()", NULL, 0, 1), ==, -1);
+    BTASSERT(harness_get_testcase_result() == -1);
+    BTASSERT(harness_set_testcase_result(0) == 0);
+
+    return (0);
+}
+
+static int test_mock_ids(void)
+{
+    static const char *ids[] = {
+        "ids(a)", "ids(b)", "ids(c)", "ids(d)", "ids(e)"
+    };
+    char id[8];
+    int value;
+    int i;
+
+    /* Interleave entries of all ids. */
+    for (i = 0; i < 50; i++) {
+        BTASSERTI(harness_mock_write(ids[i % 5],
+                                     &i,
+                                     sizeof(i)), ==, sizeof(i));
+    }
+
+    /* Read the ids in reverse order, using copies of the id strings
+       to match on content rather than on address. */
+    for (i = 49; i >= 0; i--) {
+        strcpy(&id[0], ids[4 - (i % 5)]);
+        BTASSERTI(harness_mock_read(&id[0],
+                                    &value,
+                                    sizeof(value)), ==, sizeof(value));
+        BTASSERTI(value, ==, 5 * ((49 - i) / 5) + 4 - (i % 5));
+    }
+
+    return (0);
+}
+
+/**
+ * Write and read many mock entries with a few ids, one by one and in
+ * bulk. The timing is measured by the bench suite.
+ */
+static int test_mock_many_entries(void)
+{
+    static const char *ids[] = {
+        "bench(0)", "bench(1)", "bench(2)", "bench(3)", "bench(4)",
+        "bench(5)", "bench(6)", "bench(7)", "bench(8)", "bench(9)"
+    };
+    static int values[800];
+    int length;
+    int value;
+    int i;
+
+    if (CONFIG_HARNESS_MOCK_ENTRIES_MAX >= 1000) {
+        length = membersof(values);
+    } else {
+        length = 10;
+    }
+
+    for (i = 0; i < length; i++) {
+        BTASSERTI(harness_mock_write(ids[i % 10],
+                                     &i,
+                                     sizeof(i)), ==, sizeof(i));
+    }
+
+    /* Read the last written id first. Entries of an id are read in
+       the order they were written. */
+    for (i = length - 1; i >= 0; i--) {
+        BTASSERTI(harness_mock_read(ids[9 - (i % 10)],
+                                    &value,
+                                    sizeof(value)), ==, sizeof(value));
+        BTASSERTI(value, ==, 10 * ((length - 1 - i) / 10) + 9 - (i % 10));
+    }
+
+    /* Write and read all entries of each id at once. */
+    for (i = 0; i < length; i++) {
+        values[i] = i;
+    }
+
+    for (i = 0; i < 10; i++) {
+        BTASSERTI(harness_mock_write_many(ids[i],
+                                          &values[i * (length / 10)],
+                                          sizeof(values[0]),
+                                          length / 10),
+                  ==,
+                  sizeof(values[0]) * (length / 10));
+    }
+
+    memset(&values[0], 0, sizeof(values));
+
+    for (i = 9; i >= 0; i--) {
+        BTASSERTI(harness_mock_read_many(ids[i],
+                                         &values[i * (length / 10)],
+                                         sizeof(values[0]),
+                                         length / 10),
+                  ==,
+                  sizeof(values[0]) * (length / 10));
+    }
+
+    for (i = 0; i < length; i++) {
+        BTASSERTI(values[i], ==, i);
+    }
+
+    return (0);
+}
+
 static int test_stub(void)
 {
     mock_write_foo(0);
@@ -302,6 +455,9 @@ int main()
         { test_mock_wait_notify, "test_mock_wait_notify" },
         { test_mock_mwrite, "test_mock_mwrite" },
         { test_mock_cwrite, "test_mock_cwrite" },
+        { test_mock_many, "test_mock_many" },
+        { test_mock_ids, "test_mock_ids" },
+        { test_mock_many_entries, "test_mock_many_entries" },
         { test_stub, "test_stub" },
         { NULL, NULL }
     };
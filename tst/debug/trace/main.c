@@ -0,0 +1,358 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#if defined(ARCH_LINUX)
+#    include <stdio.h>
+#endif
+
+static struct sem_t sem;
+
+static THRD_STACK(taker_stack, 1024);
+
+static void *taker_main(void *arg_p)
+{
+    thrd_set_name("taker");
+    sem_take(&sem, NULL);
+    thrd_suspend(NULL);
+
+    return (NULL);
+}
+
+/**
+ * Returns the index of the first record with given event and argument
+ * at or after given index, or -1 if not found.
+ */
+static int find_record(struct trace_record_t *records_p,
+                       int length,
+                       int index,
+                       int event,
+                       void *arg_p)
+{
+    for (; index < length; index++) {
+        if ((records_p[index].event == event)
+            && (records_p[index].arg == (uint32_t)(uintptr_t)arg_p)) {
+            return (index);
+        }
+    }
+
+    return (-1);
+}
+
+static int test_init(void)
+{
+    /* Call init two times. */
+    BTASSERT(trace_module_init() == 0);
+    BTASSERT(trace_module_init() == 0);
+
+    return (0);
+}
+
+static int test_write_read(void)
+{
+    struct trace_record_t records[4];
+    int i;
+
+    /* Nothing is recorded before the trace is started. */
+    TRACE(TRACE_EVENT_USER, 0, 0);
+
+    BTASSERT(trace_start() == 0);
+    BTASSERTI(trace_get_number_of_records(), ==, 0);
+
+    for (i = 0; i < 3; i++) {
+        TRACE(TRACE_EVENT_USER + i, i, 0x1234 + i);
+    }
+
+    BTASSERT(trace_stop() == 0);
+
+    /* Nothing is recorded after the trace is stopped. */
+    TRACE(TRACE_EVENT_USER, 0, 0);
+
+    BTASSERTI(trace_get_number_of_records(), ==, 3);
+    BTASSERTI(trace_get_number_of_overwritten_records(), ==, 0);
+    BTASSERTI(trace_read(&records[0], 0, membersof(records)), ==, 3);
+
+    for (i = 0; i < 3; i++) {
+        BTASSERTI(records[i].event, ==, TRACE_EVENT_USER + i);
+        BTASSERTI(records[i].data, ==, i);
+        BTASSERTI(records[i].arg, ==, 0x1234 + i);
+        BTASSERT(records[i].thrd == (uint32_t)(uintptr_t)thrd_self());
+
+        if (i > 0) {
+            BTASSERT(records[i].timestamp >= records[i - 1].timestamp);
+        }
+    }
+
+    /* Read with an offset. */
+    BTASSERTI(trace_read(&records[0], 2, membersof(records)), ==, 1);
+    BTASSERTI(records[0].data, ==, 2);
+    BTASSERTI(trace_read(&records[0], 5, membersof(records)), ==, 0);
+
+    return (0);
+}
+
+static int test_overwrite(void)
+{
+    struct trace_record_t record;
+    int i;
+
+    BTASSERT(trace_start() == 0);
+
+    for (i = 0; i < CONFIG_TRACE_BUFFER_SIZE + 5; i++) {
+        TRACE(TRACE_EVENT_USER, i, 0);
+    }
+
+    BTASSERT(trace_stop() == 0);
+
+    /* The five oldest records are overwritten. */
+    BTASSERTI(trace_get_number_of_records(), ==, CONFIG_TRACE_BUFFER_SIZE);
+    BTASSERTI(trace_get_number_of_overwritten_records(), ==, 5);
+    BTASSERTI(trace_read(&record, 0, 1), ==, 1);
+    BTASSERTI(record.data, ==, 5);
+    BTASSERTI(trace_read(&record, CONFIG_TRACE_BUFFER_SIZE - 1, 1), ==, 1);
+    BTASSERTI(record.data, ==, CONFIG_TRACE_BUFFER_SIZE + 4);
+
+    /* Starting the trace again clears the buffer. */
+    BTASSERT(trace_start() == 0);
+    BTASSERT(trace_stop() == 0);
+    BTASSERTI(trace_get_number_of_records(), ==, 0);
+
+    return (0);
+}
+
+static int test_sem_wait(void)
+{
+    struct trace_record_t records[CONFIG_TRACE_BUFFER_SIZE];
+    struct thrd_t *taker_p;
+    int length;
+    int wait;
+    int done;
+
+    BTASSERT(sem_init(&sem, 1, 1) == 0);
+    BTASSERT(trace_start() == 0);
+
+    /* The taker has higher priority than this thread and blocks on
+       the semaphore when this thread yields. */
+    taker_p = thrd_spawn(taker_main,
+                         NULL,
+                         -10,
+                         taker_stack,
+                         sizeof(taker_stack));
+    BTASSERT(taker_p != NULL);
+    thrd_yield();
+    BTASSERT(sem_give(&sem, 1) == 0);
+    thrd_yield();
+
+    BTASSERT(trace_stop() == 0);
+
+    length = trace_read(&records[0], 0, membersof(records));
+    BTASSERT(length > 0);
+    BTASSERTI(trace_get_number_of_overwritten_records(), ==, 0);
+
+    /* The taker was scheduled, waited for the semaphore and then got
+       it. */
+    BTASSERT(find_record(&records[0],
+                         length,
+                         0,
+                         TRACE_EVENT_THRD_SWITCH,
+                         taker_p) >= 0);
+    wait = find_record(&records[0],
+                       length,
+                       0,
+                       TRACE_EVENT_SEM_TAKE_WAIT,
+                       &sem);
+    BTASSERT(wait >= 0);
+    BTASSERT(records[wait].thrd == (uint32_t)(uintptr_t)taker_p);
+    done = find_record(&records[0],
+                       length,
+                       wait,
+                       TRACE_EVENT_SEM_TAKE_DONE,
+                       &sem);
+    BTASSERT(done > wait);
+    BTASSERT(records[done].thrd == (uint32_t)(uintptr_t)taker_p);
+    BTASSERTI(records[done].data, ==, 0);
+
+    return (0);
+}
+
+static int test_fs_print(void)
+{
+    char command[64];
+    struct queue_t queue;
+    uint8_t buf[512];
+    int size;
+
+    BTASSERT(queue_init(&queue, &buf[0], sizeof(buf)) == 0);
+
+    strcpy(command, "/debug/trace/start");
+    BTASSERT(fs_call(command, NULL, &queue, NULL) == 0);
+    TRACE(TRACE_EVENT_USER + 3, 7, 0xcafe);
+    strcpy(command, "/debug/trace/stop");
+    BTASSERT(fs_call(command, NULL, &queue, NULL) == 0);
+
+    strcpy(command, "/debug/trace/print");
+    BTASSERT(fs_call(command, NULL, &queue, NULL) == 0);
+    BTASSERT(harness_expect(&queue, "TIMESTAMP  THREAD", NULL) > 0);
+    BTASSERT(harness_expect(&queue,
+                            "main              user+3                 7"
+                            "  0x0000cafe\r\n",
+                            NULL) > 0);
+    BTASSERT(harness_expect(&queue,
+                            "1 record(s), 0 overwritten\r\n",
+                            NULL) > 0);
+
+    /* Tracing is paused while printing and then resumed, without
+       clearing the buffer. */
+    BTASSERT(trace_start() == 0);
+    TRACE(TRACE_EVENT_USER, 1, 2);
+    BTASSERT(trace_print(chan_null()) == 0);
+    BTASSERT(trace_dump(chan_null()) == 0);
+    size = trace_get_number_of_records();
+    BTASSERTI(size, >=, 1);
+    TRACE(TRACE_EVENT_USER, 3, 4);
+    BTASSERTI(trace_get_number_of_records(), ==, size + 1);
+    BTASSERT(trace_stop() == 0);
+
+    return (0);
+}
+
+static int test_fs_dump(void)
+{
+    char command[64];
+    struct queue_t queue;
+    uint8_t buf[1024];
+    struct trace_header_t header;
+    struct trace_record_t record;
+    char name[17];
+    uint32_t i;
+
+    BTASSERT(queue_init(&queue, &buf[0], sizeof(buf)) == 0);
+
+    BTASSERT(trace_start() == 0);
+    TRACE(TRACE_EVENT_USER, 1, 2);
+    BTASSERT(trace_stop() == 0);
+
+    strcpy(command, "/debug/trace/dump");
+    BTASSERT(fs_call(command, NULL, &queue, NULL) == 0);
+
+    BTASSERTI(queue_read(&queue, &header, sizeof(header)),
+              ==,
+              sizeof(header));
+    BTASSERTI(header.magic, ==, TRACE_MAGIC);
+    BTASSERTI(header.version, ==, TRACE_VERSION);
+    BTASSERTI(header.record_size, ==, sizeof(record));
+    BTASSERT(header.number_of_records > 1);
+
+    /* Thread name records first, and the main thread name is found
+       among them. */
+    memset(&name[0], 0, sizeof(name));
+
+    for (i = 0; i < header.number_of_records - 1; i++) {
+        BTASSERTI(queue_read(&queue, &record, sizeof(record)),
+                  ==,
+                  sizeof(record));
+        BTASSERTI(record.event, ==, TRACE_EVENT_THRD_NAME);
+
+        if ((record.thrd == (uint32_t)(uintptr_t)thrd_self())
+            && (record.data < sizeof(name) - 4)) {
+            memcpy(&name[record.data], &record.arg, 4);
+        }
+    }
+
+    BTASSERTM(&name[0], "main", 5);
+
+    /* Then the trace buffer. */
+    BTASSERTI(queue_read(&queue, &record, sizeof(record)),
+              ==,
+              sizeof(record));
+    BTASSERTI(record.event, ==, TRACE_EVENT_USER);
+    BTASSERTI(record.data, ==, 1);
+    BTASSERTI(record.arg, ==, 2);
+    BTASSERTI(queue_size(&queue), ==, 0);
+
+    return (0);
+}
+
+static int test_output_file(void)
+{
+#if defined(ARCH_LINUX)
+    FILE *file_p;
+    struct trace_header_t header;
+    struct trace_record_t record;
+
+    BTASSERT(trace_set_output_file("trace.bin") == 0);
+    BTASSERT(trace_start() == 0);
+    TRACE(TRACE_EVENT_USER, 3, 4);
+    BTASSERT(trace_stop() == 0);
+    BTASSERT(trace_set_output_file(NULL) == 0);
+
+    file_p = fopen("trace.bin", "rb");
+    BTASSERT(file_p != NULL);
+
+    /* The number of records is unknown in a stream. */
+    BTASSERTI(fread(&header, sizeof(header), 1, file_p), ==, 1);
+    BTASSERTI(header.magic, ==, TRACE_MAGIC);
+    BTASSERTI(header.number_of_records, ==, 0);
+
+    /* The user record followed by the thread name records. */
+    BTASSERTI(fread(&record, sizeof(record), 1, file_p), ==, 1);
+    BTASSERTI(record.event, ==, TRACE_EVENT_USER);
+    BTASSERTI(record.data, ==, 3);
+    BTASSERTI(record.arg, ==, 4);
+    BTASSERTI(fread(&record, sizeof(record), 1, file_p), ==, 1);
+    BTASSERTI(record.event, ==, TRACE_EVENT_THRD_NAME);
+
+    fclose(file_p);
+
+    return (0);
+#else
+    return (1);
+#endif
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_write_read, "test_write_read" },
+        { test_overwrite, "test_overwrite" },
+        { test_sem_wait, "test_sem_wait" },
+        { test_fs_print, "test_fs_print" },
+        { test_fs_dump, "test_fs_dump" },
+        { test_output_file, "test_output_file" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -0,0 +1,337 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+static struct can_driver_t can;
+static struct can_frame_t rxbuf[8];
+
+static struct can_subscriber_t subscribers[3];
+static struct can_frame_t subscriber_rxbuf[3][4];
+static struct can_filter_t filters[40];
+
+/**
+ * Initialize given frame. The extended frame bit is taken from given
+ * id, and the id is also written to the payload.
+ */
+static void frame_init(struct can_frame_t *frame_p, uint32_t id)
+{
+    memset(frame_p, 0, sizeof(*frame_p));
+    frame_p->id = (id & ~CAN_ID_EXTENDED);
+    frame_p->extended_frame = ((id & CAN_ID_EXTENDED) != 0);
+    frame_p->size = 4;
+    frame_p->data.u32[0] = id;
+}
+
+static size_t input(uint32_t id)
+{
+    struct can_frame_t frame;
+    size_t res;
+
+    frame_init(&frame, id);
+
+    sys_lock();
+    res = can_input_isr(&can, &frame, 1);
+    sys_unlock();
+
+    return (res);
+}
+
+static int assert_read(struct can_subscriber_t *subscriber_p, uint32_t id)
+{
+    struct can_frame_t frame;
+
+    BTASSERTI(can_subscriber_read(subscriber_p,
+                                  &frame,
+                                  sizeof(frame)), ==, sizeof(frame));
+    BTASSERTI(frame.id, ==, id & ~CAN_ID_EXTENDED);
+    BTASSERTI(frame.extended_frame, ==, (id & CAN_ID_EXTENDED) != 0);
+    BTASSERTI(frame.data.u32[0], ==, id);
+
+    return (0);
+}
+
+static int test_init(void)
+{
+    BTASSERT(can_init(&can,
+                      &can_device[0],
+                      CAN_SPEED_500KBPS,
+                      &rxbuf[0],
+                      sizeof(rxbuf)) == 0);
+    BTASSERT(can_start(&can) == 0);
+
+    BTASSERT(can_subscriber_init(&subscribers[0],
+                                 &subscriber_rxbuf[0][0],
+                                 sizeof(subscriber_rxbuf[0]),
+                                 FSTR("/test/can/0/dropped")) == 0);
+    BTASSERT(can_subscriber_init(&subscribers[1],
+                                 &subscriber_rxbuf[1][0],
+                                 sizeof(subscriber_rxbuf[1]),
+                                 FSTR("/test/can/1/dropped")) == 0);
+    BTASSERT(can_subscriber_init(&subscribers[2],
+                                 &subscriber_rxbuf[2][0],
+                                 sizeof(subscriber_rxbuf[2]),
+                                 FSTR("/test/can/2/dropped")) == 0);
+
+    return (0);
+}
+
+static int test_no_filters(void)
+{
+    struct can_frame_t frame;
+
+    /* All frames are written to the input channel. */
+    BTASSERTI(input(0x123), ==, 1);
+    BTASSERTI(can_read(&can, &frame, sizeof(frame)), ==, sizeof(frame));
+    BTASSERTI(frame.id, ==, 0x123);
+
+    return (0);
+}
+
+static int test_exact(void)
+{
+    int i;
+
+    /* Many filters to get hash collisions. */
+    for (i = 0; i < 40; i++) {
+        BTASSERT(can_filter_init_exact(&filters[i],
+                                       0x100 + 16 * i,
+                                       &subscribers[i % 2]) == 0);
+        BTASSERT(can_filter_add(&can, &filters[i]) == 0);
+    }
+
+    BTASSERTI(input(0x100), ==, 1);
+    BTASSERTI(input(0x110), ==, 1);
+    BTASSERTI(input(0x100 + 16 * 39), ==, 1);
+
+    /* Rejected. */
+    BTASSERTI(input(0x101), ==, 1);
+    BTASSERTI(input(0x7ff), ==, 1);
+
+    BTASSERT(assert_read(&subscribers[0], 0x100) == 0);
+    BTASSERT(assert_read(&subscribers[1], 0x110) == 0);
+    BTASSERT(assert_read(&subscribers[1], 0x100 + 16 * 39) == 0);
+    BTASSERTI(queue_size(&subscribers[0].queue), ==, 0);
+    BTASSERTI(queue_size(&subscribers[1].queue), ==, 0);
+    BTASSERTI(queue_size(&can.chin), ==, 0);
+
+    /* Remove a filter in the middle of a hash chain. */
+    BTASSERT(can_filter_remove(&can, &filters[1]) == 0);
+    BTASSERT(can_filter_remove(&can, &filters[1]) == -ENOENT);
+    BTASSERTI(input(0x110), ==, 1);
+    BTASSERTI(input(0x120), ==, 1);
+    BTASSERT(assert_read(&subscribers[0], 0x120) == 0);
+    BTASSERTI(queue_size(&subscribers[1].queue), ==, 0);
+
+    for (i = 0; i < 40; i++) {
+        if (i != 1) {
+            BTASSERT(can_filter_remove(&can, &filters[i]) == 0);
+        }
+    }
+
+    return (0);
+}
+
+static int test_mask_and_range(void)
+{
+    BTASSERT(can_filter_init_exact(&filters[0], 0x301, &subscribers[2]) == 0);
+    BTASSERT(can_filter_init_mask(&filters[1],
+                                  0x300,
+                                  0x7f0,
+                                  &subscribers[0]) == 0);
+    BTASSERT(can_filter_init_range(&filters[2],
+                                   0x300,
+                                   0x4ff,
+                                   &subscribers[1]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[2]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[1]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[0]) == 0);
+
+    /* Filters already added, and equal filters, are rejected. */
+    BTASSERT(can_filter_add(&can, &filters[0]) == -EEXIST);
+    BTASSERT(can_filter_add(&can, &filters[1]) == -EEXIST);
+    BTASSERT(can_filter_add(&can, &filters[2]) == -EEXIST);
+    BTASSERT(can_filter_init_range(&filters[3],
+                                   0x300,
+                                   0x4ff,
+                                   &subscribers[0]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[3]) == -EEXIST);
+    BTASSERT(can_filter_init_range(&filters[3],
+                                   0x300,
+                                   0x4fe,
+                                   &subscribers[0]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[3]) == 0);
+    BTASSERT(can_filter_remove(&can, &filters[3]) == 0);
+
+    /* Exact filters are evaluated first. */
+    BTASSERTI(input(0x301), ==, 1);
+    BTASSERT(assert_read(&subscribers[2], 0x301) == 0);
+
+    /* The range filter was added before the mask filter. */
+    BTASSERTI(input(0x30f), ==, 1);
+    BTASSERTI(input(0x4ff), ==, 1);
+    BTASSERT(assert_read(&subscribers[1], 0x30f) == 0);
+    BTASSERT(assert_read(&subscribers[1], 0x4ff) == 0);
+
+    BTASSERT(can_filter_remove(&can, &filters[2]) == 0);
+    BTASSERTI(input(0x30f), ==, 1);
+    BTASSERTI(input(0x4ff), ==, 1);
+    BTASSERT(assert_read(&subscribers[0], 0x30f) == 0);
+    BTASSERTI(queue_size(&subscribers[1].queue), ==, 0);
+
+    BTASSERT(can_filter_remove(&can, &filters[1]) == 0);
+    BTASSERT(can_filter_remove(&can, &filters[0]) == 0);
+
+    return (0);
+}
+
+static int test_frame_format(void)
+{
+    /* A standard and an extended frame with the same id go to
+       different subscribers for all filter types. */
+    BTASSERT(can_filter_init_exact(&filters[0],
+                                   0x123,
+                                   &subscribers[0]) == 0);
+    BTASSERT(can_filter_init_exact(&filters[1],
+                                   0x123 | CAN_ID_EXTENDED,
+                                   &subscribers[1]) == 0);
+    BTASSERT(can_filter_init_mask(&filters[2],
+                                  0x200,
+                                  0xf00,
+                                  &subscribers[0]) == 0);
+    BTASSERT(can_filter_init_mask(&filters[3],
+                                  0x200 | CAN_ID_EXTENDED,
+                                  0xf00,
+                                  &subscribers[1]) == 0);
+    BTASSERT(can_filter_init_range(&filters[4],
+                                   0x300,
+                                   0x3ff,
+                                   &subscribers[0]) == 0);
+    BTASSERT(can_filter_init_range(&filters[5],
+                                   0x300 | CAN_ID_EXTENDED,
+                                   0x3ff | CAN_ID_EXTENDED,
+                                   &subscribers[1]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[0]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[1]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[2]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[3]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[4]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[5]) == 0);
+
+    BTASSERTI(input(0x123), ==, 1);
+    BTASSERTI(input(0x123 | CAN_ID_EXTENDED), ==, 1);
+    BTASSERT(assert_read(&subscribers[0], 0x123) == 0);
+    BTASSERT(assert_read(&subscribers[1], 0x123 | CAN_ID_EXTENDED) == 0);
+
+    BTASSERTI(input(0x2ab), ==, 1);
+    BTASSERTI(input(0x2ab | CAN_ID_EXTENDED), ==, 1);
+    BTASSERT(assert_read(&subscribers[0], 0x2ab) == 0);
+    BTASSERT(assert_read(&subscribers[1], 0x2ab | CAN_ID_EXTENDED) == 0);
+
+    BTASSERTI(input(0x3cd), ==, 1);
+    BTASSERTI(input(0x3cd | CAN_ID_EXTENDED), ==, 1);
+    BTASSERT(assert_read(&subscribers[0], 0x3cd) == 0);
+    BTASSERT(assert_read(&subscribers[1], 0x3cd | CAN_ID_EXTENDED) == 0);
+
+    /* An extended 0x123 frame is rejected without the extended exact
+       filter. */
+    BTASSERT(can_filter_remove(&can, &filters[1]) == 0);
+    BTASSERTI(input(0x123 | CAN_ID_EXTENDED), ==, 1);
+    BTASSERTI(queue_size(&subscribers[0].queue), ==, 0);
+    BTASSERTI(queue_size(&subscribers[1].queue), ==, 0);
+
+    BTASSERT(can_filter_remove(&can, &filters[0]) == 0);
+    BTASSERT(can_filter_remove(&can, &filters[2]) == 0);
+    BTASSERT(can_filter_remove(&can, &filters[3]) == 0);
+    BTASSERT(can_filter_remove(&can, &filters[4]) == 0);
+    BTASSERT(can_filter_remove(&can, &filters[5]) == 0);
+
+    return (0);
+}
+
+static int test_dropped(void)
+{
+    struct can_frame_t frames[6];
+    int i;
+
+    BTASSERT(can_filter_init_mask(&filters[0], 0, 0, &subscribers[0]) == 0);
+    BTASSERT(can_filter_add(&can, &filters[0]) == 0);
+
+    for (i = 0; i < 6; i++) {
+        frame_init(&frames[i], i);
+    }
+
+    /* All frames are handled, but only three fit in the subscriber
+       queue. */
+    sys_lock();
+    BTASSERTI(can_input_isr(&can, &frames[0], 6), ==, 6);
+    sys_unlock();
+
+    BTASSERTI(subscribers[0].dropped.value, ==, 3);
+
+    for (i = 0; i < 3; i++) {
+        BTASSERT(assert_read(&subscribers[0], i) == 0);
+    }
+
+    BTASSERT(can_filter_remove(&can, &filters[0]) == 0);
+
+    /* Without filters the input channel limits the number of handled
+       frames. */
+    sys_lock();
+    BTASSERTI(can_input_isr(&can, &frames[0], 6), ==, 6);
+    BTASSERTI(can_input_isr(&can, &frames[0], 6), ==, 1);
+    sys_unlock();
+
+    BTASSERTI(can_read(&can, &frames[0], sizeof(frames)), ==, sizeof(frames));
+    BTASSERTI(queue_size(&can.chin), ==, sizeof(frames[0]));
+    BTASSERTI(can_read(&can, &frames[0], sizeof(frames[0])),
+              ==,
+              sizeof(frames[0]));
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_no_filters, "test_no_filters" },
+        { test_exact, "test_exact" },
+        { test_mask_and_range, "test_mask_and_range" },
+        { test_frame_format, "test_frame_format" },
+        { test_dropped, "test_dropped" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -0,0 +1,321 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+#include "socket_device.h"
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#define TYPE_CAN_DEVICE_REQUEST                           (7)
+#define TYPE_CAN_DEVICE_RESPONSE                          (8)
+#define TYPE_CAN_DEVICE_BINARY_REQUEST                   (11)
+#define TYPE_CAN_DEVICE_BINARY_RESPONSE                  (12)
+
+/* Number of frames written by the writer thread. */
+#define WRITER_FRAMES                                     2000
+
+static struct can_driver_t can;
+static struct can_frame_t rxbuf[8];
+static struct sem_t writer_sem;
+static volatile int writer_errors;
+static THRD_STACK(writer_stack, 1024);
+
+static void frame_init(struct can_frame_t *frame_p,
+                       uint32_t id,
+                       int extended_frame,
+                       int size)
+{
+    int i;
+
+    memset(frame_p, 0, sizeof(*frame_p));
+    frame_p->id = id;
+    frame_p->extended_frame = extended_frame;
+    frame_p->size = size;
+
+    for (i = 0; i < size; i++) {
+        frame_p->data.u8[i] = (id + i);
+    }
+}
+
+static int wait_for_connected(int connected)
+{
+    int i;
+    int res;
+
+    for (i = 0; i < 500; i++) {
+        sys_lock();
+        res = socket_device_is_can_device_connected_isr(&can_device[0]);
+        sys_unlock();
+
+        if (res == connected) {
+            return (0);
+        }
+
+        thrd_sleep_ms(10);
+    }
+
+    return (-ETIMEDOUT);
+}
+
+static ssize_t read_all(int client, void *buf_p, size_t size)
+{
+    ssize_t res;
+    size_t left;
+    uint8_t *u8_p;
+
+    u8_p = buf_p;
+    left = size;
+
+    while (left > 0) {
+        res = read(client, u8_p, left);
+
+        if (res <= 0) {
+            return (-EIO);
+        }
+
+        u8_p += res;
+        left -= res;
+    }
+
+    return (size);
+}
+
+/**
+ * Connect to the socket device and request can device 0 in given
+ * format.
+ */
+static int client_connect(int binary)
+{
+    int client;
+    int i;
+    struct sockaddr_in addr;
+    uint32_t request[3];
+    uint32_t response[3];
+
+    client = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (client < 0) {
+        return (-1);
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(47000);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    /* The listener thread may not be ready yet. */
+    for (i = 0; i < 100; i++) {
+        if (connect(client, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+            break;
+        }
+
+        thrd_sleep_ms(10);
+    }
+
+    if (binary == 1) {
+        request[0] = htonl(TYPE_CAN_DEVICE_BINARY_REQUEST);
+    } else {
+        request[0] = htonl(TYPE_CAN_DEVICE_REQUEST);
+    }
+
+    request[1] = htonl(1);
+    memcpy(&request[2], "0", 2);
+
+    if (write(client, &request[0], 9) != 9) {
+        close(client);
+
+        return (-1);
+    }
+
+    if (read_all(client, &response[0], sizeof(response)) != sizeof(response)) {
+        close(client);
+
+        return (-1);
+    }
+
+    if ((ntohl(response[0]) != (binary == 1
+                                ? TYPE_CAN_DEVICE_BINARY_RESPONSE
+                                : TYPE_CAN_DEVICE_RESPONSE))
+        || (ntohl(response[1]) != 4)
+        || (response[2] != 0)) {
+        close(client);
+
+        return (-1);
+    }
+
+    if (wait_for_connected(1) != 0) {
+        close(client);
+
+        return (-1);
+    }
+
+    return (client);
+}
+
+static void *writer_main(void *arg_p)
+{
+    struct can_frame_t frame;
+    int i;
+
+    thrd_set_name("writer");
+
+    frame_init(&frame, 0x123, 0, 8);
+
+    for (i = 0; i < WRITER_FRAMES; i++) {
+        if (can_write(&can, &frame, sizeof(frame)) != sizeof(frame)) {
+            writer_errors++;
+        }
+    }
+
+    sem_give(&writer_sem, 1);
+    thrd_suspend(NULL);
+
+    return (NULL);
+}
+
+static int test_init(void)
+{
+    BTASSERT(can_init(&can,
+                      &can_device[0],
+                      CAN_SPEED_500KBPS,
+                      &rxbuf[0],
+                      sizeof(rxbuf)) == 0);
+    BTASSERT(can_start(&can) == 0);
+
+    return (0);
+}
+
+static int test_binary(void)
+{
+    int client;
+    struct can_frame_t frames[2];
+    struct can_frame_t frame;
+    uint8_t buf[32];
+    uint8_t expected[] = {
+        /* Standard frame. */
+        7, 0x00, 0x00, 0x01, 0x23, 0x23, 0x24, 0x25,
+        /* Extended frame. */
+        12, 0x92, 0x34, 0x56, 0x78,
+        0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f
+    };
+
+    client = client_connect(1);
+    BTASSERT(client >= 0);
+
+    /* Frames written by the application are sent in binary format. */
+    frame_init(&frames[0], 0x123, 0, 3);
+    frame_init(&frames[1], 0x12345678, 1, 8);
+    BTASSERTI(can_write(&can, &frames[0], sizeof(frames)), ==, sizeof(frames));
+    BTASSERTI(read_all(client, &buf[0], sizeof(expected)),
+              ==,
+              sizeof(expected));
+    BTASSERTM(&buf[0], &expected[0], sizeof(expected));
+
+    /* Binary frames written by the client are input to the
+       driver. */
+    BTASSERTI(write(client, &expected[0], sizeof(expected)),
+              ==,
+              sizeof(expected));
+    BTASSERTI(can_read(&can, &frame, sizeof(frame)), ==, sizeof(frame));
+    BTASSERTI(frame.id, ==, 0x123);
+    BTASSERTI(frame.extended_frame, ==, 0);
+    BTASSERTI(frame.size, ==, 3);
+    BTASSERTM(&frame.data.u8[0], &frames[0].data.u8[0], 3);
+    BTASSERTI(can_read(&can, &frame, sizeof(frame)), ==, sizeof(frame));
+    BTASSERTI(frame.id, ==, 0x12345678);
+    BTASSERTI(frame.extended_frame, ==, 1);
+    BTASSERTI(frame.size, ==, 8);
+    BTASSERTM(&frame.data.u8[0], &frames[1].data.u8[0], 8);
+
+    close(client);
+    BTASSERT(wait_for_connected(0) == 0);
+
+    return (0);
+}
+
+static int test_disconnect_during_write(void)
+{
+    int client;
+    struct can_frame_t frame;
+    char buf[64];
+    char expected[] = "id=00000321,extended=0,size=2,data=2122\r\n";
+
+    client = client_connect(1);
+    BTASSERT(client >= 0);
+
+    /* Disconnect and write frames while the socket device notices
+       the disconnect and closes its socket. All frames are either
+       sent or dropped, and none of them fails. */
+    sem_init(&writer_sem, 1, 1);
+    writer_errors = 0;
+    close(client);
+    BTASSERT(thrd_spawn(writer_main,
+                        NULL,
+                        0,
+                        writer_stack,
+                        sizeof(writer_stack)) != NULL);
+    BTASSERT(sem_take(&writer_sem, NULL) == 0);
+    BTASSERTI(writer_errors, ==, 0);
+    BTASSERT(wait_for_connected(0) == 0);
+
+    /* Frames are dropped while disconnected. */
+    frame_init(&frame, 0x321, 0, 2);
+    BTASSERTI(can_write(&can, &frame, sizeof(frame)), ==, sizeof(frame));
+
+    /* A new client gets frames in its own format. */
+    client = client_connect(0);
+    BTASSERT(client >= 0);
+    BTASSERTI(can_write(&can, &frame, sizeof(frame)), ==, sizeof(frame));
+    BTASSERTI(read_all(client, &buf[0], strlen(expected)),
+              ==,
+              strlen(expected));
+    BTASSERTM(&buf[0], &expected[0], strlen(expected));
+
+    close(client);
+    BTASSERT(wait_for_connected(0) == 0);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_binary, "test_binary" },
+        { test_disconnect_during_write, "test_disconnect_during_write" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
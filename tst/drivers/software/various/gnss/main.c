@@ -149,7 +149,7 @@ static int test_read_rmc(void)
             &queue,
             "Date:                 12:35:19 94-03-23                   (age: 0 seconds)\r\n"
             "Position:             48.117298, -11.516666 degrees       (age: 0 seconds)\r\n"
-            "Speed:                11.522999 m/s                       (age: 0 seconds)\r\n"
+            "Speed:                11.523000 m/s                       (age: 0 seconds)\r\n"
             "Number of satellites: unavailable\r\n"
             "Altitude:             unavailable\r\n",
             NULL), ==, 298);
@@ -214,7 +214,7 @@ static int test_read_gga_glonass(void)
             &queue,
             "Date:                 12:35:19 94-03-23                   (age: 0 seconds)\r\n"
             "Position:             49.117298, 10.516666 degrees        (age: 0 seconds)\r\n"
-            "Speed:                11.522999 m/s                       (age: 0 seconds)\r\n"
+            "Speed:                11.523000 m/s                       (age: 0 seconds)\r\n"
             "Number of satellites: 8                                   (age: 0 seconds)\r\n"
             "Altitude:             545.400024 m                        (age: 0 seconds)\r\n",
             NULL), ==, 380);
@@ -291,8 +291,8 @@ static int test_read_rmc_detailed_time(void)
         harness_expect(
             &queue,
             "Date:                 15:51:13 20-03-13                   (age: 0 seconds)\r\n"
-            "Position:             58.395595, 15.560198 degrees        (age: 0 seconds)\r\n"
-            "Speed:                .000000 m/s                         (age: 0 seconds)\r\n"
+            "Position:             58.395596, 15.560199 degrees        (age: 0 seconds)\r\n"
+            "Speed:                0.000000 m/s                        (age: 0 seconds)\r\n"
             "Number of satellites: 8                                   (age: 0 seconds)\r\n"
             "Altitude:             545.400024 m                        (age: 0 seconds)\r\n",
             NULL), ==, 380);
@@ -831,6 +831,401 @@ static int test_get(void)
     return (0);
 }
 
+static int test_get_index(void)
+{
+    struct json_t json;
+    struct json_tok_t tokens[64];
+    struct json_index_entry_t entries[16];
+    struct json_index_entry_t small_entries[2];
+    struct json_tok_t *foo_p, *fie_p;
+    char js_p[] = "{"
+        "\"foo\":[10, {\"fie\":null, \"fum\":1}],"
+        "\"fo\":2,"
+        "\"true\":null,"
+        "true:null,"
+        "1:null"
+        "}";
+
+    BTASSERT(json_init(&json, tokens, membersof(tokens)) == 0);
+    BTASSERT(json_set_index(&json, entries, membersof(entries)) == 0);
+    BTASSERT(json_parse(&json, js_p, strlen(js_p)) == 17);
+
+    /* Number of descendants. */
+    BTASSERT(tokens[0].num_descendants == 16);
+    BTASSERT(tokens[1].num_descendants == 7);
+    BTASSERT(tokens[2].num_descendants == 6);
+    BTASSERT(tokens[4].num_descendants == 4);
+    BTASSERT(tokens[16].num_descendants == 0);
+
+    /* Get from the root object and a nested object. */
+    foo_p = json_object_get(&json, "foo", json_root(&json));
+    BTASSERT(foo_p == &tokens[2]);
+    BTASSERT(json_object_get(&json, "fo", json_root(&json)) == &tokens[10]);
+    BTASSERT(json_object_get(&json, "true", json_root(&json)) == &tokens[12]);
+    BTASSERT(json_object_get_primitive(&json, "true", json_root(&json))
+             == &tokens[14]);
+    BTASSERT(json_object_get_primitive(&json, "1", json_root(&json))
+             == &tokens[16]);
+    BTASSERT(json_object_get(&json, "1", json_root(&json)) == NULL);
+    BTASSERT(json_object_get(&json, "f", json_root(&json)) == NULL);
+    BTASSERT(json_object_get(&json, "fie", json_root(&json)) == NULL);
+
+    fie_p = json_object_get(&json, "fie", json_array_get(&json, 1, foo_p));
+    BTASSERT(fie_p == &tokens[6]);
+    BTASSERT(json_object_get(&json,
+                             "fum",
+                             json_array_get(&json, 1, foo_p)) == &tokens[8]);
+
+    /* Array elements in any order. */
+    BTASSERT(json_array_get(&json, 0, foo_p) == &tokens[3]);
+    BTASSERT(json_array_get(&json, 1, foo_p) == &tokens[4]);
+    BTASSERT(json_array_get(&json, 0, foo_p) == &tokens[3]);
+    BTASSERT(json_array_get(&json, 2, foo_p) == NULL);
+    BTASSERT(json_array_get(&json, 1, foo_p) == &tokens[4]);
+
+    /* Too small index falls back to walking the keys. */
+    BTASSERT(json_set_index(&json,
+                            small_entries,
+                            membersof(small_entries)) == 0);
+    BTASSERT(json_object_get(&json, "fo", json_root(&json)) == &tokens[10]);
+    BTASSERT(json_object_get(&json, "fum", json_root(&json)) == NULL);
+
+    /* No index after a failed parse. */
+    BTASSERT(json_init(&json, tokens, membersof(tokens)) == 0);
+    BTASSERT(json_set_index(&json, entries, membersof(entries)) == 0);
+    BTASSERT(json_parse(&json, js_p, 10) == JSON_ERROR_PART);
+    BTASSERT(json_object_get(&json, "foo", json_root(&json)) == &tokens[2]);
+    BTASSERT(json.index.state == -1);
+
+    return (0);
+}
+
+/**
+ * Create a configuration like document with given number of entries.
+ */
+struct events_t {
+    char buf[1024];
+    size_t pos;
+};
+
+static int on_event(void *arg_p,
+                    enum json_event_t event,
+                    const char *path_p,
+                    const char *buf_p,
+                    size_t size)
+{
+    struct events_t *events_p;
+    static const char *names[] = {
+        "ob", "oe", "ab", "ae", "s", "sp", "p"
+    };
+
+    events_p = arg_p;
+    events_p->pos += std_snprintf(&events_p->buf[events_p->pos],
+                                  sizeof(events_p->buf) - events_p->pos,
+                                  FSTR("%s %s"),
+                                  names[event],
+                                  path_p);
+
+    if (buf_p != NULL) {
+        events_p->pos += std_snprintf(&events_p->buf[events_p->pos],
+                                      sizeof(events_p->buf) - events_p->pos,
+                                      FSTR(" "));
+        memcpy(&events_p->buf[events_p->pos], buf_p, size);
+        events_p->pos += size;
+    }
+
+    events_p->buf[events_p->pos++] = ';';
+    events_p->buf[events_p->pos] = '\0';
+
+    return (0);
+}
+
+static int test_reader(void)
+{
+    struct json_reader_t reader;
+    struct events_t events;
+    char buf[8];
+    int i;
+    const char *js_p;
+    const char *expected_p;
+
+    js_p = "{\"a\":[1, true,{\"b/c\":\"hello\"}], \"d\" : null,"
+        "\"e\":\"a longer \\\"string\\\"\",\"f\":{},\"g\":[]} garbage";
+    expected_p =
+        "ob ;"
+        "ab /a;"
+        "p /a/0 1;"
+        "p /a/1 true;"
+        "ob /a/2;"
+        "s /a/2/b~1c hello;"
+        "oe /a/2;"
+        "ae /a;"
+        "p /d null;"
+        "sp /e a longer;"
+        "sp /e  \\\"strin;"
+        "s /e g\\\";"
+        "ob /f;"
+        "oe /f;"
+        "ab /g;"
+        "ae /g;"
+        "oe ;";
+
+    /* Whole document in one chunk. */
+    events.pos = 0;
+    BTASSERT(json_reader_init(&reader,
+                              &buf[0],
+                              sizeof(buf),
+                              on_event,
+                              &events) == 0);
+    BTASSERT(json_reader_feed(&reader, js_p, strlen(js_p)) == 1);
+    BTASSERT(strcmp(&events.buf[0], expected_p) == 0);
+
+    /* One byte at a time. */
+    events.pos = 0;
+    BTASSERT(json_reader_init(&reader,
+                              &buf[0],
+                              sizeof(buf),
+                              on_event,
+                              &events) == 0);
+
+    for (i = 0; i < 82; i++) {
+        BTASSERT(json_reader_feed(&reader, &js_p[i], 1) == 0);
+    }
+
+    BTASSERT(json_reader_feed(&reader, &js_p[i], strlen(js_p) - i) == 1);
+    BTASSERT(strcmp(&events.buf[0], expected_p) == 0);
+
+    /* A top level array. */
+    events.pos = 0;
+    BTASSERT(json_reader_init(&reader,
+                              &buf[0],
+                              sizeof(buf),
+                              on_event,
+                              &events) == 0);
+    BTASSERT(json_reader_feed(&reader, "[[1],2", 6) == 0);
+    BTASSERT(json_reader_feed(&reader, "]", 1) == 1);
+    BTASSERT(strcmp(&events.buf[0],
+                    "ab ;ab /0;p /0/0 1;ae /0;p /1 2;ae ;") == 0);
+
+    return (0);
+}
+
+static int test_reader_errors(void)
+{
+    struct json_reader_t reader;
+    struct events_t events;
+    char buf[4];
+    int i;
+    const char *inputs[] = {
+        "{1:2}",
+        "[1}",
+        "{\"a\"1}",
+        "{\"a\":1]",
+        "[,1]",
+        "[\"\\x\"]",
+        "]",
+        "[1,\x01]"
+    };
+
+    for (i = 0; i < membersof(inputs); i++) {
+        events.pos = 0;
+        BTASSERT(json_reader_init(&reader,
+                                  &buf[0],
+                                  sizeof(buf),
+                                  on_event,
+                                  &events) == 0);
+        BTASSERT(json_reader_feed(&reader,
+                                  inputs[i],
+                                  strlen(inputs[i])) == JSON_ERROR_INVAL);
+        BTASSERT(json_reader_feed(&reader, "}", 1) == JSON_ERROR_INVAL);
+    }
+
+    /* Too long primitive. */
+    BTASSERT(json_reader_init(&reader,
+                              &buf[0],
+                              sizeof(buf),
+                              on_event,
+                              &events) == 0);
+    BTASSERT(json_reader_feed(&reader, "[12345]", 7) == JSON_ERROR_NOMEM);
+
+    /* Too deep. */
+    BTASSERT(json_reader_init(&reader,
+                              &buf[0],
+                              sizeof(buf),
+                              on_event,
+                              &events) == 0);
+    BTASSERT(json_reader_feed(&reader,
+                              "[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[",
+                              40) == JSON_ERROR_NOMEM);
+
+    return (0);
+}
+
+static int test_reader_read(void)
+{
+    struct json_reader_t reader;
+    struct events_t events;
+    char buf[8];
+    const char *js_p;
+
+    js_p = "{\"id\":5}xy";
+    BTASSERT(chan_write(&qout, js_p, 10) == 10);
+
+    events.pos = 0;
+    BTASSERT(json_reader_init(&reader,
+                              &buf[0],
+                              sizeof(buf),
+                              on_event,
+                              &events) == 0);
+    BTASSERT(json_reader_read(&reader, &qout, 5) == 0);
+    BTASSERT(json_reader_read(&reader, &qout, 5) == 1);
+    BTASSERT(queue_size(&qout) == 0);
+    BTASSERT(strcmp(&events.buf[0], "ob ;p /id 5;oe ;") == 0);
+
+    return (0);
+}
+
+static int test_path_match(void)
+{
+    BTASSERT(json_path_match("", "") == 1);
+    BTASSERT(json_path_match("/a", "/a") == 1);
+    BTASSERT(json_path_match("/a/+/c", "/a/0/c") == 1);
+    BTASSERT(json_path_match("/a/+/c", "/a/bb/c") == 1);
+    BTASSERT(json_path_match("/+", "/") == 1);
+    BTASSERT(json_path_match("/a/+", "/a/b/c") == 0);
+    BTASSERT(json_path_match("/a/+/c", "/a/b") == 0);
+    BTASSERT(json_path_match("/a", "/ab") == 0);
+    BTASSERT(json_path_match("/ab", "/a") == 0);
+    BTASSERT(json_path_match("/a+", "/ab") == 0);
+    BTASSERT(json_path_match("", "/a") == 0);
+
+    return (0);
+}
+
+static int test_writer(void)
+{
+    struct json_writer_t writer;
+    char buf[128];
+    ssize_t size;
+
+    BTASSERT(json_writer_init(&writer, &qout) == 0);
+    BTASSERT(json_writer_object_begin(&writer) == 0);
+    BTASSERT(json_writer_key(&writer, "a") == 0);
+    BTASSERT(json_writer_array_begin(&writer) == 0);
+    BTASSERT(json_writer_integer(&writer, -15) == 0);
+    BTASSERT(json_writer_primitive(&writer, "true") == 0);
+    BTASSERT(json_writer_object_begin(&writer) == 0);
+    BTASSERT(json_writer_object_end(&writer) == 0);
+    BTASSERT(json_writer_array_end(&writer) == 0);
+    BTASSERT(json_writer_key(&writer, "b\"") == 0);
+    BTASSERT(json_writer_string(&writer, "x\\y\n\x01z") == 0);
+    BTASSERT(json_writer_object_end(&writer) == 0);
+    BTASSERT(json_writer_object_end(&writer) == -EINVAL);
+
+    size = queue_size(&qout);
+    BTASSERT(size == 41);
+    BTASSERT(queue_read(&qout, &buf[0], size) == size);
+    buf[size] = '\0';
+    BTASSERT(strcmp(&buf[0],
+                    "{\"a\":[-15,true,{}],\"b\\\"\":\"x\\\\y\\n\\u0001z\"}")
+             == 0);
+
+    return (0);
+}
+
+static int test_writer_top_level(void)
+{
+    struct json_writer_t writer;
+    char buf[16];
+
+    /* A single primitive. */
+    BTASSERT(json_writer_init(&writer, &qout) == 0);
+    BTASSERT(json_writer_integer(&writer, 5) == 0);
+    BTASSERT(json_writer_primitive(&writer, "true") == -EINVAL);
+    BTASSERT(json_writer_object_begin(&writer) == -EINVAL);
+    BTASSERT(queue_size(&qout) == 1);
+    BTASSERT(queue_read(&qout, &buf[0], 1) == 1);
+    BTASSERT(buf[0] == '5');
+
+    /* A single string. */
+    BTASSERT(json_writer_init(&writer, &qout) == 0);
+    BTASSERT(json_writer_string(&writer, "a") == 0);
+    BTASSERT(json_writer_string(&writer, "b") == -EINVAL);
+    BTASSERT(queue_size(&qout) == 3);
+    BTASSERT(queue_read(&qout, &buf[0], 3) == 3);
+    BTASSERT(memcmp(&buf[0], "\"a\"", 3) == 0);
+
+    return (0);
+}
+
+static int test_writer_invalid(void)
+{
+    struct json_writer_t writer;
+    char buf[16];
+    ssize_t size;
+
+    BTASSERT(json_writer_init(&writer, &qout) == 0);
+
+    /* No key outside of an object. */
+    BTASSERT(json_writer_key(&writer, "a") == -EINVAL);
+    BTASSERT(json_writer_array_begin(&writer) == 0);
+    BTASSERT(json_writer_key(&writer, "a") == -EINVAL);
+    BTASSERT(json_writer_object_end(&writer) == -EINVAL);
+
+    /* A value in an object needs a key. */
+    BTASSERT(json_writer_object_begin(&writer) == 0);
+    BTASSERT(json_writer_integer(&writer, 1) == -EINVAL);
+    BTASSERT(json_writer_array_end(&writer) == -EINVAL);
+    BTASSERT(json_writer_key(&writer, "b") == 0);
+
+    /* A key needs a value before the next key or the end. */
+    BTASSERT(json_writer_key(&writer, "c") == -EINVAL);
+    BTASSERT(json_writer_object_end(&writer) == -EINVAL);
+    BTASSERT(json_writer_integer(&writer, 2) == 0);
+    BTASSERT(json_writer_object_end(&writer) == 0);
+    BTASSERT(json_writer_array_end(&writer) == 0);
+    BTASSERT(json_writer_array_end(&writer) == -EINVAL);
+
+    /* Nothing is written by failing calls. */
+    size = queue_size(&qout);
+    BTASSERT(size == 9);
+    BTASSERT(queue_read(&qout, &buf[0], size) == size);
+    buf[size] = '\0';
+    BTASSERT(strcmp(&buf[0], "[{\"b\":2}]") == 0);
+
+    return (0);
+}
+
+static int test_writer_long_key(void)
+{
+    struct json_writer_t writer;
+    struct queue_t queue;
+    char queuebuf[256];
+    char key[201];
+    char buf[256];
+    ssize_t size;
+
+    memset(&key[0], 'k', sizeof(key) - 1);
+    key[sizeof(key) - 1] = '\0';
+    BTASSERT(queue_init(&queue, &queuebuf[0], sizeof(queuebuf)) == 0);
+
+    BTASSERT(json_writer_init(&writer, &queue) == 0);
+    BTASSERT(json_writer_object_begin(&writer) == 0);
+    BTASSERT(json_writer_key(&writer, &key[0]) == 0);
+    BTASSERT(json_writer_primitive(&writer, "true") == 0);
+    BTASSERT(json_writer_object_end(&writer) == 0);
+
+    size = queue_size(&queue);
+    BTASSERT(size == 209);
+    BTASSERT(queue_read(&queue, &buf[0], size) == size);
+    BTASSERT(buf[0] == '{');
+    BTASSERT(buf[1] == '"');
+    BTASSERT(memcmp(&buf[2], &key[0], 200) == 0);
+    BTASSERT(memcmp(&buf[202], "\":true}", 7) == 0);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -852,6 +1247,15 @@ int main()
         { test_dumps_fail, "test_dumps_fail" },
         { test_dump, "test_dump" },
         { test_get, "test_get" },
+        { test_get_index, "test_get_index" },
+        { test_reader, "test_reader" },
+        { test_reader_errors, "test_reader_errors" },
+        { test_reader_read, "test_reader_read" },
+        { test_path_match, "test_path_match" },
+        { test_writer, "test_writer" },
+        { test_writer_top_level, "test_writer_top_level" },
+        { test_writer_invalid, "test_writer_invalid" },
+        { test_writer_long_key, "test_writer_long_key" },
         { NULL, NULL }
     };
 
@@ -872,6 +872,68 @@ static int test_cwd(void)
 #endif
 }
 
+static int many_commands_index;
+
+static int tmp_many(int argc,
+                    const char *argv[],
+                    void *out_p,
+                    void *in_p,
+                    void *arg_p,
+                    void *call_arg_p)
+{
+    many_commands_index = *(int *)arg_p;
+
+    return (0);
+}
+
+static int test_many_commands(void)
+{
+    static struct fs_command_t commands[64];
+    static char paths[64][16];
+    static int indices[64];
+    char buf[384];
+    int i;
+    int j;
+
+    /* Register commands in non-alphabetical order. */
+    for (i = 0; i < 64; i++) {
+        j = ((i * 37) % 64);
+        std_sprintf(&paths[j][0], FSTR("/many/%02d"), j);
+        indices[j] = j;
+        BTASSERT(fs_command_init(&commands[j],
+                                 &paths[j][0],
+                                 tmp_many,
+                                 &indices[j]) == 0);
+        BTASSERT(fs_command_register(&commands[j]) == 0);
+    }
+
+    /* Every command is found, with and without leading slash. */
+    for (i = 0; i < 64; i++) {
+        std_sprintf(&buf[0], FSTR("%s"), &paths[i][i % 2]);
+        many_commands_index = -1;
+        BTASSERT(fs_call(buf, NULL, &qout, NULL) == 0);
+        BTASSERTI(many_commands_index, ==, i);
+    }
+
+    strcpy(buf, "/many/64");
+    BTASSERT(fs_call(buf, NULL, &qout, NULL) == -ENOCOMMAND);
+    BTASSERT(harness_expect(&qout, "\n", NULL) > 0);
+
+    /* Still listed in alphabetical order. */
+    BTASSERT(fs_list("/many", "0", &qout) == 0);
+    BTASSERT(harness_expect(&qout,
+                            "00\r\n01\r\n02\r\n03\r\n04\r\n"
+                            "05\r\n06\r\n07\r\n08\r\n09\r\n",
+                            NULL) > 0);
+
+    /* Other commands are still found. */
+    strcpy(buf, "/our/parameter");
+    BTASSERT(fs_call(buf, NULL, &qout, NULL) == 0);
+    BTASSERT(harness_expect(&qout, "3\r\n", NULL) > 0);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -891,6 +953,7 @@ int main()
         { test_filesystem_commands, "test_filesystem_commands" },
         { test_read_line, "test_read_line" },
         { test_cwd, "test_cwd" },
+        { test_many_commands, "test_many_commands" },
         { NULL, NULL }
     };
 
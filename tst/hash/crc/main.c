@@ -97,6 +97,103 @@ static int test_crc_8(void)
     return (0);
 }
 
+/**
+ * Bit by bit reference implementation of crc_32().
+ */
+static uint32_t reference_crc_32(uint32_t crc, const uint8_t *buf_p, size_t size)
+{
+    int i;
+
+    crc = ~crc;
+
+    while (size--) {
+        crc ^= *buf_p++;
+
+        for (i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (0xedb88320 & (-(crc & 1)));
+        }
+    }
+
+    return (~crc);
+}
+
+/**
+ * Bit by bit reference implementation of crc_ccitt().
+ */
+static uint16_t reference_crc_ccitt(uint16_t crc,
+                                    const uint8_t *buf_p,
+                                    size_t size)
+{
+    int i;
+
+    while (size--) {
+        crc ^= (*buf_p++ << 8);
+
+        for (i = 0; i < 8; i++) {
+            crc = (crc << 1) ^ (0x1021 & (-(crc >> 15)));
+        }
+    }
+
+    return (crc);
+}
+
+static void fill(uint8_t *buf_p, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        buf_p[i] = (i * 131 + (i >> 8));
+    }
+}
+
+static int test_crc_lengths(void)
+{
+    static uint8_t buf[600];
+    size_t offset;
+    size_t size;
+
+    fill(&buf[0], sizeof(buf));
+
+    /* All table slices and hardware paths with and without trailing
+       bytes. */
+    for (offset = 0; offset < 8; offset++) {
+        for (size = 0; size < sizeof(buf) - 8; size += 7) {
+            BTASSERT(crc_32(0, &buf[offset], size)
+                     == reference_crc_32(0, &buf[offset], size));
+            BTASSERT(crc_32(0x12345678, &buf[offset], size)
+                     == reference_crc_32(0x12345678, &buf[offset], size));
+            BTASSERT(crc_ccitt(0xffff, &buf[offset], size)
+                     == reference_crc_ccitt(0xffff, &buf[offset], size));
+        }
+    }
+
+    return (0);
+}
+
+static int test_crc_combine(void)
+{
+    char string[] = "The quick brown fox jumps over the lazy dog";
+    uint32_t crc_1;
+    uint32_t crc_2;
+    uint16_t xmodem_1;
+    uint16_t xmodem_2;
+    size_t size;
+
+    size = strlen(string);
+
+    crc_1 = crc_32(0, string, 10);
+    crc_2 = crc_32(0, &string[10], size - 10);
+    BTASSERT(crc_32_combine(crc_1, crc_2, size - 10) == 0x414fa339);
+    BTASSERT(crc_32_combine(crc_1, 0, 0) == crc_1);
+
+    xmodem_1 = crc_xmodem(0x0000, "12345", 5);
+    xmodem_2 = crc_xmodem(0x0000, "6789", 4);
+    BTASSERT(crc_xmodem_combine(xmodem_1, xmodem_2, 4) == 0x31c3);
+    BTASSERT(crc_xmodem_combine(xmodem_1, 0, 0) == xmodem_1);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -105,6 +202,8 @@ int main()
         { test_crc_xmodem, "test_crc_xmodem" },
         { test_crc_7, "test_crc_7" },
         { test_crc_8, "test_crc_8" },
+        { test_crc_lengths, "test_crc_lengths" },
+        { test_crc_combine, "test_crc_combine" },
         { NULL, NULL }
     };
 
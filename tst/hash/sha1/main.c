@@ -116,10 +116,85 @@ int test_sha1(void)
     return (0);
 }
 
+static void fill(uint8_t *buf_p, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        buf_p[i] = (i * 131 + (i >> 8));
+    }
+}
+
+static int test_split(void)
+{
+    static uint8_t buf[1001];
+    struct sha1_t foo;
+    uint8_t hash[20];
+    size_t offset;
+
+    fill(&buf[1], sizeof(buf) - 1);
+
+    /* Full blocks are hashed directly from the input buffer, aligned
+       or not. */
+    for (offset = 0; offset < sizeof(buf) - 1; offset += 13) {
+        BTASSERT(sha1_init(&foo) == 0);
+        BTASSERT(sha1_update(&foo, &buf[1], offset) == 0);
+        BTASSERT(sha1_update(&foo,
+                               &buf[1 + offset],
+                               sizeof(buf) - 1 - offset) == 0);
+        BTASSERT(sha1_digest(&foo, hash) == 0);
+        BTASSERT(memcmp(hash,
+                        "\xde\xdb\x4e\x34\x4b\xa4\x03\x13\xd0\xc1"
+                        "\xde\x47\xa5\x7d\x00\xc3\xe3\x36\x7b\xcb",
+                        20) == 0);
+    }
+
+    return (0);
+}
+
+static int test_multi(void)
+{
+    static uint8_t buf[1200];
+    static const size_t sizes[] = {
+        1000, 1001, 999, 1000, 200, 0, 64, 63, 129
+    };
+    const void *bufs[membersof(sizes)];
+    uint8_t hashes[membersof(sizes)][20];
+    struct sha1_t foo;
+    uint8_t hash[20];
+    size_t i;
+
+    fill(&buf[0], sizeof(buf));
+
+    /* Unaligned buffers of various sizes, in groups of four. */
+    for (i = 0; i < membersof(sizes); i++) {
+        bufs[i] = &buf[i * 7 + 1];
+    }
+
+    BTASSERT(sha1_digest_multi(&bufs[0],
+                               &sizes[0],
+                               membersof(sizes),
+                               &hashes[0][0]) == 0);
+
+    for (i = 0; i < membersof(sizes); i++) {
+        BTASSERT(sha1_init(&foo) == 0);
+        BTASSERT(sha1_update(&foo, (void *)bufs[i], sizes[i]) == 0);
+        BTASSERT(sha1_digest(&foo, hash) == 0);
+        BTASSERTM(&hashes[i][0], &hash[0], 20);
+    }
+
+    /* No buffers. */
+    BTASSERT(sha1_digest_multi(&bufs[0], &sizes[0], 0, &hashes[0][0]) == 0);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
         { test_sha1, "test_sha1" },
+        { test_split, "test_split" },
+        { test_multi, "test_multi" },
         { NULL, NULL }
     };
 
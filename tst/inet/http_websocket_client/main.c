@@ -47,7 +47,7 @@ static int test_connect(void)
     socket_stub_init();
 
     BTASSERT(http_websocket_client_init(&foo,
-                                        "localhost",
+                                        "127.0.0.1",
                                         8090,
                                         "/") == 0);
 
@@ -62,7 +62,7 @@ static int test_connect(void)
     /* Verify the output data. */
     str_p =
         "GET / HTTP/1.1\r\n"
-        "Host: localhost\r\n"
+        "Host: 127.0.0.1\r\n"
         "Upgrade: WebSocket\r\n"
         "Connection: Upgrade\r\n"
         "Origin: SimbaWebSocketClient\r\n"
@@ -137,6 +137,25 @@ static int test_read(void)
     BTASSERT(buf[1] == 'i');
     BTASSERT(buf[2] == 'e');
 
+    /* Masked data spanning two frames. */
+    buf[0] = 0x01; /* TEXT. */
+    buf[1] = 0x82; /* MASK and 2 bytes payload. */
+    buf[2] = 0x01; /* Masking key 0. */
+    buf[3] = 0x02; /* Masking key 1. */
+    buf[4] = 0x03; /* Masking key 2. */
+    buf[5] = 0x04; /* Masking key 3. */
+    buf[6] = 'g'; /* Payload 0. */
+    buf[7] = 'm'; /* Payload 1. */
+    buf[8] = 0x80; /* FIN & CONTINUATION. */
+    buf[9] = 0x03; /* 3 bytes payload. */
+    buf[10] = 'b'; /* Payload 0. */
+    buf[11] = 'a'; /* Payload 1. */
+    buf[12] = 'r'; /* Payload 2. */
+    socket_stub_input(buf, 13);
+
+    BTASSERT(http_websocket_client_read(&foo, buf, 5) == 5);
+    BTASSERTM(&buf[0], "fobar", 5);
+
     return (0);
 }
 
@@ -224,6 +224,95 @@ static int test_read(void)
     return (0);
 }
 
+static int test_read_chunks(void)
+{
+    static const uint8_t masking_key_1[4] = { 0x11, 0x22, 0x33, 0x44 };
+    static const uint8_t masking_key_2[4] = { 0xa5, 0x5a, 0x0f, 0xf0 };
+    uint8_t chunk[16];
+    int type;
+    int i;
+    size_t pos;
+    ssize_t res;
+
+    /* A fragmented binary message with 37 bytes of payload in the
+       first frame and 150 bytes in the continuation frame. */
+    buf[0] = 0x02; /* BINARY. */
+    buf[1] = (0x80 | 37); /* MASK and 1 byte payload length. */
+    memcpy(&buf[2], &masking_key_1[0], 4);
+
+    for (i = 0; i < 37; i++) {
+        buf[6 + i] = (i ^ masking_key_1[i % 4]);
+    }
+
+    socket_stub_input(buf, 6 + 37);
+
+    buf[0] = 0x80; /* FIN & CONTINUATION. */
+    buf[1] = 0xfe; /* MASK and 2 bytes payload length. */
+    buf[2] = 0x00;
+    buf[3] = 150;
+    memcpy(&buf[4], &masking_key_2[0], 4);
+
+    for (i = 0; i < 150; i++) {
+        buf[8 + i] = ((37 + i) ^ masking_key_2[i % 4]);
+    }
+
+    socket_stub_input(buf, 8 + 150);
+
+    BTASSERT(http_websocket_server_read_begin(&server, &type) == 0);
+    BTASSERT(type == HTTP_TYPE_BINARY);
+
+    /* Read the payload in odd sized chunks. */
+    pos = 0;
+
+    while (1) {
+        res = http_websocket_server_read_chunk(&server, &chunk[1], 15);
+        BTASSERT(res >= 0);
+
+        if (res == 0) {
+            break;
+        }
+
+        for (i = 0; i < res; i++) {
+            BTASSERT(chunk[1 + i] == ((pos + i) & 0xff));
+        }
+
+        pos += res;
+    }
+
+    BTASSERT(pos == 37 + 150);
+    BTASSERT(http_websocket_server_read_end(&server) == 0);
+
+    /* Read part of a message and discard the rest. */
+    buf[0] = 0x81; /* FIN & TEXT. */
+    buf[1] = 0x7e; /* 2 bytes payload length. */
+    buf[2] = 0x00;
+    buf[3] = 200;
+    memset(&buf[4], 'a', 200);
+    socket_stub_input(buf, 4 + 200);
+
+    buf[0] = 0x81; /* FIN & TEXT. */
+    buf[1] = 0x03; /* 3 bytes payload. */
+    buf[2] = 'b';
+    buf[3] = 'a';
+    buf[4] = 'r';
+    socket_stub_input(buf, 5);
+
+    BTASSERT(http_websocket_server_read_begin(&server, &type) == 0);
+    BTASSERT(type == HTTP_TYPE_TEXT);
+    BTASSERT(http_websocket_server_read_chunk(&server, &chunk[0], 5) == 5);
+    BTASSERTM(&chunk[0], "aaaaa", 5);
+    BTASSERT(http_websocket_server_read_end(&server) == 0);
+
+    BTASSERT(http_websocket_server_read(&server,
+                                        &type,
+                                        buf,
+                                        sizeof(buf)) == 3);
+    BTASSERT(type == HTTP_TYPE_TEXT);
+    BTASSERTM(&buf[0], "bar", 3);
+
+    return (0);
+}
+
 static int test_write(void)
 {
     buf[0] = 'f';
@@ -302,6 +391,7 @@ int main()
         { test_handshake_key_missing, "test_handshake_key_missing" },
         { test_handshake_bad_action, "test_handshake_bad_action" },
         { test_read, "test_read" },
+        { test_read_chunks, "test_read_chunks" },
         { test_write, "test_write" },
         { NULL, NULL }
     };
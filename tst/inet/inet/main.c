@@ -77,12 +77,68 @@ static int test_inet_checksum(void)
     return (0);
 }
 
+static int test_http_websocket_mask(void)
+{
+    static const uint8_t masking_key[4] = { 0x12, 0x34, 0x56, 0x78 };
+    static const uint8_t zero_masking_key[4] = { 0x00, 0x00, 0x00, 0x00 };
+    uint8_t buf[64];
+    uint8_t expected[64];
+    size_t offset;
+    size_t size;
+    size_t i;
+    int alignment;
+
+    /* All combinations of alignment, offset and size around the
+       word size are compared to byte by byte masking. */
+    for (alignment = 0; alignment < 8; alignment++) {
+        for (offset = 0; offset < 4; offset++) {
+            for (size = 0; size < 48; size++) {
+                for (i = 0; i < size; i++) {
+                    buf[alignment + i] = (3 * i + size);
+                    expected[alignment + i] =
+                        ((3 * i + size) ^ masking_key[(offset + i) % 4]);
+                }
+
+                inet_http_websocket_mask(&buf[alignment],
+                                         size,
+                                         &masking_key[0],
+                                         offset);
+                BTASSERTM(&buf[alignment], &expected[alignment], size);
+            }
+        }
+    }
+
+    /* Masking twice gives the original data. */
+    for (i = 0; i < sizeof(buf); i++) {
+        buf[i] = i;
+    }
+
+    inet_http_websocket_mask(&buf[1], 50, &masking_key[0], 3);
+    BTASSERT(buf[1] != 1);
+    inet_http_websocket_mask(&buf[1], 20, &masking_key[0], 3);
+    inet_http_websocket_mask(&buf[21], 30, &masking_key[0], 23);
+
+    for (i = 0; i < sizeof(buf); i++) {
+        BTASSERT(buf[i] == i);
+    }
+
+    /* The all zeros key. */
+    inet_http_websocket_mask(&buf[0], sizeof(buf), &zero_masking_key[0], 0);
+
+    for (i = 0; i < sizeof(buf); i++) {
+        BTASSERT(buf[i] == i);
+    }
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
         { test_aton, "test_aton" },
         { test_ntoa, "test_ntoa" },
         { test_inet_checksum, "test_inet_checksum" },
+        { test_http_websocket_mask, "test_http_websocket_mask" },
         { NULL, NULL }
     };
 
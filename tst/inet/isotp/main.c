@@ -460,6 +460,358 @@ static int test_output_multi_frame_unexpected_non_flow_control(
     return (0);
 }
 
+#if CONFIG_ISOTP_CHANNEL == 1
+
+struct writer_t {
+    struct isotp_channel_t *channel_p;
+    const uint8_t *buf_p;
+    size_t size;
+    struct queue_t responses;
+    ssize_t responses_buf[2];
+    struct sem_t sem;
+    THRD_STACK(stack, 4096);
+};
+
+struct reader_t {
+    struct isotp_channel_t *channel_p;
+    uint8_t *buf_p;
+    size_t size;
+    struct queue_t responses;
+    ssize_t responses_buf[2];
+    struct sem_t sem;
+    THRD_STACK(stack, 4096);
+};
+
+static struct can_driver_t can;
+static struct can_frame_t can_rxbuf[8];
+static struct isotp_channel_t channels[4];
+static struct can_frame_t channels_rxbuf[4][5];
+static struct writer_t writers[2];
+static struct reader_t reader;
+static uint8_t message[5000];
+static uint8_t buf[5000];
+static int flow_control_frames;
+
+/**
+ * Loop back all written frames to the driver input.
+ */
+ssize_t STUB(can_write)(struct can_driver_t *self_p,
+                        const struct can_frame_t *frame_p,
+                        size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size / sizeof(*frame_p); i++) {
+        if ((frame_p[i].data.u8[0] >> 4) == 3) {
+            flow_control_frames++;
+        }
+    }
+
+    sys_lock();
+    can_input_isr(self_p, frame_p, size / sizeof(*frame_p));
+    sys_unlock();
+
+    return (size);
+}
+
+static void *writer_main(void *arg_p)
+{
+    struct writer_t *self_p;
+    ssize_t res;
+
+    self_p = arg_p;
+
+    while (1) {
+        sem_take(&self_p->sem, NULL);
+        res = isotp_channel_write(self_p->channel_p,
+                                  self_p->buf_p,
+                                  self_p->size);
+        queue_write(&self_p->responses, &res, sizeof(res));
+    }
+
+    return (NULL);
+}
+
+static void write_start(struct writer_t *self_p,
+                        struct isotp_channel_t *channel_p,
+                        const uint8_t *buf_p,
+                        size_t size)
+{
+    self_p->channel_p = channel_p;
+    self_p->buf_p = buf_p;
+    self_p->size = size;
+    sem_give(&self_p->sem, 1);
+}
+
+static ssize_t write_wait(struct writer_t *self_p)
+{
+    ssize_t res;
+
+    queue_read(&self_p->responses, &res, sizeof(res));
+
+    return (res);
+}
+
+static void *reader_main(void *arg_p)
+{
+    struct reader_t *self_p;
+    ssize_t res;
+
+    self_p = arg_p;
+
+    while (1) {
+        sem_take(&self_p->sem, NULL);
+        res = isotp_channel_read(self_p->channel_p,
+                                 self_p->buf_p,
+                                 self_p->size);
+        queue_write(&self_p->responses, &res, sizeof(res));
+    }
+
+    return (NULL);
+}
+
+static void read_start(struct reader_t *self_p,
+                       struct isotp_channel_t *channel_p,
+                       uint8_t *buf_p,
+                       size_t size)
+{
+    self_p->channel_p = channel_p;
+    self_p->buf_p = buf_p;
+    self_p->size = size;
+    sem_give(&self_p->sem, 1);
+}
+
+static ssize_t read_wait(struct reader_t *self_p)
+{
+    ssize_t res;
+
+    queue_read(&self_p->responses, &res, sizeof(res));
+
+    return (res);
+}
+
+static int test_channel_init(void)
+{
+    int i;
+
+    BTASSERT(can_init(&can,
+                      &can_device[0],
+                      CAN_SPEED_500KBPS,
+                      &can_rxbuf[0],
+                      sizeof(can_rxbuf)) == 0);
+    BTASSERT(can_start(&can) == 0);
+
+    /* Two pairs of channels talking to each other. */
+    BTASSERT(isotp_channel_init(&channels[0],
+                                &can,
+                                0x7e8,
+                                0x7e0,
+                                &channels_rxbuf[0][0],
+                                sizeof(channels_rxbuf[0]),
+                                FSTR("/test/isotp/0/dropped")) == 0);
+    BTASSERT(isotp_channel_init(&channels[1],
+                                &can,
+                                0x7e0,
+                                0x7e8,
+                                &channels_rxbuf[1][0],
+                                sizeof(channels_rxbuf[1]),
+                                FSTR("/test/isotp/1/dropped")) == 0);
+    BTASSERT(isotp_channel_init(&channels[2],
+                                &can,
+                                (0x18da00f1 | CAN_ID_EXTENDED),
+                                (0x18daf100 | CAN_ID_EXTENDED),
+                                &channels_rxbuf[2][0],
+                                sizeof(channels_rxbuf[2]),
+                                FSTR("/test/isotp/2/dropped")) == 0);
+    BTASSERT(isotp_channel_init(&channels[3],
+                                &can,
+                                (0x18daf100 | CAN_ID_EXTENDED),
+                                (0x18da00f1 | CAN_ID_EXTENDED),
+                                &channels_rxbuf[3][0],
+                                sizeof(channels_rxbuf[3]),
+                                FSTR("/test/isotp/3/dropped")) == 0);
+
+    for (i = 0; i < 4; i++) {
+        BTASSERT(isotp_channel_start(&channels[i]) == 0);
+    }
+
+    for (i = 0; i < 2; i++) {
+        BTASSERT(queue_init(&writers[i].responses,
+                            &writers[i].responses_buf[0],
+                            sizeof(writers[i].responses_buf)) == 0);
+        BTASSERT(sem_init(&writers[i].sem, 1, 1) == 0);
+        BTASSERT(thrd_spawn(writer_main,
+                            &writers[i],
+                            0,
+                            writers[i].stack,
+                            sizeof(writers[i].stack)) != NULL);
+    }
+
+    BTASSERT(queue_init(&reader.responses,
+                        &reader.responses_buf[0],
+                        sizeof(reader.responses_buf)) == 0);
+    BTASSERT(sem_init(&reader.sem, 1, 1) == 0);
+    BTASSERT(thrd_spawn(reader_main,
+                        &reader,
+                        0,
+                        reader.stack,
+                        sizeof(reader.stack)) != NULL);
+
+    for (i = 0; i < membersof(message); i++) {
+        message[i] = (i * 7);
+    }
+
+    return (0);
+}
+
+static int test_channel_single_frame(void)
+{
+    write_start(&writers[0], &channels[0], (uint8_t *)"foo", 3);
+    BTASSERTI(isotp_channel_read(&channels[1], &buf[0], sizeof(buf)), ==, 3);
+    BTASSERTI(write_wait(&writers[0]), ==, 3);
+    BTASSERTM(&buf[0], "foo", 3);
+
+    return (0);
+}
+
+static int test_channel_multi_frame(void)
+{
+    flow_control_frames = 0;
+    memset(&buf[0], 0, sizeof(buf));
+
+    /* 142 consecutive frames. The reception buffer fits four frames,
+       so the receiver asks for blocks of four frames. */
+    write_start(&writers[0], &channels[0], &message[0], 1000);
+    BTASSERTI(isotp_channel_read(&channels[1], &buf[0], sizeof(buf)),
+              ==,
+              1000);
+    BTASSERTI(write_wait(&writers[0]), ==, 1000);
+    BTASSERTM(&buf[0], &message[0], 1000);
+    BTASSERTI(flow_control_frames, ==, 36);
+    BTASSERTI(channels[1].subscriber.dropped.value, ==, 0);
+
+    return (0);
+}
+
+static int test_channel_block_size_and_st_min(void)
+{
+    struct time_t start;
+    struct time_t stop;
+
+    BTASSERT(isotp_channel_set_flow_control(&channels[1], 2, 500) == 0);
+    BTASSERTI(channels[1].block_size, ==, 2);
+    BTASSERTI(channels[1].st_min, ==, 0xf5);
+
+    flow_control_frames = 0;
+    memset(&buf[0], 0, sizeof(buf));
+
+    write_start(&writers[0], &channels[0], &message[0], 1000);
+    BTASSERTI(isotp_channel_read(&channels[1], &buf[0], sizeof(buf)),
+              ==,
+              1000);
+    BTASSERTI(write_wait(&writers[0]), ==, 1000);
+    BTASSERTM(&buf[0], &message[0], 1000);
+    BTASSERTI(flow_control_frames, ==, 71);
+
+    /* The block size is limited by the reception buffer. */
+    BTASSERT(isotp_channel_set_flow_control(&channels[1], 100, 2000) == 0);
+    BTASSERTI(channels[1].block_size, ==, 4);
+    BTASSERTI(channels[1].st_min, ==, 2);
+
+    /* 0xfa-0xff are reserved, so 901-999 us is rounded up to 1 ms. */
+    BTASSERT(isotp_channel_set_flow_control(&channels[1], 0, 900) == 0);
+    BTASSERTI(channels[1].st_min, ==, 0xf9);
+    BTASSERT(isotp_channel_set_flow_control(&channels[1], 0, 950) == 0);
+    BTASSERTI(channels[1].st_min, ==, 1);
+
+    /* 14 consecutive frames 1 ms apart, not 127 ms. */
+    flow_control_frames = 0;
+    memset(&buf[0], 0, sizeof(buf));
+    BTASSERT(time_get(&start) == 0);
+
+    write_start(&writers[0], &channels[0], &message[0], 100);
+    BTASSERTI(isotp_channel_read(&channels[1], &buf[0], sizeof(buf)),
+              ==,
+              100);
+    BTASSERTI(write_wait(&writers[0]), ==, 100);
+    BTASSERTM(&buf[0], &message[0], 100);
+    BTASSERTI(flow_control_frames, ==, 4);
+
+    BTASSERT(time_get(&stop) == 0);
+    time_subtract(&stop, &stop, &start);
+    BTASSERTI(stop.seconds, ==, 0);
+
+    BTASSERT(isotp_channel_set_flow_control(&channels[1], 0, 0) == 0);
+
+    return (0);
+}
+
+static int test_channel_long_message(void)
+{
+    memset(&buf[0], 0, sizeof(buf));
+
+    /* Longer than 4095 bytes requires a 32 bits first frame
+       length. */
+    write_start(&writers[0], &channels[1], &message[0], sizeof(message));
+    BTASSERTI(isotp_channel_read(&channels[0], &buf[0], sizeof(buf)),
+              ==,
+              sizeof(message));
+    BTASSERTI(write_wait(&writers[0]), ==, sizeof(message));
+    BTASSERTM(&buf[0], &message[0], sizeof(message));
+
+    return (0);
+}
+
+static int test_channel_concurrent(void)
+{
+    static uint8_t buf2[3000];
+
+    memset(&buf[0], 0, sizeof(buf));
+    memset(&buf2[0], 0, sizeof(buf2));
+
+    /* Two messages are transmitted and received at the same time on
+       different channels. Both receivers must send flow control
+       frames while the other message is in progress, or its writer
+       times out. */
+    read_start(&reader, &channels[3], &buf2[0], sizeof(buf2));
+    write_start(&writers[0], &channels[0], &message[0], 3000);
+    write_start(&writers[1], &channels[2], &message[1], 3000);
+    BTASSERTI(isotp_channel_read(&channels[1], &buf[0], sizeof(buf)),
+              ==,
+              3000);
+    BTASSERTI(read_wait(&reader), ==, 3000);
+    BTASSERTI(write_wait(&writers[0]), ==, 3000);
+    BTASSERTI(write_wait(&writers[1]), ==, 3000);
+    BTASSERTM(&buf[0], &message[0], 3000);
+    BTASSERTM(&buf2[0], &message[1], 3000);
+
+    return (0);
+}
+
+static int test_channel_overflow(void)
+{
+    /* The message does not fit in the reception buffer. */
+    write_start(&writers[0], &channels[0], &message[0], 100);
+    BTASSERTI(isotp_channel_read(&channels[1], &buf[0], 99), ==, -EMSGSIZE);
+    BTASSERTI(write_wait(&writers[0]), ==, -EMSGSIZE);
+
+    return (0);
+}
+
+static int test_channel_timeout(void)
+{
+    /* No receiver. */
+    BTASSERT(isotp_channel_stop(&channels[1]) == 0);
+    BTASSERTI(isotp_channel_write(&channels[0], &message[0], 100),
+              ==,
+              -ETIMEDOUT);
+    BTASSERT(isotp_channel_start(&channels[1]) == 0);
+
+    return (0);
+}
+
+#endif
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -485,6 +837,17 @@ int main()
           "test_input_bad_multi_frame_consecutive" },
         { test_output_multi_frame_unexpected_non_flow_control,
           "test_output_multi_frame_unexpected_non_flow_control" },
+#if CONFIG_ISOTP_CHANNEL == 1
+        { test_channel_init, "test_channel_init" },
+        { test_channel_single_frame, "test_channel_single_frame" },
+        { test_channel_multi_frame, "test_channel_multi_frame" },
+        { test_channel_block_size_and_st_min,
+          "test_channel_block_size_and_st_min" },
+        { test_channel_long_message, "test_channel_long_message" },
+        { test_channel_concurrent, "test_channel_concurrent" },
+        { test_channel_overflow, "test_channel_overflow" },
+        { test_channel_timeout, "test_channel_timeout" },
+#endif
         { NULL, NULL }
     };
 
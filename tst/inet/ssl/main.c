@@ -28,6 +28,8 @@
 
 #include "simba.h"
 
+extern int mbedtls_stub_set_session_count;
+
 static int test_init(void)
 {
     /* This function may be called multiple times. */
@@ -56,6 +58,7 @@ static int test_client(void)
     BTASSERT(ssl_context_set_verify_mode(&context,
                                          ssl_verify_mode_cert_required_t) == 0);
     BTASSERT(ssl_context_load_verify_location(&context, "foo") == 0);
+    BTASSERT(ssl_context_set_session_resumption(&context, 1) == 0);
 
     /* Create a socket and connect to the server. */
     BTASSERT(socket_open_tcp(&socket) == 0);
@@ -65,11 +68,11 @@ static int test_client(void)
     BTASSERT(socket_connect(&socket, &addr) == 0);
 
     /* Wrap the socket in SSL. */
-    BTASSERT(ssl_socket_open(&ssl_socket,
-                             &context,
-                             &socket,
-                             0,
-                             "client_foo") == 0);
+    BTASSERT(ssl_socket_open_client(&ssl_socket,
+                                    &context,
+                                    &socket,
+                                    "client_foo",
+                                    addr.port) == 0);
 
     /* Test a few functions. */
     BTASSERT(ssl_socket_size(&ssl_socket) == 0);
@@ -231,7 +234,70 @@ static int test_errors(void)
                              &socket,
                              0,
                              NULL) == -1);
-    
+
+    BTASSERT(ssl_context_destroy(&context) == 0);
+
+    return (0);
+}
+
+static int test_session_cache(void)
+{
+    struct ssl_context_t context;
+    struct ssl_socket_t ssl_socket;
+    struct socket_t socket;
+    int count;
+
+    BTASSERT(ssl_context_init(&context, ssl_protocol_tls_v1_0) == 0);
+    BTASSERT(socket_open_tcp(&socket) == 0);
+    count = mbedtls_stub_set_session_count;
+
+    /* Full handshake, nothing cached. */
+    BTASSERT(ssl_socket_open_client(&ssl_socket,
+                                    &context,
+                                    &socket,
+                                    "foo.org",
+                                    443) == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(mbedtls_stub_set_session_count == count);
+
+    /* The session is resumed. */
+    BTASSERT(ssl_socket_open_client(&ssl_socket,
+                                    &context,
+                                    &socket,
+                                    "foo.org",
+                                    443) == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(mbedtls_stub_set_session_count == count + 1);
+
+    /* Another port on the same host is another server. */
+    BTASSERT(ssl_socket_open_client(&ssl_socket,
+                                    &context,
+                                    &socket,
+                                    "foo.org",
+                                    8443) == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(mbedtls_stub_set_session_count == count + 1);
+
+    BTASSERT(ssl_socket_open_client(&ssl_socket,
+                                    &context,
+                                    &socket,
+                                    "foo.org",
+                                    8443) == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(mbedtls_stub_set_session_count == count + 2);
+
+    /* Sessions are not resumed without a known port. */
+    BTASSERT(ssl_socket_open(&ssl_socket,
+                             &context,
+                             &socket,
+                             0,
+                             "foo.org") == 0);
+    BTASSERT(ssl_socket_close(&ssl_socket) == 0);
+    BTASSERT(mbedtls_stub_set_session_count == count + 2);
+
+    BTASSERT(socket_close(&socket) == 0);
+    BTASSERT(ssl_context_destroy(&context) == 0);
+
     return (0);
 }
 
@@ -243,6 +309,7 @@ int main()
         { test_server, "test_server" },
         { test_client_server_context, "test_client_server_context" },
         { test_errors, "test_errors" },
+        { test_session_cache, "test_session_cache" },
         { NULL, NULL }
     };
 
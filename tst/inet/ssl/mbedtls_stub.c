@@ -39,6 +39,7 @@
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/timing.h"
+#include "mbedtls/ssl_ticket.h"
 
 void mbedtls_ssl_cookie_init(mbedtls_ssl_cookie_ctx *ctx_p)
 {
@@ -148,6 +149,7 @@ void mbedtls_ssl_set_bio(mbedtls_ssl_context *ssl_p,
                          mbedtls_ssl_recv_t *f_recv,
                          mbedtls_ssl_recv_timeout_t *f_recv_timeout )
 {
+    ssl_p->p_bio = p_bio;
     ssl_p->f_send = f_send;
     ssl_p->f_recv = f_recv;
 }
@@ -173,14 +175,14 @@ int mbedtls_ssl_write(mbedtls_ssl_context *ssl_p,
                       const unsigned char *buf_p,
                       size_t len)
 {
-    return (ssl_p->f_send(ssl_p, buf_p, len));
+    return (ssl_p->f_send(ssl_p->p_bio, buf_p, len));
 }
 
 int mbedtls_ssl_read(mbedtls_ssl_context *ssl_p,
                      unsigned char *buf_p,
                      size_t len)
 {
-    return (ssl_p->f_recv(ssl_p, buf_p, len));
+    return (ssl_p->f_recv(ssl_p->p_bio, buf_p, len));
 }
 
 int mbedtls_entropy_func(void *data_p,
@@ -235,3 +237,75 @@ int mbedtls_ssl_set_hostname(mbedtls_ssl_context *ssl_p,
     
     return (0);
 }
+
+void mbedtls_ssl_session_init(mbedtls_ssl_session *session_p)
+{
+}
+
+void mbedtls_ssl_session_free(mbedtls_ssl_session *session_p)
+{
+}
+
+/* Number of resumed sessions. */
+int mbedtls_stub_set_session_count = 0;
+
+int mbedtls_ssl_set_session(mbedtls_ssl_context *ssl_p,
+                            const mbedtls_ssl_session *session_p)
+{
+    mbedtls_stub_set_session_count++;
+
+    return (0);
+}
+
+int mbedtls_ssl_get_session(const mbedtls_ssl_context *ssl_p,
+                            mbedtls_ssl_session *session_p)
+{
+    return (0);
+}
+
+void mbedtls_ssl_conf_session_tickets(mbedtls_ssl_config *conf_p,
+                                      int use_tickets)
+{
+}
+
+void mbedtls_ssl_conf_session_tickets_cb(mbedtls_ssl_config *conf_p,
+                                         mbedtls_ssl_ticket_write_t *f_ticket_write,
+                                         mbedtls_ssl_ticket_parse_t *f_ticket_parse,
+                                         void *p_ticket)
+{
+}
+
+void mbedtls_ssl_ticket_init(mbedtls_ssl_ticket_context *ctx_p)
+{
+}
+
+int mbedtls_ssl_ticket_setup(mbedtls_ssl_ticket_context *ctx_p,
+                             int (*f_rng)(void *, unsigned char *, size_t),
+                             void *p_rng,
+                             mbedtls_cipher_type_t cipher,
+                             uint32_t lifetime)
+{
+    return (0);
+}
+
+void mbedtls_ssl_ticket_free(mbedtls_ssl_ticket_context *ctx_p)
+{
+}
+
+int mbedtls_ssl_ticket_write(void *p_ticket,
+                             const mbedtls_ssl_session *session_p,
+                             unsigned char *start_p,
+                             const unsigned char *end_p,
+                             size_t *tlen_p,
+                             uint32_t *lifetime_p)
+{
+    return (0);
+}
+
+int mbedtls_ssl_ticket_parse(void *p_ticket,
+                             mbedtls_ssl_session *session_p,
+                             unsigned char *buf_p,
+                             size_t len)
+{
+    return (0);
+}
@@ -36,8 +36,8 @@ int socket_module_init()
 int socket_open_tcp(struct socket_t *self_p)
 {
     chan_init(&self_p->base,
-              chan_read_null,
-              chan_write_null,
+              (chan_read_fn_t)socket_read,
+              (chan_write_fn_t)socket_write,
               (chan_size_fn_t)socket_size);
 
     return (0);
@@ -80,8 +80,8 @@ int socket_accept(struct socket_t *self_p,
                   struct inet_addr_t *addr_p)
 {
     chan_init(&accepted_p->base,
-              chan_read_null,
-              chan_write_null,
+              (chan_read_fn_t)socket_read,
+              (chan_write_fn_t)socket_write,
               (chan_size_fn_t)socket_size);
 
     return (0);
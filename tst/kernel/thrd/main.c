@@ -365,6 +365,120 @@ int test_monitor_thread(void)
     return (0);
 }
 
+#if CONFIG_MONITOR_THREAD == 1 && defined(ARCH_LINUX)
+
+int test_cpu_usage(void)
+{
+    struct time_t start;
+    struct time_t now;
+    struct time_t elapsed;
+    char command[64];
+    float busy;
+
+    strcpy(command, "/kernel/thrd/monitor/set_period_ms 10");
+    BTASSERT(fs_call(command, NULL, chan_null(), NULL) == 0);
+
+    /* Busy wait for a few monitor periods. */
+    BTASSERT(sys_uptime(&start) == 0);
+
+    do {
+        BTASSERT(sys_uptime(&now) == 0);
+        BTASSERT(time_subtract(&elapsed, &now, &start) == 0);
+    } while ((elapsed.seconds == 0) && (elapsed.nanoseconds < 50000000));
+
+    /* Let the monitor thread calculate the CPU usage. */
+    thrd_yield();
+
+    /* The usage is CPU time over wall time, so it is lower if other
+       processes compete for the CPU. Only compare it to the sleeping
+       usage. */
+    busy = thrd_self()->statistics.cpu.usage;
+    std_printf(FSTR("busy: %d%%\r\n"), (int)busy);
+    BTASSERT(busy > 0);
+
+    /* Sleep for a few monitor periods. */
+    thrd_sleep_ms(50);
+
+    std_printf(FSTR("sleeping: %d%%\r\n"),
+               (int)thrd_self()->statistics.cpu.usage);
+    BTASSERT(thrd_self()->statistics.cpu.usage < busy);
+
+    strcpy(command, "/kernel/thrd/list");
+    BTASSERT(fs_call(command, NULL, sys_get_stdout(), NULL) == 0);
+
+    return (0);
+}
+
+#endif
+
+#if CONFIG_THRD_WAKE_LATENCY == 1
+
+static THRD_STACK(wake_latency_stack, 256);
+
+static void *wake_latency_main(void *arg_p)
+{
+    thrd_set_name("wake_latency");
+
+    while (1) {
+        thrd_suspend(NULL);
+    }
+
+    return (NULL);
+}
+
+int test_wake_latency(void)
+{
+    struct thrd_t *thrd_p;
+    char command[64];
+    uint32_t wakeups;
+    int i;
+
+    thrd_p = thrd_spawn(wake_latency_main,
+                        NULL,
+                        -10,
+                        wake_latency_stack,
+                        sizeof(wake_latency_stack));
+    BTASSERT(thrd_p != NULL);
+
+    /* Let the thread suspend itself. Being spawned is not a wakeup. */
+    thrd_yield();
+
+    strcpy(command, "/kernel/thrd/wake_latency/reset");
+    BTASSERT(fs_call(command, NULL, sys_get_stdout(), NULL) == 0);
+    BTASSERT(thrd_p->statistics.wake_latency.max == 0);
+
+    /* Wake the thread a few times. */
+    for (i = 0; i < 4; i++) {
+        BTASSERT(thrd_resume(thrd_p, 0) == 0);
+        thrd_yield();
+    }
+
+    wakeups = 0;
+
+    for (i = 0; i < THRD_WAKE_LATENCY_HISTOGRAM_LENGTH; i++) {
+        wakeups += thrd_p->statistics.wake_latency.histogram[i];
+    }
+
+    BTASSERT(wakeups == 4);
+
+    /* Woken by a suspend timeout. */
+    thrd_sleep_ms(10);
+    wakeups = 0;
+
+    for (i = 0; i < THRD_WAKE_LATENCY_HISTOGRAM_LENGTH; i++) {
+        wakeups += thrd_self()->statistics.wake_latency.histogram[i];
+    }
+
+    BTASSERT(wakeups >= 1);
+
+    strcpy(command, "/kernel/thrd/wake_latency/print");
+    BTASSERT(fs_call(command, NULL, sys_get_stdout(), NULL) == 0);
+
+    return (0);
+}
+
+#endif
+
 int test_stack_heap(void)
 {
     BTASSERT(thrd_stack_alloc(1) == NULL);
@@ -414,6 +528,12 @@ int main()
         { test_stack_top_bottom, "test_stack_top_bottom" },
 #    if CONFIG_MONITOR_THREAD == 1
         { test_monitor_thread, "test_monitor_thread" },
+#    endif
+#    if CONFIG_MONITOR_THREAD == 1 && defined(ARCH_LINUX)
+        { test_cpu_usage, "test_cpu_usage" },
+#    endif
+#    if CONFIG_THRD_WAKE_LATENCY == 1
+        { test_wake_latency, "test_wake_latency" },
 #    endif
         { test_stack_heap, "test_stack_heap" },
         { test_prio_list, "test_prio_list" },
@@ -357,6 +357,27 @@ static int test_micros(void)
     return (0);
 }
 
+static int test_timestamp(void)
+{
+    uint32_t start;
+    uint32_t elapsed;
+
+    std_printf(OSTR("Resolution: %d\r\n"), time_timestamp_resolution());
+
+    BTASSERTI(time_timestamp_resolution(), >, 0);
+
+    start = time_timestamp();
+    thrd_sleep_ms(10);
+    elapsed = (time_timestamp() - start);
+
+    std_printf(OSTR("Elapsed: %lu\r\n"), (unsigned long)elapsed);
+
+    BTASSERTI(elapsed, >=, 10000 - time_timestamp_resolution());
+    BTASSERTI(elapsed, <, 10000000);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -367,6 +388,7 @@ int main()
         { test_subtract, "test_subtract" },
         { test_compare, "test_compare" },
         { test_micros, "test_micros" },
+        { test_timestamp, "test_timestamp" },
         { NULL, NULL }
     };
 
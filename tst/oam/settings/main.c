@@ -376,6 +376,34 @@ static int test_read_write_by_name(void)
     return (0);
 }
 
+static int test_read_by_name_all(void)
+{
+    uint8_t buf[8];
+
+    /* All settings are found by name. */
+    BTASSERTI(settings_read_by_name("blob", &buf[0], 2), ==, 2);
+    BTASSERTI(settings_read_by_name("blob_with_empty_default_data",
+                                    &buf[0],
+                                    4), ==, 4);
+    BTASSERTI(settings_read_by_name("int32", &buf[0], 4), ==, 4);
+    BTASSERTI(settings_read_by_name(
+                  "max_name_length_40_123456789012345678901",
+                  &buf[0],
+                  4), ==, 4);
+    BTASSERTI(settings_read_by_name("string", &buf[0], 4), ==, 4);
+    BTASSERTI(settings_read_by_name("string_escape", &buf[0], 8), ==, 8);
+    BTASSERTI(settings_read_by_name("string_space", &buf[0], 4), ==, 4);
+
+    /* Missing settings. */
+    BTASSERTI(settings_read_by_name("", &buf[0], 1), ==, -EINVAL);
+    BTASSERTI(settings_read_by_name("a", &buf[0], 1), ==, -EINVAL);
+    BTASSERTI(settings_read_by_name("blo", &buf[0], 1), ==, -EINVAL);
+    BTASSERTI(settings_read_by_name("string_", &buf[0], 1), ==, -EINVAL);
+    BTASSERTI(settings_read_by_name("zzz", &buf[0], 1), ==, -EINVAL);
+
+    return (0);
+}
+
 static int test_cmd_list_after_updates(void)
 {
 #if CONFIG_SETTINGS_FS_COMMAND_LIST == 1
@@ -415,6 +443,7 @@ int main()
         { test_setting_string_read_write, "test_setting_string_read_write" },
         { test_setting_blob_read_write, "test_setting_blob_read_write" },
         { test_read_write_by_name, "test_read_write_by_name" },
+        { test_read_by_name_all, "test_read_by_name_all" },
         { test_cmd_list_after_updates, "test_cmd_list_after_updates" },
         { NULL, NULL }
     };
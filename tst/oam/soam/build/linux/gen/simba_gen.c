@@ -0,0 +1,405 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+/**
+ * This file was generated by simbagen.py 1.2 2026-10-19 19:07 UTC.
+ */
+
+#include "simba.h"
+
+const FAR char sysinfo[] = "app:    soam_suite-15.0.3 built 2026-10-19 19:07 UTC by root.\r\n"
+                           "board:  Linux\r\n"
+                           "mcu:    Linux\r\n";
+
+
+
+
+
+
+
+const FAR struct setting_t settings[] = {
+
+    { NULL, 0, 0, 0 }
+};
+
+/* Indices into the settings array, sorted by name. */
+const FAR uint16_t settings_by_name[] = {
+    0
+};
+
+const FAR uint8_t settings_default[CONFIG_SETTINGS_AREA_SIZE] = {};
+
+
+
+uint8_t nvm_eeprom_soft_block_0[CONFIG_NVM_EEPROM_SOFT_BLOCK_0_SIZE]
+__attribute__ ((section (".nvm.eeprom_soft.block_0"))) = { 28, 99, 138, 8, 1, 0, 195, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 };
+
+
+
+uint8_t nvm_eeprom_area[CONFIG_NVM_SIZE]
+__attribute__ ((section (".eeprom"))) = {  };
+
+
+const char soam_database_id[] = "7092d9d212be83eab2643e43594d2a9b";
+
+const size_t soam_database_compressed_size = 2997;
+
+const FAR uint8_t soam_database_compressed[] = { 0, 253, 55, 122, 88, 90, 0, 0, 4, 230, 214, 180, 70, 2, 0, 33, 1, 22, 0, 0, 0, 116, 47, 229, 163, 224, 110, 219, 11, 113, 93, 0, 17, 136, 7, 7, 225, 195, 92, 146, 206, 39, 45, 172, 35, 218, 196, 71, 36, 176, 182, 43, 139, 51, 233, 223, 135, 106, 30, 68, 45, 243, 129, 226, 161, 138, 66, 161, 228, 117, 99, 248, 171, 29, 109, 135, 245, 208, 216, 41, 202, 190, 133, 76, 80, 22, 4, 20, 2, 102, 15, 255, 181, 103, 22, 119, 85, 77, 222, 86, 252, 47, 106, 92, 159, 199, 198, 61, 7, 156, 199, 57, 133, 105, 10, 158, 118, 14, 82, 76, 99, 188, 3, 234, 91, 201, 183, 245, 34, 193, 117, 251, 143, 139, 120, 219, 88, 10, 224, 223, 3, 170, 117, 135, 156, 227, 246, 180, 186, 171, 7, 76, 10, 53, 48, 183, 20, 157, 43, 105, 96, 152, 16, 242, 220, 150, 28, 3, 29, 25, 195, 86, 247, 128, 134, 177, 94, 152, 52, 155, 37, 50, 243, 147, 229, 178, 201, 138, 79, 169, 145, 206, 64, 4, 161, 5, 32, 86, 197, 246, 121, 147, 74, 124, 139, 205, 27, 244, 88, 84, 17, 92, 137, 18, 224, 136, 225, 148, 78, 133, 21, 107, 34, 75, 69, 164, 131, 234, 217, 178, 139, 79, 26, 113, 239, 24, 165, 2, 90, 244, 159, 203, 154, 208, 40, 116, 0, 33, 11, 171, 9, 137, 73, 223, 233, 47, 127, 184, 137, 205, 197, 11, 41, 250, 22, 197, 132, 9, 73, 180, 171, 44, 65, 42, 127, 88, 109, 138, 252, 237, 38, 28, 81, 151, 106, 70, 175, 17, 157, 181, 184, 132, 147, 162, 65, 56, 38, 46, 28, 219, 195, 41, 89, 254, 96, 212, 42, 113, 234, 0, 27, 42, 25, 166, 227, 15, 12, 87, 204, 74, 161, 79, 135, 242, 145, 39, 27, 150, 192, 160, 186, 73, 203, 149, 166, 215, 207, 171, 84, 134, 230, 84, 167, 83, 6, 219, 154, 138, 65, 199, 113, 243, 179, 194, 222, 186, 69, 208, 3, 190, 210, 128, 194, 101, 40, 158, 206, 124, 214, 87, 30, 8, 134, 214, 225, 110, 170, 58, 171, 155, 175, 204, 215, 57, 180, 117, 115, 227, 108, 251, 127, 216, 36, 25, 89, 106, 42, 162, 86, 130, 12, 59, 185, 157, 23, 186, 189, 232, 64, 149, 139, 220, 132, 127, 217, 118, 1, 154, 252, 165, 237, 38, 114, 66, 124, 0, 250, 229, 79, 116, 233, 117, 250, 211, 107, 82, 178, 190, 180, 208, 20, 250, 80, 225, 76, 45, 96, 185, 220, 245, 176, 73, 65, 170, 230, 134, 28, 178, 220, 89, 1, 180, 91, 232, 82, 57, 73, 206, 91, 95, 226, 57, 219, 207, 80, 91, 24, 225, 142, 161, 109, 232, 198, 107, 41, 2, 186, 90, 51, 78, 129, 162, 227, 31, 182, 77, 247, 174, 163, 68, 255, 18, 184, 5, 244, 178, 215, 103, 244, 163, 182, 1, 239, 110, 45, 157, 186, 59, 118, 196, 175, 39, 199, 9, 131, 215, 22, 182, 155, 3, 194, 67, 118, 108, 41, 66, 85, 235, 228, 218, 78, 149, 60, 178, 151, 64, 203, 243, 4, 25, 114, 93, 114, 83, 139, 117, 112, 194, 216, 68, 45, 197, 114, 80, 79, 14, 166, 118, 230, 78, 130, 36, 74, 85, 54, 217, 17, 62, 229, 85, 217, 222, 78, 33, 216, 165, 84, 225, 38, 147, 51, 100, 17, 98, 181, 90, 226, 67, 159, 255, 48, 35, 12, 226, 217, 116, 182, 109, 135, 55, 114, 207, 120, 104, 152, 223, 252, 245, 186, 205, 137, 10, 146, 43, 5, 15, 168, 104, 204, 215, 233, 81, 41, 208, 51, 211, 196, 115, 164, 3, 75, 9, 69, 222, 217, 239, 20, 82, 78, 188, 92, 115, 5, 203, 203, 134, 83, 34, 247, 204, 80, 53, 167, 44, 9, 231, 92, 44, 244, 86, 88, 102, 190, 29, 42, 133, 18, 247, 207, 33, 217, 117, 179, 163, 95, 45, 70, 24, 105, 169, 155, 178, 181, 123, 106, 255, 132, 42, 201, 213, 15, 80, 101, 64, 245, 125, 129, 104, 198, 135, 207, 135, 141, 63, 69, 167, 91, 149, 237, 154, 13, 149, 243, 47, 186, 157, 19, 207, 142, 170, 109, 192, 72, 177, 246, 104, 71, 182, 28, 148, 242, 159, 11, 66, 202, 52, 48, 15, 184, 169, 88, 178, 1, 168, 113, 114, 108, 68, 139, 60, 18, 127, 207, 207, 211, 20, 237, 16, 101, 150, 38, 124, 8, 58, 255, 123, 10, 5, 134, 245, 44, 180, 212, 133, 34, 43, 16, 225, 159, 104, 211, 79, 63, 193, 20, 156, 73, 100, 140, 160, 232, 74, 9, 3, 55, 74, 249, 106, 122, 92, 175, 110, 21, 223, 136, 0, 151, 203, 32, 142, 82, 206, 86, 179, 244, 242, 123, 198, 217, 78, 162, 84, 69, 37, 137, 84, 71, 105, 24, 93, 184, 13, 86, 96, 72, 25, 113, 216, 115, 108, 188, 151, 19, 225, 250, 180, 123, 249, 148, 246, 147, 118, 253, 218, 61, 31, 193, 251, 33, 146, 114, 226, 32, 187, 122, 125, 129, 9, 184, 17, 215, 89, 221, 199, 137, 156, 23, 56, 127, 48, 146, 230, 15, 45, 2, 200, 104, 68, 97, 167, 198, 244, 20, 205, 66, 89, 200, 2, 35, 27, 3, 179, 191, 237, 9, 145, 223, 58, 132, 55, 58, 171, 214, 237, 1, 69, 56, 74, 85, 135, 215, 249, 127, 112, 102, 198, 42, 9, 55, 104, 227, 192, 13, 36, 189, 178, 177, 63, 143, 54, 3, 116, 181, 52, 88, 116, 137, 15, 217, 66, 24, 85, 46, 126, 19, 126, 26, 93, 74, 75, 122, 176, 1, 109, 217, 212, 176, 86, 37, 212, 200, 68, 76, 112, 158, 188, 39, 76, 53, 94, 21, 31, 146, 32, 250, 190, 23, 96, 116, 193, 71, 140, 54, 198, 25, 108, 16, 184, 237, 127, 17, 228, 202, 79, 206, 153, 101, 150, 216, 149, 164, 227, 144, 44, 60, 242, 41, 9, 56, 25, 42, 9, 173, 225, 36, 219, 56, 176, 48, 250, 105, 236, 60, 66, 31, 101, 43, 6, 88, 88, 230, 76, 212, 243, 247, 237, 255, 143, 97, 216, 29, 200, 78, 113, 134, 227, 183, 201, 105, 197, 172, 32, 250, 148, 90, 115, 98, 58, 166, 152, 81, 41, 106, 74, 58, 96, 155, 190, 141, 79, 180, 6, 65, 0, 65, 84, 245, 209, 225, 53, 164, 234, 216, 59, 154, 22, 126, 5, 228, 92, 123, 226, 217, 19, 166, 17, 150, 137, 162, 229, 131, 29, 181, 151, 127, 203, 177, 32, 210, 217, 79, 205, 240, 5, 180, 160, 0, 137, 124, 35, 26, 251, 76, 125, 206, 95, 205, 134, 240, 72, 25, 205, 82, 47, 99, 32, 90, 144, 227, 131, 230, 126, 78, 30, 233, 16, 191, 110, 185, 127, 180, 70, 10, 22, 212, 40, 144, 235, 47, 33, 119, 166, 106, 221, 115, 236, 105, 62, 115, 73, 163, 123, 169, 123, 151, 81, 122, 194, 94, 40, 245, 81, 71, 222, 30, 252, 81, 230, 211, 36, 242, 236, 63, 57, 13, 158, 241, 188, 197, 105, 213, 186, 236, 116, 26, 250, 29, 185, 100, 198, 173, 59, 131, 64, 233, 99, 84, 4, 201, 255, 220, 110, 126, 26, 57, 9, 168, 116, 178, 106, 63, 35, 245, 145, 162, 239, 137, 159, 145, 201, 217, 226, 83, 78, 244, 2, 86, 152, 202, 164, 13, 186, 91, 189, 36, 90, 111, 15, 117, 42, 22, 227, 181, 226, 105, 61, 184, 70, 209, 214, 205, 213, 94, 12, 88, 155, 138, 98, 21, 152, 32, 105, 235, 215, 246, 112, 207, 172, 26, 90, 243, 136, 194, 107, 11, 1, 86, 245, 38, 109, 108, 194, 178, 94, 220, 208, 183, 194, 73, 225, 45, 91, 237, 166, 60, 30, 46, 171, 121, 193, 87, 55, 121, 187, 169, 3, 36, 25, 14, 80, 94, 168, 147, 136, 71, 221, 71, 80, 37, 215, 161, 121, 148, 32, 60, 179, 105, 72, 28, 178, 5, 150, 100, 214, 183, 197, 215, 172, 161, 102, 103, 196, 37, 167, 183, 61, 38, 69, 17, 255, 48, 75, 108, 199, 98, 115, 91, 179, 38, 85, 46, 130, 250, 54, 218, 191, 240, 19, 125, 116, 99, 223, 213, 72, 141, 239, 211, 138, 209, 128, 9, 17, 120, 53, 94, 203, 111, 2, 99, 21, 152, 173, 120, 40, 253, 245, 184, 168, 152, 78, 88, 160, 154, 131, 103, 171, 40, 224, 252, 56, 241, 38, 176, 201, 216, 15, 42, 4, 68, 10, 176, 203, 166, 227, 5, 11, 22, 247, 149, 219, 206, 113, 214, 201, 110, 82, 175, 239, 78, 129, 254, 165, 247, 54, 178, 53, 190, 124, 247, 89, 114, 125, 100, 126, 60, 201, 92, 157, 38, 42, 128, 213, 16, 219, 179, 224, 119, 88, 102, 67, 171, 109, 61, 160, 243, 189, 216, 26, 9, 93, 181, 104, 96, 190, 26, 153, 194, 208, 102, 7, 84, 61, 138, 53, 51, 122, 51, 55, 68, 197, 245, 62, 202, 217, 204, 117, 16, 25, 81, 150, 121, 202, 142, 72, 118, 155, 200, 161, 236, 33, 175, 163, 184, 127, 53, 139, 112, 48, 251, 57, 43, 40, 80, 149, 222, 123, 76, 240, 17, 5, 187, 222, 248, 13, 28, 12, 120, 136, 201, 210, 29, 44, 226, 108, 244, 131, 45, 35, 184, 77, 13, 133, 13, 175, 174, 156, 210, 181, 69, 176, 225, 54, 49, 162, 207, 98, 31, 198, 226, 114, 32, 182, 131, 161, 159, 12, 128, 4, 142, 252, 254, 67, 131, 181, 129, 89, 185, 93, 120, 158, 75, 160, 225, 46, 156, 100, 105, 33, 184, 21, 182, 114, 243, 32, 81, 208, 157, 227, 167, 138, 64, 146, 17, 243, 245, 219, 29, 224, 63, 68, 228, 170, 124, 87, 97, 239, 145, 110, 11, 2, 105, 163, 31, 231, 69, 45, 30, 170, 185, 182, 121, 176, 172, 63, 143, 81, 113, 76, 41, 198, 221, 185, 231, 199, 61, 112, 205, 252, 20, 127, 210, 13, 144, 150, 168, 165, 142, 122, 159, 79, 152, 244, 108, 225, 149, 122, 173, 168, 64, 238, 107, 250, 106, 227, 178, 42, 25, 197, 106, 189, 222, 227, 221, 16, 208, 75, 3, 116, 7, 237, 231, 228, 234, 159, 148, 57, 116, 210, 223, 176, 79, 82, 8, 218, 81, 15, 227, 244, 237, 222, 119, 199, 238, 58, 16, 225, 12, 141, 23, 30, 53, 212, 255, 3, 171, 224, 25, 224, 66, 245, 125, 30, 0, 207, 16, 122, 80, 216, 19, 51, 54, 244, 95, 70, 96, 130, 62, 203, 80, 17, 74, 154, 221, 170, 116, 145, 29, 162, 234, 170, 163, 220, 77, 224, 49, 130, 197, 238, 4, 70, 49, 250, 195, 201, 225, 33, 136, 84, 135, 111, 251, 82, 176, 18, 127, 44, 161, 185, 203, 174, 232, 119, 107, 42, 167, 173, 106, 17, 29, 164, 107, 70, 177, 17, 217, 126, 165, 97, 34, 19, 63, 72, 251, 48, 123, 206, 8, 203, 132, 94, 218, 10, 240, 148, 82, 129, 59, 78, 77, 148, 253, 205, 119, 160, 188, 93, 74, 242, 152, 206, 162, 118, 2, 112, 98, 208, 239, 147, 162, 20, 192, 179, 144, 240, 75, 172, 171, 29, 121, 137, 13, 229, 180, 23, 214, 239, 80, 8, 229, 229, 40, 246, 133, 55, 93, 241, 82, 36, 37, 52, 160, 68, 31, 120, 29, 165, 125, 210, 50, 66, 48, 177, 42, 213, 167, 152, 238, 97, 57, 106, 135, 21, 27, 110, 24, 131, 51, 66, 85, 6, 163, 82, 137, 240, 188, 109, 106, 12, 22, 166, 48, 80, 10, 133, 208, 162, 42, 195, 101, 176, 91, 229, 255, 232, 174, 28, 15, 191, 178, 27, 121, 128, 89, 44, 67, 207, 5, 248, 16, 72, 79, 215, 65, 38, 215, 66, 102, 23, 243, 105, 237, 89, 46, 81, 106, 159, 233, 97, 109, 137, 89, 95, 19, 96, 13, 44, 250, 174, 240, 84, 189, 10, 230, 168, 243, 117, 143, 35, 212, 82, 208, 118, 29, 17, 112, 47, 167, 6, 133, 89, 97, 117, 15, 77, 63, 241, 104, 255, 123, 175, 42, 30, 40, 174, 118, 19, 215, 214, 202, 70, 76, 202, 98, 131, 239, 57, 40, 242, 112, 177, 166, 140, 153, 195, 17, 244, 152, 110, 116, 255, 249, 219, 145, 105, 177, 110, 141, 104, 25, 183, 91, 222, 223, 33, 54, 185, 205, 129, 33, 186, 74, 219, 156, 216, 177, 198, 83, 164, 163, 8, 214, 20, 202, 41, 232, 3, 42, 159, 80, 88, 131, 170, 231, 34, 75, 203, 177, 99, 78, 194, 80, 53, 147, 107, 170, 63, 149, 84, 166, 84, 28, 155, 144, 96, 123, 174, 213, 86, 243, 158, 2, 51, 82, 139, 32, 104, 149, 191, 41, 7, 171, 126, 64, 36, 24, 187, 166, 46, 82, 142, 137, 21, 90, 184, 226, 13, 63, 174, 142, 212, 2, 142, 43, 30, 251, 196, 73, 57, 107, 94, 83, 192, 51, 232, 233, 131, 49, 203, 240, 247, 146, 44, 89, 189, 184, 63, 24, 195, 38, 147, 90, 214, 147, 126, 48, 115, 27, 103, 223, 163, 144, 76, 97, 28, 99, 60, 190, 226, 87, 213, 78, 251, 198, 5, 109, 245, 212, 83, 143, 26, 97, 74, 1, 212, 166, 40, 39, 85, 67, 33, 110, 219, 149, 157, 4, 51, 19, 10, 78, 163, 224, 112, 188, 164, 217, 95, 60, 101, 188, 36, 25, 188, 50, 145, 84, 107, 106, 152, 165, 188, 203, 65, 10, 88, 26, 102, 210, 104, 143, 76, 224, 209, 73, 50, 72, 80, 119, 131, 110, 176, 13, 175, 181, 220, 230, 128, 199, 192, 96, 190, 150, 164, 155, 6, 15, 245, 203, 117, 64, 237, 50, 11, 181, 78, 239, 233, 141, 75, 89, 134, 124, 150, 182, 165, 88, 120, 165, 200, 101, 105, 152, 207, 192, 211, 170, 87, 210, 57, 11, 135, 95, 238, 160, 124, 9, 212, 51, 213, 15, 101, 169, 250, 146, 244, 130, 175, 121, 2, 80, 57, 150, 36, 174, 249, 9, 242, 142, 172, 30, 37, 78, 92, 137, 32, 29, 77, 21, 99, 201, 148, 105, 181, 200, 228, 82, 13, 162, 108, 168, 156, 146, 138, 209, 129, 216, 166, 211, 100, 172, 223, 62, 140, 231, 88, 1, 94, 34, 172, 211, 64, 1, 22, 11, 112, 81, 237, 213, 14, 23, 241, 105, 226, 230, 1, 140, 113, 55, 238, 86, 211, 183, 128, 138, 187, 227, 250, 150, 22, 70, 241, 197, 43, 209, 247, 151, 22, 103, 155, 245, 70, 0, 129, 159, 151, 202, 58, 176, 37, 80, 10, 74, 112, 20, 138, 119, 107, 58, 37, 101, 74, 90, 169, 119, 165, 162, 150, 125, 157, 116, 114, 26, 242, 225, 85, 219, 83, 130, 92, 60, 179, 101, 139, 108, 58, 119, 148, 69, 169, 177, 78, 156, 139, 167, 100, 28, 8, 97, 185, 46, 166, 32, 31, 232, 219, 84, 15, 100, 107, 12, 127, 17, 182, 89, 50, 138, 69, 181, 245, 112, 241, 182, 125, 84, 207, 114, 134, 156, 24, 132, 210, 118, 140, 252, 54, 67, 2, 157, 202, 41, 191, 9, 14, 174, 216, 173, 49, 150, 190, 233, 5, 64, 6, 215, 180, 15, 254, 210, 183, 196, 160, 37, 194, 44, 72, 159, 15, 82, 30, 178, 217, 188, 242, 70, 209, 54, 128, 167, 155, 156, 174, 145, 190, 240, 252, 138, 80, 203, 39, 106, 1, 65, 55, 205, 113, 109, 43, 137, 62, 195, 154, 16, 102, 99, 3, 84, 130, 122, 53, 40, 105, 234, 22, 27, 205, 18, 129, 237, 4, 98, 222, 97, 6, 11, 119, 150, 52, 125, 244, 168, 84, 111, 131, 32, 124, 34, 16, 107, 210, 215, 149, 57, 182, 169, 166, 14, 195, 163, 227, 54, 145, 254, 176, 198, 35, 35, 231, 231, 15, 61, 46, 88, 138, 13, 37, 220, 200, 245, 224, 36, 51, 6, 241, 113, 104, 42, 137, 194, 212, 57, 130, 184, 117, 167, 17, 9, 155, 161, 158, 83, 187, 169, 9, 75, 135, 218, 161, 213, 10, 12, 94, 180, 58, 29, 201, 24, 134, 37, 21, 237, 83, 135, 208, 203, 107, 151, 122, 200, 255, 143, 129, 228, 33, 179, 188, 231, 100, 36, 21, 39, 247, 96, 98, 159, 105, 83, 4, 59, 164, 25, 190, 179, 68, 74, 201, 144, 117, 117, 230, 255, 135, 195, 56, 158, 207, 107, 11, 157, 120, 87, 45, 47, 14, 204, 193, 152, 28, 194, 225, 37, 71, 5, 165, 168, 4, 249, 35, 241, 49, 38, 192, 97, 47, 148, 170, 206, 246, 168, 182, 26, 38, 81, 163, 56, 249, 223, 205, 179, 147, 136, 114, 17, 51, 168, 78, 247, 75, 6, 122, 35, 213, 30, 190, 32, 35, 99, 244, 170, 124, 25, 1, 213, 1, 70, 131, 42, 176, 156, 195, 149, 153, 19, 35, 125, 204, 199, 200, 171, 86, 56, 48, 222, 195, 192, 226, 94, 168, 210, 142, 36, 72, 73, 23, 16, 237, 252, 18, 205, 200, 26, 92, 58, 104, 79, 201, 117, 135, 167, 207, 22, 189, 1, 186, 152, 135, 238, 186, 187, 163, 255, 8, 30, 187, 62, 129, 90, 96, 91, 30, 202, 92, 229, 64, 198, 47, 101, 84, 15, 31, 182, 23, 113, 129, 215, 133, 166, 173, 155, 252, 167, 186, 210, 113, 247, 48, 135, 133, 249, 99, 21, 151, 0, 0, 0, 0, 0, 160, 108, 102, 52, 59, 81, 108, 91, 0, 1, 141, 23, 220, 221, 1, 0, 74, 9, 115, 67, 177, 196, 103, 251, 2, 0, 0, 0, 0, 4, 89, 90 };
+
+const FAR char __fmt_eiswiibfouqckzraevzsajldlrzfy3rc[] = "\x80\x01""%d\x1f%u\x1f%f\x1f%s\x1f%c";
+const FAR char __fmt_ejxw4zj2easwilbamvzgs2z2easxgxdslrxce___[] = "\x80\x02""%d\x1f%s";
+const FAR char __fmt_ejtg6324ojog4iq_[] = "\x80\x03""";
+const FAR char __fmt_ejugk2s4ojog4iq_[] = "\x80\x04""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrgy3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x0f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrgy3tuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x10""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrgy4duicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x11""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrha4tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x12""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrheyduicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x13""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgeyduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x14""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgeytuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x15""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgq2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x16""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgq3duicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x17""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgq3tuicbknjukusuhiqcqy3povxhiib6huqdalbagizcsic4ojog4iq_[] = "\x80\x18""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi2dqoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x19""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi2dsoraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x1a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi2taoraifjvgrkskq5cakdtnf5gkib6eaycyibsgiusaxdslrxce___[] = "\x80\x1b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi3dioraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x1c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi3dkoraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x1d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi4tmoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x1e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi4tooraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x1f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytenr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x21""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytgmz2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x23""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytioj2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x24""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytonb2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x26""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5demjwhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x27""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5demrwhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x28""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5demrxhiqecu2tivjfiorafbxg6zdfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x29""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5demzzhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x2a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5denbyhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x2b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5denjvhiqecu2tivjfiorafbzwk3dgl5ycaij5ebhfktcmfqqekskokzauykjalrzfy3rc[] = "\x80\x2c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2gmztuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x2d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2gq4tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x2e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2guyduicbknjukusuhiqcq5s7mvwgk3k7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x2f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2gy4tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x30""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2g4yduicbknjukusuhiqcq5s7mvwgk3k7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x31""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2heyduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x32""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2geytcoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x33""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2geyteoraifjvgrkskq5cakdmnfzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x34""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2gezdcoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x35""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2geztooraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x36""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2geztqoraifjvgrkskq5cakdwl5swyzlnl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x37""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrsgu5caqktkncvevb2eaugqylomrwgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x38""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrthe5caqktkncvevb2eaugqylomrwgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x39""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrwha5caqktkncvevb2eaug6ytkmvrxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x3a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrygi5caqktkncvevb2eaug6ytkmvrxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x3b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzrhe5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x3c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzsga5caqktkncvevb2eaugg2dpov2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x3d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumztgi5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x3e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumztgm5caqktkncvevb2eaug4ylnmvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x3f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzxga5caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x40""";
+const FAR char __fmt_ejohexdojvxwg2zaevzsaytbmnvxi4tbmnssakdnn5zxiidsmvrwk3tuebrwc3dmebtgs4ttoqutuxdslrxce___[] = "\x80\x41""%s";
+const FAR char __fmt_ejgw6y3lebsw45dspeqg2zlnn5zhsidbnrwg6y3boruw63ramzqws3dfmqqgm33sebuwiibhevzsoxdslrxce___[] = "\x80\x42""%s";
+const FAR char __fmt_ejohexdoevzsqkj2ebdw65bajzkuytbaobxws3tumvzca53joruca43jpjssaz3smvqxizlseb2gqyloeb5gk4tpfaycsidgn5zca3lpmnvsa2leeatsk4zhfyra____[] = "\x80\x43""%s\x1f%s";
+const FAR char __fmt_ejohexdoevzsqkj2ebkhe6ljnztsa5dpebzgkyleebsxqyldorwhsibfmqqge6lumvzsq4zjebthe33nebww6y3lebsw45dspeqho2lunaqgszbae4sxgjzamj2xiidhn52cajleei______[] = "\x80\x44""%s\x1f%d\x1f%s\x1f%d";
+const FAR char __fmt_eiqduos4ojog4tlpmnvsazloorzhsidemf2gcos4ojog4iq_[] = "\x80\x45""";
+const FAR char __fmt_ejrxezlborsv63lpmnvv6zloorzhskbjhiqeo33uebhfktcmebyg62loorsxeidxnf2gqidtnf5gkidhojswc5dfoiqhi2dbnyqhuzlsn4udakjamzxxeidnn5rwwidjmqqcojlte5ohexdoei______[] = "\x80\x46""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dkojwhiqecu2tivjfiorafbuwix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x47""";
+const FAR char __fmt_ejdg65lomqqhk3tsmvqwiidnn5rwwidjmqqcojlte4xcartbnfwgs3theb2gk43ufzohexdoei______[] = "\x80\x48""%s";
+const FAR char __fmt_ejsxq2luhiqck4z2easxgibievwhklrfgazwy5janvzssxdslrxce___[] = "\x80\x49""%s\x1f%s\x1f%lu\x1f%03lu";
+const FAR char __fmt_ejohexdonbqxe3tfonzsa4tfobxxe5b2eb2g65dbnquckzbjfqqhayltonswikbfmqusyidgmfuwyzlefaswikjmebzww2lqobswikbfmquvy4s4nzohexdoei______[] = "\x80\x4a""%d\x1f%d\x1f%d\x1f%d";
+const FAR char __fmt_ei6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6savcfknkcarkoiqqcqjltfeqd2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6vy4s4nzohexdoei______[] = "\x80\x4b""%s";
+const FAR char __fmt_ejohexdoei______[] = "\x80\x4c""";
+const FAR char __fmt_ei6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5ebkeku2uebbekr2jjyqd2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hvohexdolrzfy3rc[] = "\x80\x4d""";
+const FAR char __fmt_ejww6y3lebqxezlomeqhg2l2mu5cajlvebrhs5dfonohexdoei______[] = "\x80\x4e""%u";
+const FAR char __fmt_ejohexdomvxhizlshiqck424ojog4iq_[] = "\x80\x4f""%s";
+const FAR char __fmt_eixwwzlsnzswyl3unbzgil3mnfzxiiq_[] = "\x80\x50""";
+const FAR char __fmt_eiswgiq_[] = "\x80\x51""%c";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dqobthiqecu2tivjfiorafbuwix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x52""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dsmbxhiqecu2tivjfiorafbuwix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x53""";
+const FAR char __fmt_ejugc4tomvzxgx3nn5rwwx3do5zgs5dffautuicnn5rwwidfnz2he6jamnqwy3dcmfrwwidnmvww64tzebqwy3dpmnqxi2lpnyqgmyljnrswiidgn5zca2leeatsk4zhlrzfy3rc[] = "\x80\x54""%s";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv64tfmfscqkj2ebgw6y3lebuwiibhevzsoidon52caztpovxgils4ojog4iq_[] = "\x80\x55""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dcmbygi5caqktkncvevb2eaugszc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x56""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dcmjsgm5caqktkncvevb2eaugszc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x57""";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5cardborqsa3ljonwwc5ddnaqgm33sebww6y3lebuwiibhevzsoibc[] = "\x80\x58""%s";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5car3poqqe4vkmjqqha33jnz2gk4rao5uxi2baonuxuzjam5zgkylumvzca5dimfxca6tfojxsqmbjebtg64ranvxwg2zanfscajzfomtsaiq_[] = "\x80\x59""%s";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5cavdspfuw4zzaorxsa4tfmfscazlymfrxi3dzeaswiidcpf2gk4ziomusaztsn5wsa3lpmnvsa2leeatsk4zhebrhk5bam5xxiibfmqra____[] = "\x80\x5a""%d\x1f%s\x1f%d";
+const FAR char __fmt_ei5duxdslrxe233dnmqgk3tuoj4sazdborqtuxdslrxce___[] = "\x80\x5b""";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5cajlthiqg233dnmqgszbanzxxiidgn52w4zc4ojog4iq_[] = "\x80\x5c""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dcmjzgu5caqktkncvevb2eaugszc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x5d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dcmrrg45caqktkncvevb2eaugszc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x5e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2gu3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x5f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2gu3tuicbknjukusuhiqcqzdfozpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x60""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2gy4tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x61""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4yduicbknjukusuhiqcqzdtorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x62""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4ytuicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x63""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2heztuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x64""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he2duicbknjukusuhiqcq43smnpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x65""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he2tuicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x66""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2geytmoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x67""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2geytooraifjvgrkskq5cakdtnf5gkib6eaycyibsgiusaxdslrxce___[] = "\x80\x68""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorvhe5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x69""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorwga5caqktkncvevb2eaugizlwl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x6a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorxha5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x6b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorygu5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x6c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorzgi5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x6d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5ugc43if5rxeyzomm5dsojwhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x6e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5ugc43if5rxeyzomm5dcmbvgm5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x6f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc643zomxggorwgq4duicbknjukusuhiqcq5lqoruw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x70""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc643zomxggorwgy3tuicbknjukusuhiqcq5lqoruw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x71""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2gyytuicbknjukusuhiqcq3tpo5pxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x72""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2g4zduicbknjukusuhiqcq3tfo5pxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x73""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2ha3tuicbknjukusuhiqcq4tfonpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x74""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2ha4duicbknjukusuhiqcq3dfmz2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x75""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2ha4tuicbknjukusuhiqcq4tjm5uhix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x76""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydgoraifjvgrkskq5cakdsmvzv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x77""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydioraifjvgrkskq5cakdmmvthix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x78""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydkoraifjvgrkskq5cakdsnftwq5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x79""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss65lonf4f65djnvsv65dpl5sgc5dffzutunrwhiqecu2tivjfiorafbsgc5dfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x7a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss65lonf4f65djnvsv65dpl5sgc5dffzutunrxhiqecu2tivjfiorafb2gs3lfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x7b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdcnj2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x7c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdcnr2ebavgu2fkjkduibioruw2zlpov2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x7d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdcnz2ebavgu2fkjkduibimnqwy3dcmfrwwibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x7e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdinb2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x7f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdqnj2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x80""";
+const FAR char __fmt_eiqcaibaeaqcaibaeaqcaibaeaqe4qkniuqcaibaeaqcaictkravirjaebifeskpeaqeyt2hjvavgs24ojog4iq_[] = "\x80\x81""";
+const FAR char __fmt_eistemdteastcmtteastkzbaeaqcaibqpastamtylrzfy3rc[] = "\x80\x82""%20s\x1f%12s\x1f%5d\x1f%02x";
+const FAR char __fmt_ejkxgylhmu5ca43forpwy33hl5wwc43lea6hi2dsmvqwiidomfwwkprahrwg6zzanvqxg2z6lrzfy3rc[] = "\x80\x83""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4ydkoraifjvgrkskq5cakdnmfuw4ibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x84""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4ydmoraifjvgrkskq5cakdtorqwg227oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x85""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4ydooraifjvgrkskq5cakdtorqwg227onuxuzjahyqhg2l2mvxwmkdtorzhky3ueb2gq4tel52csibleaysyibsgiusaxdslrxce___[] = "\x80\x86""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g43tsoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x87""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2haydgoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x88""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2heydmoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x89""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2hezdgoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2he2daoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2he3tooraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2he4tioraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2geydenj2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x8e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2geydgnr2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x8f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dinzthiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x92""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dinzuhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x93""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dinzvhiqecu2tivjfiorafbzws6tfea7d2ibvfqqdemrjebohexdoei______[] = "\x80\x94""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dinzwhiqecu2tivjfiorafbrwq33vorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x95""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2dsmz2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x96""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2dsnb2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x97""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2tamj2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x98""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2tamr2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x99""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2taoj2ebavgu2fkjkduibimfsgi4tfonzsapbaonuxuzlpmyuhgzluoruw4z3tl5sgkztbovwhikjmeazdekjalrzfy3rc[] = "\x80\x9a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2tcmb2ebavgu2fkjkduibifbqwizdsmvzxgiblebzws6tffeqdypjaonuxuzlpmyuhgzluoruw4z3tl5sgkztbovwhikjmeazdekjalrzfy3rc[] = "\x80\x9b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2tcoj2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x9c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2temb2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x9d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2temj2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x9e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2timr2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x9f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2timz2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xa0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2tinb2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xa1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi2tmnb2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xa2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpobxxe5dtf5wgs3tvpaxw45tnl5yg64tufzutunjvhiqecu2tivjfiorafbww6zdvnrss44dpoj2c43twnvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xa3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqnj2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\xa4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqnr2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xa5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqnz2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xa6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsnb2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\xa7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsnj2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xa8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsnr2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xa9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhizdanj2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\xaa""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhizdanr2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xab""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhizdanz2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xac""";
+const FAR char __fmt_eistaodmpastaodmpbohexdoei______[] = "\x80\xad""%08lx\x1f%08lx";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtunzqgy5caqktkncvevb2eaugg33nnvqw4zc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xae""";
+const FAR char __fmt_eisxgoramnxw23lbnzsca3tpoqqgm33vnzsfy4s4nyra____[] = "\x80\xaf""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtuojugy5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xb0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtuojug45caqktkncvevb2eauhaylunbpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xb1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgazduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgm2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgm3duicbknjukusuhiqcqkdeon2f64baee6sakbiozxwszbafiutakjjeb6hyibionuxuzjahu6sambjfqqdemrjebohexdoei______[] = "\x80\xb4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqhazduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqhaztuicbknjukusuhiqcqzdtorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xb6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrgezduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrgeztuicbknjukusuhiqcqkdtojrv64baee6sakbiozxwszbafiutakjjeb6hyibionuxuzjahu6sambjfqqdemrjebohexdoei______[] = "\x80\xb8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrguyduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrheytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xba""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsge3tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xbb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsgyyduicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xbc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsgyytuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xbd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtga4duicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xbe""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtgm2duicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xbf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtheztuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjugizduicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjugiztuicbknjukusuhiqcq43umf2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjuhayduicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvgm3duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvgm3tuicbknjukusuhiqcqy3in52xix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xc5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvg44tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvhayduicbknjukusuhiqcqy3in52xix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xc7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjwgq4duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgm2duicbknjukusuhiqcqytvmzpxaibbhuqe4vkmjqwcarkjjzlectbjebohexdoei______[] = "\x80\xc9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgm2tuicbknjukusuhiqcq4dboruf64dqeaqt2icokvgeylbaiveu4vsbjqusaxdslrxce___[] = "\x80\xca""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgm3duicbknjukusuhiqcqy3nmrpxa4baee6satsvjrgcyicfjfhfmqkmfeqfy4s4nyra____[] = "\x80\xcb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgyzduicbknjukusuhiqcq4dboruf64baee6satsvjrgcyicfjfhfmqkmfeqfy4s4nyra____[] = "\x80\xcc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgyztuicbknjukusuhiqcqy3nmrpxaibbhuqe4vkmjqwcarkjjzlectbjebohexdoei______[] = "\x80\xcd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxg42duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xce""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxg42tuicbknjukusuhiqcq3tbnvsv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xcf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxg43duicbknjukusuhiqcq33qonpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xd0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjygu2duicbknjukusuhiqcqztjnrsxg6ltorsw2x3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xd1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjygy2duicbknjukusuhiqcqmbmeawtgobjebohexdoei______[] = "\x80\xd2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyg42duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyg42tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyg43duicbknjukusuhiqcqy3bnrwgeyldnmqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xd5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyha4tuicbknjukusuhiqcqy3pnvwwc3tel5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xd6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgqztuicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xd7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzguzduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzguztuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgy4tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xda""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzg44duicbknjukusuhiqcqy3povxhizlsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xdb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzheytuicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xdc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzhe4duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xdd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqge3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xde""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqge4duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xdf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqge4tuicbknjukusuhiqcq43forpwgyraee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqgiyduicbknjukusuhiqcq4dsnfxhix3dmiqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqgiytuicbknjukusuhiqcq5tbnr2wkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xe2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqgm4duicbknjukusuhiqcq4dbojqw2zlumvzf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqguytuicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xe4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqgu4duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunbzhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xe6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjqhiqecu2tivjfiorafbzgkyleeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xe7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjrhiqecu2tivjfiorafb3xe2lumuqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjshiqecu2tivjfiorafbzws6tfeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xe9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqgm5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xea""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqgq5caqktkncvevb2eaugk3dfnvsw45dtl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xeb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqgu5caqktkncvevb2eaug45lnmjsxex3pmzpwk3dfnvsw45dtea7cambmeazdekjalrzfy3rc[] = "\x80\xec""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjrgy5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xed""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjtgy5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xee""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvge5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xef""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvgi5caqktkncvevb2eaucqkdtorzhky3uebrwqylol52cakrjonswyzs7oaus2ptsmvqwiibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvgm5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xf1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvgq5caqktkncvevb2eauhg2l2muqd4ibqfqqdemrjebohexdoei______[] = "\x80\xf2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwgm5caqktkncvevb2eauhmx3tmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xf3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwgq5caqktkncvevb2eaucqkdtorzhky3uebrwqylol52cakrjozpxgzlmmzpxakjnhz3xe2lumuqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xf4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwgu5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xf5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwgy5caqktkncvevb2eauhg2l2muqd4ibqfqqdemrjebohexdoei______[] = "\x80\xf6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrrgm5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrtg45caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrugq5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrugu5caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfa""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrwgu5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrwgy5caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrzga5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorxgi5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfe""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorxgm5caqktkncvevb2eaucqytvmzpxaib5huqcqkdwn5uwiibkfeycskjapr6cakbimj2wmx3qeaqt2ibifb3g62leeavcsmbjfeqcmjrafbzws6tfea7cambjfewcamrsfeqfy4s4nyra____[] = "\x80\xff""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrga3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x01""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrge3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x02""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrgu2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x03""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrgu3duicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x04""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorsgmzduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x05""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorsgmztuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x06""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgi3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x07""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgm3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x08""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgu3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x0e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgu4duicbknjukusuhiqcq43jpjssapr5eaycyibsgiusaxdslrxce___[] = "\x81\x0f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2gq2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x10""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2gu3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x11""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2ha3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x12""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2he4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x13""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2gezdcoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x14""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2ge2teoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x15""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dimb2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x16""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dimj2ebavgu2fkjkduibifbrw65looqqd4pjagausajrgeaugg33vnz2capb5ebrw65loorpw2ylyfewcamrsfeqfy4s4nyra____[] = "\x81\x17""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dimr2ebavgu2fkjkduibimnxxk3tul5wwc6bahyqdalbagizcsic4ojog4iq_[] = "\x81\x18""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dknr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x19""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dqob2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x1a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dqoj2ebavgu2fkjkduibimnxxk3tuea7d2ibqfqqdemrjebohexdoei______[] = "\x81\x1b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5wxk5dfpaxggorrg4yduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x1c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5wxk5dfpaxggorrha3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x1d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5donr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x1e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dqob2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x1f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dqoj2ebavgu2fkjkduibimnugc3s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x21""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcmbuhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x23""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcmbvhiqecu2tivjfiorafauha33mnfrxsib5huqdakjapr6cakdqn5wgsy3zea6t2ibrfewcamrsfeqfy4s4nyra____[] = "\x81\x24""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcmrthiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x26""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcmruhiqecu2tivjfiorafbwgs43umvxgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x27""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcnbyhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x28""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcnbzhiqecu2tivjfiorafbwgs43umvxgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x29""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcojvhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x2a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcojwhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x2b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcojxhiqecu2tivjfiorafbzws6tfea7cambmeazdekjalrzfy3rc[] = "\x81\x2c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5demrthiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x2d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5demruhiqecu2tivjfiorafbugkylql5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x2e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5demrvhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x2f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggortgm5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x30""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorvga5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x31""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorvge5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x32""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorvgi5caqktkncvevb2eauhg2l2muqd2pjaonuxuzlpmyuhk2looqztex3ufewcamrsfeqfy4s4nyra____[] = "\x81\x33""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorygq5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x34""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorygu5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x35""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorygy5caqktkncvevb2eauhg2l2muqd2pjaonuxuzlpmyuhk2looqztex3ufewcamrsfeqfy4s4nyra____[] = "\x81\x36""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrge4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x37""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrge4tuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x38""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrgiyduicbknjukusuhiqcq43jpjssapj5ebzws6tfn5tcq5ljnz2dgms7oqusyibsgiusaxdslrxce___[] = "\x81\x39""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrguzduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x3a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrgu4tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x3b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjthe5caqktkncvevb2eaugi43ul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x3c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjuga5caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x3d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjvgu5caqktkncvevb2eaugi43ul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x3e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjvgy5caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x3f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjygm5caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x40""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrqge5caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x41""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrqgi5caqktkncvevb2eaugc4c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x42""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrrg45caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x43""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrrha5caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x44""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrtgy5caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x45""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrtg45caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x46""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrtha5caqktkncvevb2eaugc4c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x47""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmryhe5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x48""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrzga5caqktkncvevb2eauhmylmovsv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x49""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrzge5caqktkncvevb2eaucqytbonssapj5eaytmkjapr6cakdcmfzwkib5huqdcmbjeb6hyibimjqxgzjahu6saobjeb6hyibimjqxgzjahu6samrjeb6hyibimjqxgzjahu6sambjfqqdemrjebohexdoei______[] = "\x81\x4a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnjxgq5caqktkncvevb2eaugi43ul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x4b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnjxgu5caqktkncvevb2eaugm43smnpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x4c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnjzge5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x4d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnjzgi5caqktkncvevb2eaugm43uojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x4e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrqgy5caqktkncvevb2eaugm43uoiyf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x4f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrqg45caqktkncvevb2eaugm43uoiyv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x50""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrsgi5caqktkncvevb2eaugm43uojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x51""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrsgm5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x52""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrugu5caqktkncvevb2eaugm43uoiyf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x53""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrugy5caqktkncvevb2eaugm43uoiyv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x54""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrwgy5caqktkncvevb2eaugm43uojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x55""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnrxha5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x56""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnzrgm5caqktkncvevb2eaucqytvmzpxaibbhuqe4vkmjqusa7d4eauhg2l2muqd2pjagausyicfjfhfmqkmfeqfy4s4nyra____[] = "\x81\x57""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnzrgq5caqktkncvevb2eaucqy3imfzhgx3qeaqt2icokvgeykjapr6cakdmmvxgo5diea6t2ibqfewcarkjjzlectbjebohexdoei______[] = "\x81\x58""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnzsgq5caqktkncvevb2eaucqytvmzpxaibbhuqe4vkmjqusa7d4eauhg2l2muqd2pjagausyicfjfhfmqkmfeqfy4s4nyra____[] = "\x81\x59""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcnzsgu5caqktkncvevb2eaucqy3imfzhgx3qeaqt2icokvgeykjapr6cakdmmvxgo5diea6t2ibqfewcarkjjzlectbjebohexdoei______[] = "\x81\x5a""";
+const FAR char __cmd_eixwm33pei______[] = "/\x80\x05";
+const FAR char __cmd_eixweylsei______[] = "/\x80\x06";
+const FAR char __cmd_eixxg3tboaxwg33vnz2gk4rc[] = "/\x80\x07";
+const FAR char __cmd_eixxg3tboaxxaylsmfwwk5dfoira____[] = "/\x80\x08";
+const FAR char __cmd_eixxg3tboaxxg5dsnfxgoiq_[] = "/\x80\x0e";
+const FAR char __cmd_eixwwzlsnzswyl3unbzgil3mnfzxiiq_[] = "/\x80\x90";
+const FAR char __cmd_eixwwzlsnzswyl3unbzgil3tmv2f63dpm5pw2yltnmra____[] = "/\x80\x91";
+